@@ -40,8 +40,10 @@ module agu (
     output wire        mem_op_sw_o,
     output wire        mem_op_load_o,
     output wire        mem_op_store_o,
+    output wire        mem_op_amo_o,
+    output wire [ 4:0] mem_amo_op_o,
     output wire [31:0] mem_addr_o,
-    output wire [ 3:0] mem_wmask_o,
+    output wire [ 7:0] mem_wmask_o,  // 按地址低2位移位后的字节掩码，[7:4]非零表示跨字
     output wire [31:0] mem_wdata_o,
     output wire        misaligned_load_o,
     output wire        misaligned_store_o
@@ -67,58 +69,48 @@ module agu (
     assign mem_op_sw_o    = mem_op_sw;
     assign mem_op_load_o  = mem_info[`DECINFO_MEM_OP_LOAD];
     assign mem_op_store_o = mem_info[`DECINFO_MEM_OP_STORE];
+    assign mem_op_amo_o   = mem_info[`DECINFO_MEM_OP_AMO];
+    assign mem_amo_op_o   = mem_info[`DECINFO_MEM_AMOOP];
+
+    // LR为读，SC与AMO按写处理(地址不对齐时报store/AMO异常)
+    wire amo_is_lr = mem_op_amo_o && (mem_amo_op_o == `INST_LR);
 
     // 直接计算内存地址
     wire [31:0] mem_addr = rs1_rdata_i + dec_imm_i;
     wire [ 1:0] mem_addr_index = mem_addr[1:0];
     wire        valid_op = op_mem;
 
-    // 存储操作的掩码和数据计算
-    wire [ 3:0] sb_mask;
-    wire [31:0] sb_data;
-    assign sb_mask = ({4{mem_addr_index == 2'b00}} & 4'b0001) |
-                     ({4{mem_addr_index == 2'b01}} & 4'b0010) |
-                     ({4{mem_addr_index == 2'b10}} & 4'b0100) |
-                     ({4{mem_addr_index == 2'b11}} & 4'b1000);
-    assign sb_data = ({32{mem_addr_index == 2'b00}} & {24'b0, rs2_rdata_i[7:0]}) |
-                     ({32{mem_addr_index == 2'b01}} & {16'b0, rs2_rdata_i[7:0], 8'b0}) |
-                     ({32{mem_addr_index == 2'b10}} & {8'b0, rs2_rdata_i[7:0], 16'b0}) |
-                     ({32{mem_addr_index == 2'b11}} & {rs2_rdata_i[7:0], 24'b0});
-
-    wire [ 3:0] sh_mask;
-    wire [31:0] sh_data;
-    assign sh_mask = ({4{mem_addr_index[1] == 1'b0}} & 4'b0011) | 
-                     ({4{mem_addr_index[1] == 1'b1}} & 4'b1100);
-    assign sh_data = ({32{mem_addr_index[1] == 1'b0}} & {16'b0, rs2_rdata_i[15:0]}) |
-                     ({32{mem_addr_index[1] == 1'b1}} & {rs2_rdata_i[15:0], 16'b0});
+    // 存储操作的掩码和数据计算：掩码按地址低2位左移成8位，[3:0]写入地址所在字，
+    // [7:4]写入下一个字；数据按字节循环左移，两个字的有效字节都取自同一个32位值
+    wire [ 7:0] sb_mask = {7'b0, mem_op_sb} << mem_addr_index;
+    wire [ 7:0] sh_mask = {6'b0, {2{mem_op_sh}}} << mem_addr_index;
+    wire [ 7:0] sw_mask = {4'b0, {4{mem_op_sw | mem_op_amo_o}}} << mem_addr_index;
 
-    wire [ 3:0] sw_mask;
-    wire [31:0] sw_data;
-    assign sw_mask = 4'b1111;
-    assign sw_data = rs2_rdata_i;
+    wire [31:0] st_data = ({32{mem_addr_index == 2'b00}} & rs2_rdata_i) |
+                          ({32{mem_addr_index == 2'b01}} & {rs2_rdata_i[23:0], rs2_rdata_i[31:24]}) |
+                          ({32{mem_addr_index == 2'b10}} & {rs2_rdata_i[15:0], rs2_rdata_i[31:16]}) |
+                          ({32{mem_addr_index == 2'b11}} & {rs2_rdata_i[7:0], rs2_rdata_i[31:8]});
 
-    wire [ 3:0] mem_wmask;
+    wire [ 7:0] mem_wmask;
     wire [31:0] mem_wdata;
-    assign mem_wmask = ({4{valid_op & mem_op_sb}} & sb_mask) |
-                       ({4{valid_op & mem_op_sh}} & sh_mask) |
-                       ({4{valid_op & mem_op_sw}} & sw_mask);
-    assign mem_wdata = ({32{valid_op & mem_op_sb}} & sb_data) |
-                       ({32{valid_op & mem_op_sh}} & sh_data) |
-                       ({32{valid_op & mem_op_sw}} & sw_data);
+    assign mem_wmask = {8{valid_op}} & (sb_mask | sh_mask | sw_mask);
+    assign mem_wdata = {32{valid_op & (mem_op_store_o | mem_op_amo_o)}} & st_data;
 
     assign mem_addr_o = mem_addr;
     assign mem_wmask_o = mem_wmask;
     assign mem_wdata_o = mem_wdata;
 
-    // 地址对齐检测逻辑
-    assign misaligned_load_o  = mem_op_load_o  & (
+    // 地址对齐检测逻辑，LSU_MISALIGNED_EN为1时普通load/store由LSU拆分完成，仅原子指令报异常
+    wire ma_trap_en = (`LSU_MISALIGNED_EN == 0);
+
+    assign misaligned_load_o  = (ma_trap_en & mem_op_load_o  & (
         (mem_op_lw_o  && (mem_addr_o[1:0] != 2'b00)) ||
         ((mem_op_lh_o | mem_op_lhu_o) && (mem_addr_o[0] != 1'b0))
-    );
+    )) || (amo_is_lr && (mem_addr_o[1:0] != 2'b00));
 
-    assign misaligned_store_o = mem_op_store_o & (
+    assign misaligned_store_o = (ma_trap_en & mem_op_store_o & (
         (mem_op_sw_o && (mem_addr_o[1:0] != 2'b00)) ||
         (mem_op_sh_o && (mem_addr_o[0] != 1'b0))
-    );
+    )) || (mem_op_amo_o && !amo_is_lr && (mem_addr_o[1:0] != 2'b00));
 
 endmodule
@@ -0,0 +1,251 @@
+/*         
+ The MIT License (MIT)
+
+ Copyright © 2025 Yusen Wang @yusen.w@qq.com
+                                                                         
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+                                                                         
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+                                                                         
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+`include "defines.svh"
+
+// 动态分支预测模块
+// 取指级: 按PC查询BTB，命中且预测跳转时直接给出下一条取指地址
+// 指令返回级: 译码分支指令，条件分支查BHT(2位饱和计数器，可选gshare)，
+//             JAL直接跳转，函数返回从RAS弹出，其余JALR查BTB；
+//             若与取指时选择的下一PC不一致则重定向取指
+// 执行级: 按实际结果训练BHT/GHR，回填间接跳转目标
+module bpu (
+    input wire clk,
+    input wire rst_n,
+
+    // 取指级BTB查询
+    input  wire [`INST_ADDR_WIDTH-1:0] fetch_pc_i,    // 当前取指地址
+    output wire                        btb_taken_o,   // BTB预测跳转
+    output wire [`INST_ADDR_WIDTH-1:0] btb_target_o,  // BTB预测目标
+
+    // 指令返回级预测
+    input wire [`INST_DATA_WIDTH-1:0] inst_i,        // 指令内容
+    input wire                        inst_valid_i,  // 指令有效信号
+    input wire [`INST_ADDR_WIDTH-1:0] pc_i,          // PC指针
+    input wire                        inst_c_i,      // 压缩指令，顺序下一PC为pc+2
+    input wire [`INST_ADDR_WIDTH-1:0] pred_npc_i,    // 取指时选择的下一PC
+    input wire                        any_stall_i,   // 流水线暂停信号
+
+    output wire                        branch_taken_o,    // 需要重定向取指
+    output wire [`INST_ADDR_WIDTH-1:0] branch_addr_o,     // 重定向地址
+    output wire                        is_pred_branch_o,  // 条件分支或JALR被预测为跳转
+    output wire [ `BPU_META_WIDTH-1:0] bpu_meta_o,        // 预测元数据
+
+    // 执行级更新
+    input wire                          upd_valid_i,    // 分支指令执行完成
+    input wire [  `INST_ADDR_WIDTH-1:0] upd_pc_i,       // 分支指令地址
+    input wire                          upd_cond_i,     // 条件分支
+    input wire                          upd_jalr_i,     // JALR
+    input wire                          upd_taken_i,    // 实际是否跳转
+    input wire [  `INST_ADDR_WIDTH-1:0] upd_target_i,   // 实际跳转目标
+    input wire [`BPU_BHT_IDX_WIDTH-1:0] upd_bht_idx_i   // 预测时使用的BHT索引
+);
+
+    localparam BHT_IDX_W = `BPU_BHT_IDX_WIDTH;
+    localparam BHT_NUM = 1 << BHT_IDX_W;
+    localparam GHR_W = `BPU_GHR_WIDTH;
+    localparam GHR_W_S = (GHR_W > 0) ? GHR_W : 1;
+    localparam BTB_IDX_W = `BPU_BTB_IDX_WIDTH;
+    localparam BTB_NUM = 1 << BTB_IDX_W;
+    localparam BTB_TAG_W = `INST_ADDR_WIDTH - BTB_IDX_W - 2;
+    localparam RAS_DEPTH = `BPU_RAS_DEPTH;
+    localparam RAS_PTR_W = $clog2(RAS_DEPTH);
+
+    // BTB表项类型
+    localparam BTB_COND = 2'd0;  // 条件分支，方向由BHT决定
+    localparam BTB_JUMP = 2'd1;  // JAL，总是跳转
+    localparam BTB_RET = 2'd2;  // 函数返回，目标取RAS栈顶
+    localparam BTB_IND = 2'd3;  // 其余JALR，目标由执行级回填
+
+    // ---------------- 表项存储 ----------------
+    reg [                 1:0] bht        [0:BHT_NUM-1];
+    reg [         GHR_W_S-1:0] ghr;
+
+    reg                        btb_valid  [0:BTB_NUM-1];
+    reg [       BTB_TAG_W-1:0] btb_tag    [0:BTB_NUM-1];
+    reg [`INST_ADDR_WIDTH-1:0] btb_target [0:BTB_NUM-1];
+    reg [                 1:0] btb_type   [0:BTB_NUM-1];
+    reg                        btb_fend   [0:BTB_NUM-1];  // 分支结束于字尾，可在取指级按字地址预测
+
+    reg [`INST_ADDR_WIDTH-1:0] ras        [0:RAS_DEPTH-1];
+    reg [       RAS_PTR_W-1:0] ras_ptr;  // 下一个写入位置
+    reg [         RAS_PTR_W:0] ras_cnt;  // 有效表项数
+
+    wire [RAS_PTR_W-1:0] ras_top_ptr = (ras_ptr == 0) ? RAS_PTR_W'(RAS_DEPTH - 1) : ras_ptr - 1'b1;
+    wire [`INST_ADDR_WIDTH-1:0] ras_top = ras[ras_top_ptr];
+    wire ras_empty = (ras_cnt == 0);
+
+    // gshare索引: PC[IDX+1:2]与全局历史异或
+    wire [BHT_IDX_W-1:0] hist = (GHR_W > 0) ? BHT_IDX_W'(ghr) : {BHT_IDX_W{1'b0}};
+
+    function automatic [BHT_IDX_W-1:0] bht_index(input [`INST_ADDR_WIDTH-1:0] pc);
+        bht_index = pc[BHT_IDX_W+1:2] ^ hist;
+    endfunction
+
+    function automatic [BTB_IDX_W-1:0] btb_index(input [`INST_ADDR_WIDTH-1:0] pc);
+        btb_index = pc[BTB_IDX_W+1:2];
+    endfunction
+
+    function automatic [BTB_TAG_W-1:0] btb_tag_of(input [`INST_ADDR_WIDTH-1:0] pc);
+        btb_tag_of = pc[`INST_ADDR_WIDTH-1:BTB_IDX_W+2];
+    endfunction
+
+    // ---------------- 取指级BTB查询 ----------------
+    wire [BTB_IDX_W-1:0] f_btb_idx = btb_index(fetch_pc_i);
+    wire f_btb_hit = btb_valid[f_btb_idx] && (btb_tag[f_btb_idx] == btb_tag_of(fetch_pc_i));
+    wire [1:0] f_btb_type = btb_type[f_btb_idx];
+    wire f_cond_taken = bht[bht_index(fetch_pc_i)][1];
+
+    // 支持压缩指令时BTB按字索引，字中前半条压缩分支之后还有指令，不能在取指级跳过
+    assign btb_taken_o = f_btb_hit & btb_fend[f_btb_idx] & ((f_btb_type == BTB_COND) ? f_cond_taken :
+                                      (f_btb_type == BTB_RET) ? ~ras_empty : 1'b1);
+    assign btb_target_o = (f_btb_type == BTB_RET) ? ras_top : btb_target[f_btb_idx];
+
+    // ---------------- 指令返回级预测 ----------------
+    wire [6:0] opcode = inst_i[6:0];
+    wire [4:0] rd = inst_i[11:7];
+    wire [4:0] rs1 = inst_i[19:15];
+
+    wire inst_type_branch = (opcode == 7'b1100011);
+    wire inst_jal = (opcode == 7'b1101111);
+    wire inst_jalr = (opcode == 7'b1100111);
+
+    // 按调用约定识别调用/返回: rd为ra/t0时压栈，rs1为ra/t0且rd不是链接寄存器时弹栈
+    wire rd_link = (rd == 5'd1) | (rd == 5'd5);
+    wire rs1_link = (rs1 == 5'd1) | (rs1 == 5'd5);
+    wire is_call = (inst_jal | inst_jalr) & rd_link;
+    wire is_ret = inst_jalr & rs1_link & ~rd_link;
+
+    wire [31:0] inst_b_type_imm = {{20{inst_i[31]}}, inst_i[7], inst_i[30:25], inst_i[11:8], 1'b0};
+    wire [31:0] inst_j_type_imm = {
+        {12{inst_i[31]}}, inst_i[19:12], inst_i[20], inst_i[30:21], 1'b0
+    };
+
+    wire [BHT_IDX_W-1:0] d_bht_idx = bht_index(pc_i);
+    wire d_cond_taken = bht[d_bht_idx][1];
+
+    wire [BTB_IDX_W-1:0] d_btb_idx = btb_index(pc_i);
+    wire d_btb_hit = btb_valid[d_btb_idx] && (btb_tag[d_btb_idx] == btb_tag_of(pc_i));
+    wire [1:0] d_btb_type = btb_type[d_btb_idx];
+
+    wire [`INST_ADDR_WIDTH-1:0] pc_seq = pc_i + (inst_c_i ? 32'd2 : 32'd4);  // 顺序下一PC
+
+    reg pred_taken;
+    reg [`INST_ADDR_WIDTH-1:0] pred_target;
+    reg [1:0] alloc_type;
+
+    always @(*) begin
+        pred_taken  = 1'b0;
+        pred_target = pc_seq;
+        alloc_type  = BTB_COND;
+
+        case (1'b1)
+            inst_type_branch: begin
+                pred_taken  = d_cond_taken;
+                pred_target = pc_i + inst_b_type_imm;
+                alloc_type  = BTB_COND;
+            end
+            inst_jal: begin
+                pred_taken  = 1'b1;
+                pred_target = pc_i + inst_j_type_imm;
+                alloc_type  = BTB_JUMP;
+            end
+            inst_jalr: begin
+                if (is_ret) begin
+                    pred_taken  = ~ras_empty;
+                    pred_target = ras_top;
+                    alloc_type  = BTB_RET;
+                end else begin
+                    pred_taken  = d_btb_hit & (d_btb_type == BTB_IND);
+                    pred_target = btb_target[d_btb_idx];
+                    alloc_type  = BTB_IND;
+                end
+            end
+            default: ;
+        endcase
+    end
+
+    wire [`INST_ADDR_WIDTH-1:0] pred_npc = pred_taken ? pred_target : pc_seq;
+    // 指令被ifu_pipe接收的时刻，RAS与BTB分配在此时更新，保证每条指令只更新一次
+    wire inst_fire = inst_valid_i & ~any_stall_i;
+    wire is_bjp = inst_type_branch | inst_jal | inst_jalr;
+
+    assign branch_taken_o = inst_fire & (pred_npc != pred_npc_i);
+    assign branch_addr_o = pred_npc;
+    assign is_pred_branch_o = inst_valid_i & pred_taken & (inst_type_branch | inst_jalr);
+    assign bpu_meta_o = {d_bht_idx, pred_target};
+
+    // 间接跳转目标已由执行级回填时不再覆盖
+    wire btb_alloc = inst_fire & is_bjp & ~(d_btb_hit & (d_btb_type == alloc_type));
+
+    // ---------------- 执行级更新 ----------------
+    // 间接跳转表项在指令返回级只登记标签且保持无效，此处按标签匹配，写入实际目标后才置有效
+    wire [BTB_IDX_W-1:0] u_btb_idx = btb_index(upd_pc_i);
+    wire u_btb_ind = (btb_tag[u_btb_idx] == btb_tag_of(upd_pc_i)) && (btb_type[u_btb_idx] == BTB_IND);
+    wire [1:0] u_bht = bht[upd_bht_idx_i];
+
+    integer i;
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            for (i = 0; i < BHT_NUM; i = i + 1) bht[i] <= 2'b01;  // 弱不跳转
+            for (i = 0; i < BTB_NUM; i = i + 1) btb_valid[i] <= 1'b0;
+            ghr     <= {GHR_W_S{1'b0}};
+            ras_ptr <= {RAS_PTR_W{1'b0}};
+            ras_cnt <= {(RAS_PTR_W + 1) {1'b0}};
+        end else begin
+            // RAS推测更新，流水线冲刷时不回滚
+            if (inst_fire & is_call) begin
+                ras[ras_ptr] <= pc_seq;
+                ras_ptr      <= (ras_ptr == RAS_PTR_W'(RAS_DEPTH - 1)) ? {RAS_PTR_W{1'b0}} : ras_ptr + 1'b1;
+                if (ras_cnt != RAS_DEPTH) ras_cnt <= ras_cnt + 1'b1;
+            end else if (inst_fire & is_ret & ~ras_empty) begin
+                ras_ptr <= ras_top_ptr;
+                ras_cnt <= ras_cnt - 1'b1;
+            end
+
+            // 间接跳转此时目标未知，不能沿用该表项中旧的目标，待执行级回填后再生效
+            if (btb_alloc) begin
+                btb_valid[d_btb_idx]  <= (alloc_type != BTB_IND);
+                btb_tag[d_btb_idx]    <= btb_tag_of(pc_i);
+                btb_target[d_btb_idx] <= pred_target;
+                btb_type[d_btb_idx]   <= alloc_type;
+                btb_fend[d_btb_idx]   <= (pc_i[1] == inst_c_i);
+            end
+
+            // 条件分支: 训练饱和计数器并移入全局历史(按执行顺序非推测更新)
+            if (upd_valid_i & upd_cond_i) begin
+                if (upd_taken_i && u_bht != 2'b11) bht[upd_bht_idx_i] <= u_bht + 1'b1;
+                else if (!upd_taken_i && u_bht != 2'b00) bht[upd_bht_idx_i] <= u_bht - 1'b1;
+                ghr <= GHR_W_S'({ghr, upd_taken_i});
+            end
+
+            // 间接跳转: 回填最近一次的实际目标
+            if (upd_valid_i & upd_jalr_i & u_btb_ind) begin
+                btb_valid[u_btb_idx]  <= 1'b1;
+                btb_target[u_btb_idx] <= upd_target_i;
+            end
+        end
+    end
+
+endmodule
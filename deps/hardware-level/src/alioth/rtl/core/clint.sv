@@ -34,6 +34,8 @@ module clint (
     input wire [`INST_ADDR_WIDTH-1:0] inst_addr_i,
     input wire [ `REG_DATA_WIDTH-1:0] inst_data_i,  // 非法指令内容
     input wire                        inst_valid_i, // 指令有效标志
+    input wire                        inst_dual_i,  // 执行级为双发射指令对或融合指令
+    input wire                        inst_c_i,     // 执行级为压缩指令
 
     // from ex
     input wire                        jump_flag_i,
@@ -63,10 +65,25 @@ module clint (
     input wire [`REG_DATA_WIDTH-1:0] csr_mepc,
     input wire [`REG_DATA_WIDTH-1:0] csr_mstatus,
     input wire [`REG_DATA_WIDTH-1:0] csr_mie,
+    input wire [`REG_DATA_WIDTH-1:0] csr_mfiret,
+
+    // from plic，当前最高优先级外部中断的处理函数地址与参数
+    input wire [`INST_ADDR_WIDTH-1:0] plic_vec_i,
+    input wire [ `REG_DATA_WIDTH-1:0] plic_arg_i,
+
+    // to gpr，快速中断寄存器影子组控制
+    output wire                       gpr_bank_o,       // 调用者保存寄存器访问影子组
+    output reg                        gpr_bank_load_o,  // 影子组ra/a0装载
+    output reg  [`REG_DATA_WIDTH-1:0] gpr_bank_ra_o,
+    output reg  [`REG_DATA_WIDTH-1:0] gpr_bank_a0_o,
 
     // EXU暂停信号输入
     input wire exu_stall_i,
 
+    // WFI休眠
+    input  wire wfi_i,    // 执行级WFI指令有效
+    output wire sleep_o,  // 核心处于休眠状态
+
     // to csr_reg
     output reg                       we_o,
     output reg [`BUS_ADDR_WIDTH-1:0] waddr_o,
@@ -141,7 +158,13 @@ module clint (
     // === 中断请求检测（受csr_mie控制）===
     wire ext_irq_en = ext_int_req_i & MEIE;
     wire timer_irq_en = timer_irq & MTIE;
+`ifndef SYNTHESIS
+    // 仿真专用软件中断注入口，由tb_top中的随机中断注入器层次化驱动
+    reg  sim_swi_inject = 1'b0;
+    wire soft_irq_en = (soft_irq | sim_swi_inject) & MSIE;
+`else
     wire soft_irq_en = soft_irq & MSIE;
+`endif
 
     // === exception_req/int_req/jump_flag_i/inst_valid_i/inst_addr_i/inst_data_i打一拍 ===
     wire exception_req = (sys_op_ecall_i || sys_op_ebreak_i || illegal_inst_i
@@ -152,6 +175,24 @@ module clint (
 
     wire int_req = (ext_irq_en | timer_irq_en | soft_irq_en) & global_int_en;
 
+    // === WFI休眠 ===
+    // 唤醒条件只看mie使能的挂起中断，不受mstatus.MIE影响；
+    // WFI执行当拍即阻止后续指令进入分发级，此后由sleep_r保持至唤醒
+    wire wfi_wake = ext_irq_en | timer_irq_en | soft_irq_en;
+    reg  sleep_r;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (~rst_n) begin
+            sleep_r <= 1'b0;
+        end else if (wfi_wake) begin
+            sleep_r <= 1'b0;
+        end else if (wfi_i) begin
+            sleep_r <= 1'b1;
+        end
+    end
+
+    assign sleep_o = (sleep_r | wfi_i) & ~wfi_wake;
+
     // wire exception_or_int = exception_req_r | int_req_r;
     wire exception_or_int = exception_req | int_req;
     wire int_pending = (int_state == S_INT_PENDING);
@@ -161,6 +202,57 @@ module clint (
 
     assign clint_req_valid_o = exception_or_int_valid | sys_op_mret_i;
 
+    // === 快速中断 ===
+    // mtvec.MODE=3时外部中断不经软件分发，直接跳转PLIC给出的处理函数；调用者保存寄存器
+    // 切换到影子组，a0装入处理函数参数、ra装入mfiret(指向mret)，处理函数可为普通C函数。
+    // 异常与定时器/软件中断仍按直接模式进入mtvec基地址。
+    wire fast_mode = (`CLINT_FAST_IRQ != 0) && (csr_mtvec[1:0] == 2'b11);
+    wire int_take = (int_state == S_INT_PENDING) && int_env_valid;
+    reg  fast_req_r;  // 本次陷入为可走快速路径的外部中断
+    reg  gpr_bank_r;  // 当前处于快速中断影子组
+    reg  [3:0] bank_nest;  // 影子组期间嵌套进入的普通陷入层数，对应mret不切回主寄存器组
+    wire fast_take = int_take && !mret_req && fast_req_r && (plic_vec_i != `ZeroWord);
+
+    assign gpr_bank_o = gpr_bank_r;
+
+`ifndef SYNTHESIS
+    reg [31:0] fast_irq_cnt;  // 快速中断进入次数(仅供仿真统计)
+`endif
+
+    always @(posedge clk or negedge rst_n) begin
+        if (~rst_n) begin
+            gpr_bank_r      <= 1'b0;
+            bank_nest       <= 4'd0;
+            gpr_bank_load_o <= 1'b0;
+            gpr_bank_ra_o   <= `ZeroWord;
+            gpr_bank_a0_o   <= `ZeroWord;
+        end else begin
+            gpr_bank_load_o <= 1'b0;
+            if (fast_take) begin
+                gpr_bank_r      <= 1'b1;
+                bank_nest       <= 4'd0;
+                gpr_bank_load_o <= 1'b1;
+                gpr_bank_ra_o   <= csr_mfiret;
+                gpr_bank_a0_o   <= plic_arg_i;
+            end else if (int_take && gpr_bank_r) begin
+                if (!mret_req) begin
+                    bank_nest <= bank_nest + 4'd1;
+                end else if (bank_nest != 4'd0) begin
+                    bank_nest <= bank_nest - 4'd1;
+                end else begin
+                    gpr_bank_r <= 1'b0;
+                end
+            end
+        end
+    end
+
+`ifndef SYNTHESIS
+    always @(posedge clk or negedge rst_n) begin
+        if (~rst_n) fast_irq_cnt <= 32'b0;
+        else if (fast_take) fast_irq_cnt <= fast_irq_cnt + 1'b1;
+    end
+`endif
+
     always @(posedge clk or negedge rst_n) begin
         if (~rst_n) begin
             int_state    <= S_INT_IDLE;
@@ -169,6 +261,7 @@ module clint (
             inst_data_r  <= {`REG_DATA_WIDTH{1'b0}};
             saved_pc     <= `ZeroWord;
             mret_req     <= 1'b0;
+            fast_req_r   <= 1'b0;
         end else begin
             case (int_state)
                 S_INT_IDLE: begin
@@ -178,6 +271,8 @@ module clint (
                         jump_flag_r  <= jump_flag_i;
                         inst_valid_r <= inst_valid_i;
                         inst_data_r  <= inst_data_i;
+                        // 外部中断优先级最高，影子组已在使用时不再嵌套快速中断
+                        fast_req_r   <= fast_mode && !exception_req && ext_irq_en && !gpr_bank_r;
                         // 整合保存PC逻辑
                         if (exception_req) begin
                             saved_pc <= inst_addr_i;
@@ -185,7 +280,7 @@ module clint (
                             if (jump_flag_i) begin
                                 saved_pc <= jump_addr_i;
                             end else begin
-                                saved_pc <= inst_addr_i + 4;
+                                saved_pc <= inst_addr_i + (inst_dual_i ? 32'd8 : inst_c_i ? 32'd2 : 32'd4);
                             end
                         end
                     end else if (sys_op_mret_i) begin
@@ -352,10 +447,12 @@ module clint (
                     int_addr_o <= csr_mepc;
                 end else begin
                     int_jump_o <= 1'b1;
-                    if (int_req && csr_mtvec[0]) begin
+                    if (fast_take) begin
+                        int_addr_o <= plic_vec_i;
+                    end else if (int_req && (csr_mtvec[1:0] == 2'b01)) begin
                         int_addr_o <= {csr_mtvec[31:2], 2'b00} + ((cause[3:0]) << 2);
                     end else begin
-                        int_addr_o <= csr_mtvec;
+                        int_addr_o <= {csr_mtvec[31:2], 2'b00};
                     end
                 end
             end else begin
@@ -49,6 +49,14 @@ module clint_swi #(
     reg [31:0] mtimecmp_lo, mtimecmp_hi;
     reg [31:0] mtime_lo, mtime_hi;
 
+    // mtime每拍步进值，仿真时测试平台可在WFI休眠期间一次性跳过多个周期
+`ifndef SYNTHESIS
+    reg  [31:0] sim_time_skip = 32'h0;
+    wire [63:0] mtime_step = {32'h0, sim_time_skip} + 64'd1;
+`else
+    wire [63:0] mtime_step = 64'd1;
+`endif
+
     // === 定时器中断和软件中断信号 ===
     assign timer_irq     = ({mtime_hi, mtime_lo} >= {mtimecmp_hi, mtimecmp_lo});
     assign soft_irq      = msip;
@@ -165,7 +173,7 @@ module clint_swi #(
         end else begin
 
             // mtime自增
-            {mtime_hi, mtime_lo} <= {mtime_hi, mtime_lo} + 64'd1;
+            {mtime_hi, mtime_lo} <= {mtime_hi, mtime_lo} + mtime_step;
 
             if (S_AXI_WVALID) begin
                 case (mem_waddr)
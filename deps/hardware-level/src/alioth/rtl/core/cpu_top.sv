@@ -31,6 +31,19 @@ module cpu_top (
     input  wire                             rst_n,
     input  wire [                      7:0] irq_sources,      // 中断ID
 
+    // ITCM直连取指端口
+    output wire [`INST_ADDR_WIDTH-1:0]      itcm_fetch_addr_o,
+    input  wire [`INST_DATA_WIDTH-1:0]      itcm_fetch_data_i,
+    input  wire [`INST_DATA_WIDTH-1:0]      itcm_fetch_data1_i,  // 下一字，双发射与指令融合使用
+
+    // DTCM直连访存端口
+    output wire [`BUS_ADDR_WIDTH-1:0]       dtcm_raddr_o,
+    input  wire [`BUS_DATA_WIDTH-1:0]       dtcm_rdata_i,
+    output wire                             dtcm_we_o,
+    output wire [                      3:0] dtcm_wmask_o,
+    output wire [`BUS_ADDR_WIDTH-1:0]       dtcm_waddr_o,
+    output wire [`BUS_DATA_WIDTH-1:0]       dtcm_wdata_o,
+
     // M0 AXI接口 - IFU指令获取
     output wire [`BUS_ID_WIDTH-1:0]         M0_AXI_ARID,
     output wire [`INST_ADDR_WIDTH-1:0]      M0_AXI_ARADDR,
@@ -151,6 +164,7 @@ module cpu_top (
     wire [`INST_ADDR_WIDTH-1:0] if_inst_addr_o;
     wire [`INST_DATA_WIDTH-1:0] if_int_flag_o;
     wire if_is_pred_branch_o;  // 添加预测分支信号线
+    wire [`BPU_META_WIDTH-1:0] if_bpu_meta_o;  // 分支预测元数据
 
     // id模块输出信号
     wire [`INST_ADDR_WIDTH-1:0] idu_inst_addr_o;
@@ -164,6 +178,7 @@ module cpu_top (
     wire [31:0] idu_dec_imm_o;
     wire [`DECINFO_WIDTH-1:0] idu_dec_info_bus_o;
     wire idu_is_pred_branch_o;  // 添加预测分支指令标志输出
+    wire [`BPU_META_WIDTH-1:0] idu_bpu_meta_o;
     // 新增rs1/rs2读使能信号
     wire idu_rs1_re_o;
     wire idu_rs2_re_o;
@@ -232,6 +247,15 @@ module cpu_top (
     wire [`REG_DATA_WIDTH-1:0] csr_clint_csr_mepc;
     wire [`REG_DATA_WIDTH-1:0] csr_clint_csr_mstatus;
     wire [`REG_DATA_WIDTH-1:0] csr_clint_csr_mie;
+    wire [`REG_DATA_WIDTH-1:0] csr_clint_csr_mfiret;
+
+    // 快速中断：PLIC向量与GPR影子组控制
+    wire [`INST_ADDR_WIDTH-1:0] plic_irq_vec;
+    wire [`REG_DATA_WIDTH-1:0] plic_irq_arg;
+    wire clint_gpr_bank_o;
+    wire clint_gpr_bank_load_o;
+    wire [`REG_DATA_WIDTH-1:0] clint_gpr_bank_ra_o;
+    wire [`REG_DATA_WIDTH-1:0] clint_gpr_bank_a0_o;
 
     // ctrl模块输出信号
     wire [`CU_BUS_WIDTH-1:0] ctrl_stall_flag_o;
@@ -245,6 +269,7 @@ module cpu_top (
     wire [`REG_DATA_WIDTH-1:0] clint_data_o;
     wire [`INST_ADDR_WIDTH-1:0] clint_int_addr_o;
     wire clint_int_assert_o;
+    wire clint_sleep_o;
     wire clint_int_jump_o;  // 添加中断跳转信号
     wire clint_req_valid_o;  // 添加中断请求有效信号
 
@@ -253,6 +278,8 @@ module cpu_top (
     wire exu_mem_stall_o;
     wire exu_mem_store_busy_o;
     wire dispatch_stall_flag_o;
+    wire dispatch_early_jump_flag_o;  // 分发级提前判定的分支重定向
+    wire [`INST_ADDR_WIDTH-1:0] dispatch_early_jump_addr_o;
     wire dispatch_long_inst_atom_lock_o;
     wire [`COMMIT_ID_WIDTH-1:0] hdu_long_inst_id_o;
     wire [`COMMIT_ID_WIDTH-1:0] wbu_commit_id_o;
@@ -264,10 +291,51 @@ module cpu_top (
     wire atom_opt_busy;
     // 添加缺少的信号声明
     wire wbu_commit_valid_o;
+    wire wbu_commit2_valid_o;  // LSU独立写端口提交
+    wire [`COMMIT_ID_WIDTH-1:0] wbu_commit2_id_o;
+    wire [`REG_DATA_WIDTH-1:0] wbu_reg2_wdata_o;
+    wire wbu_reg2_we_o;
+    wire [`REG_ADDR_WIDTH-1:0] wbu_reg2_waddr_o;
     wire [`COMMIT_ID_WIDTH-1:0] dispatch_commit_id_o;
 
     // inst_valid相关信号定义
     wire if_inst_valid_o;  // IFU输出指令有效信号
+
+    // 压缩指令标志，随指令流水传递
+    wire if_inst_c_o;
+    wire idu_inst_c_o;
+    wire dispatch_inst_c_o;
+
+    // 双发射与指令融合相关信号
+    wire [`INST_DATA_WIDTH-1:0] if_inst1_o;
+    wire if_inst1_valid_o;
+    wire if_inst1_fuse_o;
+    wire idu_fused_o;
+    wire dispatch_fused_o;
+    wire idu_dual_valid_o;
+    wire idu_dual_reg_we_o;
+    wire [`REG_ADDR_WIDTH-1:0] idu_dual_reg_waddr_o;
+    wire [`REG_ADDR_WIDTH-1:0] idu_dual_reg1_raddr_o;
+    wire [`REG_ADDR_WIDTH-1:0] idu_dual_reg2_raddr_o;
+    wire idu_dual_rs1_re_o;
+    wire idu_dual_rs2_re_o;
+    wire [31:0] idu_dual_dec_imm_o;
+    wire [`DECINFO_WIDTH-1:0] idu_dual_dec_info_bus_o;
+    wire [`REG_DATA_WIDTH-1:0] regs_rdata3_o;
+    wire [`REG_DATA_WIDTH-1:0] regs_rdata4_o;
+    wire dispatch_dual_valid_o;
+    wire dispatch_dual_req_alu;
+    wire [31:0] dispatch_dual_alu_op1;
+    wire [31:0] dispatch_dual_alu_op2;
+    wire [`ALU_OP_WIDTH-1:0] dispatch_dual_alu_op_info;
+    wire dispatch_dual_reg_we;
+    wire [`REG_ADDR_WIDTH-1:0] dispatch_dual_reg_waddr;
+    wire [`REG_DATA_WIDTH-1:0] exu_dual_reg_wdata_o;
+    wire exu_dual_reg_we_o;
+    wire [`REG_ADDR_WIDTH-1:0] exu_dual_reg_waddr_o;
+    wire [`REG_DATA_WIDTH-1:0] wbu_reg3_wdata_o;
+    wire wbu_reg3_we_o;
+    wire [`REG_ADDR_WIDTH-1:0] wbu_reg3_waddr_o;
     wire idu_inst_valid_o;  // IDU输出指令有效信号
     wire dispatch_inst_valid_o;  // dispatch输出流水线指令有效信号
     wire idu_illegal_inst_o;  // IDU输出非法指令信号
@@ -354,10 +422,12 @@ module cpu_top (
     wire dispatch_mem_op_lhu;
     wire dispatch_mem_op_load;
     wire dispatch_mem_op_store;
+    wire dispatch_mem_op_amo;
+    wire [4:0] dispatch_mem_amo_op;
     wire [`COMMIT_ID_WIDTH-1:0] dispatch_mem_commit_id;
     wire [31:0] dispatch_mem_addr;
     wire [31:0] dispatch_mem_wdata;
-    wire [3:0] dispatch_mem_wmask;
+    wire [7:0] dispatch_mem_wmask;
 
     // dispatch to SYS
     wire dispatch_sys_op_nop;
@@ -366,12 +436,19 @@ module cpu_top (
     wire dispatch_sys_op_ebreak;
     wire dispatch_sys_op_fence;
     wire dispatch_sys_op_dret;
+    wire dispatch_sys_op_fencei;
 
     wire [31:0] dispatch_rs1_rdata;
     wire [31:0] dispatch_rs2_rdata;
 
     // 给dispatch和HDU的译码信息
     wire dis_is_pred_branch_o;
+    wire [`BPU_META_WIDTH-1:0] dis_bpu_meta_o;
+    // 分支执行结果，用于训练分支预测器
+    wire exu_bjp_taken_o;
+    wire [`INST_ADDR_WIDTH-1:0] exu_bjp_target_o;
+    wire bpu_upd_valid = dispatch_req_bjp & ~exu_stall_flag_o;
+    wire bpu_upd_cond = ~dispatch_bjp_op_jal & ~dispatch_bjp_op_jalr;
     wire ext_int_req;
     wire inst_valid = (ctrl_stall_flag_o == 0);
     wire inst_exu_valid = (ctrl_stall_flag_o[`CU_STALL_DISPATCH] == 0) && 
@@ -381,6 +458,9 @@ module cpu_top (
     // wire is_mem_long_inst = ((idu_dec_info_bus_o[`DECINFO_GRP_BUS] == `DECINFO_GRP_MEM) && idu_dec_info_bus_o[`DECINFO_MEM_OP_LOAD]);
     // wire is_long_inst = is_muldiv_long_inst | is_mem_long_inst;
     wire jump_addr_valid = dispatch_bjp_op_jal || exu_jump_flag_o;
+    // 执行级WFI，EXU无暂停时进入休眠
+    wire wfi_exec = (`WFI_SLEEP != 0) && inst_clint_valid && !exu_stall_flag_o &&
+                    (dispatch_inst_o == `INST_WFI);
 
     // IFU模块例化
     ifu u_ifu (
@@ -389,11 +469,31 @@ module cpu_top (
         .jump_flag_i      (ctrl_jump_flag_o),
         .jump_addr_i      (ctrl_jump_addr_o),
         .stall_flag_i     (ctrl_stall_flag_o),
+        .fence_i_i        (dispatch_sys_op_fencei),  // fence.i失效指令缓存
         .inst_o           (if_inst_o),
         .inst_addr_o      (if_inst_addr_o),
         .read_resp_error_o(ifu_read_resp_error_o),
         .is_pred_branch_o (if_is_pred_branch_o),    // 连接预测分支信号输出
+        .bpu_meta_o       (if_bpu_meta_o),
         .inst_valid_o     (if_inst_valid_o),        // 添加指令有效信号输出
+        .inst1_o          (if_inst1_o),
+        .inst1_valid_o    (if_inst1_valid_o),
+        .inst1_fuse_o     (if_inst1_fuse_o),
+        .inst_c_o         (if_inst_c_o),
+
+        // 分支预测更新
+        .bpu_upd_valid_i  (bpu_upd_valid),
+        .bpu_upd_pc_i     (dispatch_inst_addr_o),
+        .bpu_upd_cond_i   (bpu_upd_cond),
+        .bpu_upd_jalr_i   (dispatch_bjp_op_jalr),
+        .bpu_upd_taken_i  (exu_bjp_taken_o),
+        .bpu_upd_target_i (exu_bjp_target_o),
+        .bpu_upd_bht_idx_i(dis_bpu_meta_o[`BPU_META_IDX]),
+
+        // ITCM直连取指
+        .itcm_fetch_addr_o(itcm_fetch_addr_o),
+        .itcm_fetch_data_i(itcm_fetch_data_i),
+        .itcm_fetch_data1_i(itcm_fetch_data1_i),
 
         // AXI接口
         .M_AXI_ARID   (M0_AXI_ARID),
@@ -424,10 +524,13 @@ module cpu_top (
         .jump_flag_i       (exu_jump_flag_o),
         .jump_addr_i       (exu_jump_addr_o),
         .atom_opt_busy_i   (atom_opt_busy),
+        .early_jump_flag_i (dispatch_early_jump_flag_o),
+        .early_jump_addr_i (dispatch_early_jump_addr_o),
         .stall_flag_ex_i   (exu_stall_flag_o),
         .flush_flag_clint_i(clint_int_assert_o),     // 添加连接到clint的flush信号
         .stall_flag_hdu_i  (dispatch_stall_flag_o),  // 修改为从dispatch获取HDU暂停信号
         .stall_flag_irs_i  (idu_irs_stall_flag_o),   // 添加连接到IDU的IRS暂停信号
+        .sleep_i           (clint_sleep_o),          // WFI休眠
         .stall_flag_o      (ctrl_stall_flag_o),
         .jump_flag_o       (ctrl_jump_flag_o),
         .jump_addr_o       (ctrl_jump_addr_o)
@@ -443,7 +546,21 @@ module cpu_top (
         .raddr1_i(idu_reg1_raddr_o),
         .rdata1_o(regs_rdata1_o),
         .raddr2_i(idu_reg2_raddr_o),
-        .rdata2_o(regs_rdata2_o)
+        .rdata2_o(regs_rdata2_o),
+        .we2_i   (wbu_reg2_we_o),
+        .waddr2_i(wbu_reg2_waddr_o),
+        .wdata2_i(wbu_reg2_wdata_o),
+        .we3_i   (wbu_reg3_we_o),
+        .waddr3_i(wbu_reg3_waddr_o),
+        .wdata3_i(wbu_reg3_wdata_o),
+        .bank_sel_i (clint_gpr_bank_o),
+        .bank_load_i(clint_gpr_bank_load_o),
+        .bank_ra_i  (clint_gpr_bank_ra_o),
+        .bank_a0_i  (clint_gpr_bank_a0_o),
+        .raddr3_i(idu_dual_reg1_raddr_o),
+        .rdata3_o(regs_rdata3_o),
+        .raddr4_i(idu_dual_reg2_raddr_o),
+        .rdata4_o(regs_rdata4_o)
     );
 
     // csr模块例化 - 修改为从dispatch pipe获取CSR地址
@@ -455,6 +572,7 @@ module cpu_top (
         .waddr_i          (wbu_csr_waddr_o),
         .data_i           (wbu_csr_wdata_o),
         .inst_valid_i     (inst_exu_valid),
+        .inst_dual_i      (inst_exu_valid && (idu_dual_valid_o || idu_fused_o)),
         .data_o           (csr_data_o),
         .clint_we_i       (clint_we_o),
         .clint_raddr_i    (clint_raddr_o),
@@ -464,7 +582,8 @@ module cpu_top (
         .clint_csr_mtvec  (csr_clint_csr_mtvec),
         .clint_csr_mepc   (csr_clint_csr_mepc),
         .clint_csr_mstatus(csr_clint_csr_mstatus),
-        .clint_csr_mie    (csr_clint_csr_mie)
+        .clint_csr_mie    (csr_clint_csr_mie),
+        .clint_csr_mfiret (csr_clint_csr_mfiret)
     );
 
     // idu模块例化 - 更新接口，移除长指令ID相关接口
@@ -475,7 +594,12 @@ module cpu_top (
         .inst_addr_i     (if_inst_addr_o),
         .stall_flag_i    (ctrl_stall_flag_o),
         .is_pred_branch_i(if_is_pred_branch_o),  // 连接预测分支信号输入
+        .bpu_meta_i      (if_bpu_meta_o),
         .inst_valid_i    (if_inst_valid_o),      // 添加指令有效信号输入
+        .inst1_i         (if_inst1_o),
+        .inst1_valid_i   (if_inst1_valid_o),
+        .inst1_fuse_i    (if_inst1_fuse_o),
+        .inst_c_i        (if_inst_c_o),
 
         .csr_raddr_o     (idu_csr_raddr_o),
         .inst_addr_o     (idu_inst_addr_o),
@@ -488,6 +612,7 @@ module cpu_top (
         .dec_imm_o       (idu_dec_imm_o),
         .dec_info_bus_o  (idu_dec_info_bus_o),
         .is_pred_branch_o(idu_is_pred_branch_o),  // 连接预测分支信号输出
+        .bpu_meta_o      (idu_bpu_meta_o),
         .inst_valid_o    (idu_inst_valid_o),      // 添加指令有效信号输出
         .illegal_inst_o  (idu_illegal_inst_o),
         .inst_o          (idu_inst_o),            // 添加非法指令值输出
@@ -495,7 +620,20 @@ module cpu_top (
         .rs1_re_o        (idu_rs1_re_o),
         .rs2_re_o        (idu_rs2_re_o),
         .ex_info_bus_o   (idu_ex_info_bus_o),     // 新增
-        .irs_stall_flag_o(idu_irs_stall_flag_o)
+        .irs_stall_flag_o(idu_irs_stall_flag_o),
+        .fused_o         (idu_fused_o),
+        .inst_c_o        (idu_inst_c_o),
+
+        // 双发射第二条指令译码输出
+        .dual_valid_o       (idu_dual_valid_o),
+        .dual_reg_we_o      (idu_dual_reg_we_o),
+        .dual_reg_waddr_o   (idu_dual_reg_waddr_o),
+        .dual_reg1_raddr_o  (idu_dual_reg1_raddr_o),
+        .dual_reg2_raddr_o  (idu_dual_reg2_raddr_o),
+        .dual_rs1_re_o      (idu_dual_rs1_re_o),
+        .dual_rs2_re_o      (idu_dual_rs2_re_o),
+        .dual_dec_imm_o     (idu_dual_dec_imm_o),
+        .dual_dec_info_bus_o(idu_dual_dec_info_bus_o)
     );
 
     // 添加dispatch模块例化 - 修改增加新的接口
@@ -514,6 +652,7 @@ module cpu_top (
         .rs1_rdata_i     (regs_rdata1_o),
         .rs2_rdata_i     (regs_rdata2_o),
         .is_pred_branch_i(idu_is_pred_branch_o), // 连接预测分支信号输入
+        .bpu_meta_i      (idu_bpu_meta_o),
 
         // 寄存器访问信息 - 用于HDU冒险检测
         .reg_waddr_i (idu_reg_waddr_o),
@@ -537,6 +676,33 @@ module cpu_top (
         // 写回阶段提交信号
         .commit_valid_i(wbu_commit_valid_o),
         .commit_id_i   (wbu_commit_id_o),
+        .commit2_valid_i(wbu_commit2_valid_o),
+        .commit2_id_i   (wbu_commit2_id_o),
+
+        .lsu_reg_we_i   (exu_lsu_reg_we_o),
+        .lsu_reg_waddr_i(exu_lsu_reg_waddr_o),
+        .lsu_reg_wdata_i(exu_lsu_reg_wdata_o),
+        .lsu_commit_id_i(exu_lsu_commit_id_o),
+
+        .fused_i(idu_fused_o),
+        .inst_c_i(idu_inst_c_o),
+
+        // 双发射第二条指令
+        .dual_valid_i       (idu_dual_valid_o),
+        .dual_reg_we_i      (idu_dual_reg_we_o),
+        .dual_reg_waddr_i   (idu_dual_reg_waddr_o),
+        .dual_reg1_raddr_i  (idu_dual_reg1_raddr_o),
+        .dual_reg2_raddr_i  (idu_dual_reg2_raddr_o),
+        .dual_rs1_re_i      (idu_dual_rs1_re_o),
+        .dual_rs2_re_i      (idu_dual_rs2_re_o),
+        .dual_dec_imm_i     (idu_dual_dec_imm_o),
+        .dual_dec_info_bus_i(idu_dual_dec_info_bus_o),
+        .dual_rs1_rdata_i   (regs_rdata3_o),
+        .dual_rs2_rdata_i   (regs_rdata4_o),
+
+        // 分支提前重定向
+        .early_jump_flag_o(dispatch_early_jump_flag_o),
+        .early_jump_addr_o(dispatch_early_jump_addr_o),
 
         // HDU输出信号
         .hazard_stall_o       (dispatch_stall_flag_o),
@@ -618,6 +784,8 @@ module cpu_top (
         .mem_op_lhu_o      (dispatch_mem_op_lhu),
         .mem_op_load_o     (dispatch_mem_op_load),
         .mem_op_store_o    (dispatch_mem_op_store),
+        .mem_op_amo_o      (dispatch_mem_op_amo),
+        .mem_amo_op_o      (dispatch_mem_amo_op),
         .mem_commit_id_o   (dispatch_mem_commit_id),
         .mem_addr_o        (dispatch_mem_addr),
         .mem_wmask_o       (dispatch_mem_wmask),
@@ -628,11 +796,22 @@ module cpu_top (
         .sys_op_ebreak_o   (dispatch_sys_op_ebreak),
         .sys_op_fence_o    (dispatch_sys_op_fence),
         .sys_op_dret_o     (dispatch_sys_op_dret),
+        .sys_op_fencei_o   (dispatch_sys_op_fencei),
         .is_pred_branch_o  (dis_is_pred_branch_o),         // 连接预测分支信号输出
+        .bpu_meta_o        (dis_bpu_meta_o),
         .misaligned_load_o (dispatch_misaligned_load_o),
         .misaligned_store_o(dispatch_misaligned_store_o),
-        .illegal_inst_o    (dispatch_illegal_inst_o)       // 连接IDU的非法指令输出
-
+        .illegal_inst_o    (dispatch_illegal_inst_o),      // 连接IDU的非法指令输出
+
+        .pipe_fused_o      (dispatch_fused_o),
+        .pipe_inst_c_o     (dispatch_inst_c_o),
+        .pipe_dual_valid_o (dispatch_dual_valid_o),
+        .dual_req_alu_o    (dispatch_dual_req_alu),
+        .dual_alu_op1_o    (dispatch_dual_alu_op1),
+        .dual_alu_op2_o    (dispatch_dual_alu_op2),
+        .dual_alu_op_info_o(dispatch_dual_alu_op_info),
+        .dual_reg_we_o     (dispatch_dual_reg_we),
+        .dual_reg_waddr_o  (dispatch_dual_reg_waddr)
     );
 
     // exu模块例化 - 修改commit_id相关连接
@@ -651,6 +830,7 @@ module cpu_top (
         .int_jump_i(clint_int_jump_o),  // 添加中断跳转信号输入
         .int_addr_i(clint_int_addr_o),
         .is_pred_branch_i(dis_is_pred_branch_o),  // 连接预测分支信号输入
+        .pred_addr_i(dis_bpu_meta_o[`BPU_META_ADDR]),  // 预测的跳转目标
 
         // 从dispatch获取长指令ID
         .commit_id_i(dispatch_commit_id_o),
@@ -674,6 +854,13 @@ module cpu_top (
         .alu_pass_op1_i(dispatch_alu_pass_op1),  // 新增：ALU旁路信号
         .alu_pass_op2_i(dispatch_alu_pass_op2),  // 新增：ALU旁路信号
 
+        .dual_req_alu_i    (dispatch_dual_req_alu),
+        .dual_alu_op1_i    (dispatch_dual_alu_op1),
+        .dual_alu_op2_i    (dispatch_dual_alu_op2),
+        .dual_alu_op_info_i(dispatch_dual_alu_op_info),
+        .dual_reg_we_i     (dispatch_dual_reg_we),
+        .dual_reg_waddr_i  (dispatch_dual_reg_waddr),
+
         .req_bjp_i            (dispatch_req_bjp),
         .bjp_op_jal_i         (dispatch_bjp_op_jal),
         .bjp_op_beq_i         (dispatch_bjp_op_beq),
@@ -726,6 +913,8 @@ module cpu_top (
         .mem_op_lhu_i   (dispatch_mem_op_lhu),
         .mem_op_load_i  (dispatch_mem_op_load),
         .mem_op_store_i (dispatch_mem_op_store),
+        .mem_op_amo_i   (dispatch_mem_op_amo),
+        .mem_amo_op_i   (dispatch_mem_amo_op),
         .mem_commit_id_i(dispatch_mem_commit_id),
         .mem_addr_i     (dispatch_mem_addr),
         .mem_wdata_i    (dispatch_mem_wdata),
@@ -741,11 +930,22 @@ module cpu_top (
         .mem_stall_o     (exu_mem_stall_o),
         .mem_store_busy_o(exu_mem_store_busy_o),
 
+        .dtcm_raddr_o(dtcm_raddr_o),
+        .dtcm_rdata_i(dtcm_rdata_i),
+        .dtcm_we_o   (dtcm_we_o),
+        .dtcm_wmask_o(dtcm_wmask_o),
+        .dtcm_waddr_o(dtcm_waddr_o),
+        .dtcm_wdata_o(dtcm_wdata_o),
+
         .alu_reg_wdata_o(exu_alu_reg_wdata_o),
         .alu_reg_we_o   (exu_alu_reg_we_o),
         .alu_reg_waddr_o(exu_alu_reg_waddr_o),
         .alu_commit_id_o(exu_alu_commit_id_o),
 
+        .dual_reg_wdata_o(exu_dual_reg_wdata_o),
+        .dual_reg_we_o   (exu_dual_reg_we_o),
+        .dual_reg_waddr_o(exu_dual_reg_waddr_o),
+
         // MUL/DIV结果输出
         .mul_reg_wdata_o(exu_mul_reg_wdata_o),
         .mul_reg_we_o   (exu_mul_reg_we_o),
@@ -782,6 +982,8 @@ module cpu_top (
         .exu_op_mret_o  (exu_mret_o),
 
         .misaligned_fetch_o(misaligned_fetch_o),  // 新增misaligned fetch信号输出
+        .bjp_taken_o(exu_bjp_taken_o),
+        .bjp_target_o(exu_bjp_target_o),
         // 添加AXI接口连接 - 保持不变
         .M_AXI_AWID        (M1_AXI_AWID),
         .M_AXI_AWADDR      (M1_AXI_AWADDR),
@@ -866,14 +1068,28 @@ module cpu_top (
         .lsu_reg_waddr_i(exu_lsu_reg_waddr_o),
         .lsu_commit_id_i(exu_lsu_commit_id_o),  // 直接使用全宽度
 
+        .dual_reg_wdata_i(exu_dual_reg_wdata_o),
+        .dual_reg_we_i   (exu_dual_reg_we_o),
+        .dual_reg_waddr_i(exu_dual_reg_waddr_o),
+
         // 新增长指令完成输出
         .commit_valid_o(wbu_commit_valid_o),
         .commit_id_o   (wbu_commit_id_o),
+        .commit2_valid_o(wbu_commit2_valid_o),
+        .commit2_id_o   (wbu_commit2_id_o),
 
         .reg_wdata_o(wbu_reg_wdata_o),
         .reg_we_o   (wbu_reg_we_o),
         .reg_waddr_o(wbu_reg_waddr_o),
 
+        .reg2_wdata_o(wbu_reg2_wdata_o),
+        .reg2_we_o   (wbu_reg2_we_o),
+        .reg2_waddr_o(wbu_reg2_waddr_o),
+
+        .reg3_wdata_o(wbu_reg3_wdata_o),
+        .reg3_we_o   (wbu_reg3_we_o),
+        .reg3_waddr_o(wbu_reg3_waddr_o),
+
         .csr_wdata_o(wbu_csr_wdata_o),
         .csr_we_o   (wbu_csr_we_o),
         .csr_waddr_o(wbu_csr_waddr_o)
@@ -886,6 +1102,8 @@ module cpu_top (
         .inst_addr_i       (dispatch_inst_addr_o),
         .inst_data_i       (dispatch_inst_o),
         .inst_valid_i      (inst_clint_valid),
+        .inst_dual_i       (dispatch_dual_valid_o || dispatch_fused_o),
+        .inst_c_i          (dispatch_inst_c_o),
         .jump_flag_i       (jump_addr_valid),
         .jump_addr_i       (exu_jump_addr_o),
         .stall_flag_i      (ctrl_stall_flag_o),
@@ -899,11 +1117,20 @@ module cpu_top (
         .misaligned_fetch_i(misaligned_fetch_o),           // misaligned fetch信号输入
 
         .exu_stall_i      (exu_stall_flag_o),
+        .wfi_i            (wfi_exec),
+        .sleep_o          (clint_sleep_o),
         .data_i           (csr_clint_data_o),
         .csr_mtvec        (csr_clint_csr_mtvec),
         .csr_mepc         (csr_clint_csr_mepc),
         .csr_mstatus      (csr_clint_csr_mstatus),
         .csr_mie          (csr_clint_csr_mie),
+        .csr_mfiret       (csr_clint_csr_mfiret),
+        .plic_vec_i       (plic_irq_vec),
+        .plic_arg_i       (plic_irq_arg),
+        .gpr_bank_o       (clint_gpr_bank_o),
+        .gpr_bank_load_o  (clint_gpr_bank_load_o),
+        .gpr_bank_ra_o    (clint_gpr_bank_ra_o),
+        .gpr_bank_a0_o    (clint_gpr_bank_a0_o),
         .we_o             (clint_we_o),
         .waddr_o          (clint_waddr_o),
         .raddr_o          (clint_raddr_o),
@@ -939,6 +1166,14 @@ module cpu_top (
         .S_AXI_RREADY (OM1_AXI_RREADY)
     );
 
+`ifndef SYNTHESIS
+    // 仿真专用中断注入口，由tb_top中的随机中断注入器层次化驱动，复位值为0时不影响原有中断源
+    reg  [`PLIC_NUM_SOURCES-1:0] sim_irq_inject = {`PLIC_NUM_SOURCES{1'b0}};
+    wire [`PLIC_NUM_SOURCES-1:0] plic_irq_sources = irq_sources | sim_irq_inject;
+`else
+    wire [`PLIC_NUM_SOURCES-1:0] plic_irq_sources = irq_sources;
+`endif
+
     // plic_top模块例化 - PLIC外部中断控制器
     plic_top #(
         .C_S_AXI_DATA_WIDTH(`BUS_DATA_WIDTH),
@@ -965,8 +1200,10 @@ module cpu_top (
         .S_AXI_RRESP  (OM2_AXI_RRESP),
         .S_AXI_RVALID (OM2_AXI_RVALID),
         .S_AXI_RREADY (OM2_AXI_RREADY),
-        .irq_sources  (irq_sources),
-        .irq_valid    (ext_int_req)
+        .irq_sources  (plic_irq_sources),
+        .irq_valid    (ext_int_req),
+        .irq_vec_o    (plic_irq_vec),
+        .irq_arg_o    (plic_irq_arg)
     );
 
     // 定义原子操作忙信号 - 使用dispatch提供的HDU原子锁信号
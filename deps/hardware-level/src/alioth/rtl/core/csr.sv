@@ -43,6 +43,7 @@ module csr (
     input wire [`REG_DATA_WIDTH-1:0] clint_data_i,   // clint模块写寄存器数据
 
     input wire inst_valid_i,  // 指令有效信号
+    input wire inst_dual_i,   // 本拍双发射或融合指令，完成两条指令
 
     // to clint
     output wire [`REG_DATA_WIDTH-1:0] clint_data_o,       // clint模块读寄存器数据
@@ -50,6 +51,7 @@ module csr (
     output wire [`REG_DATA_WIDTH-1:0] clint_csr_mepc,     // mepc
     output wire [`REG_DATA_WIDTH-1:0] clint_csr_mstatus,  // mstatus
     output wire [`REG_DATA_WIDTH-1:0] clint_csr_mie,
+    output wire [`REG_DATA_WIDTH-1:0] clint_csr_mfiret,   // 快速中断返回地址
 
     // to ex
     output wire [`REG_DATA_WIDTH-1:0] data_o  // ex模块读寄存器数据
@@ -66,6 +68,7 @@ module csr (
     wire [`REG_DATA_WIDTH-1:0] mie;
     wire [`REG_DATA_WIDTH-1:0] mstatus;
     wire [`REG_DATA_WIDTH-1:0] mscratch;
+    wire [`REG_DATA_WIDTH-1:0] mfiret;  // 快速中断返回地址
 
     // 机器模式CSR寄存器
     wire [`REG_DATA_WIDTH-1:0] mvendorid;  // 供应商ID寄存器
@@ -130,6 +133,7 @@ module csr (
     wire [`REG_DATA_WIDTH-1:0] mie_next;
     wire [`REG_DATA_WIDTH-1:0] mstatus_next;
     wire [`REG_DATA_WIDTH-1:0] mscratch_next;
+    wire [`REG_DATA_WIDTH-1:0] mfiret_next;
     wire [`REG_DATA_WIDTH-1:0] mcycle_next;
     wire [`REG_DATA_WIDTH-1:0] mcycleh_next;
 
@@ -168,6 +172,7 @@ module csr (
     wire mie_we;
     wire mstatus_we;
     wire mscratch_we;
+    wire mfiret_we;
     wire mvendorid_we;
     wire marchid_we;
     wire mimpid_we;
@@ -220,6 +225,7 @@ module csr (
     assign clint_csr_mepc = mepc;
     assign clint_csr_mstatus = mstatus;
     assign clint_csr_mie = mie;
+    assign clint_csr_mfiret = mfiret;
 
     // mcycle counter
     // 复位撤销后就一直计数，但现在还要考虑写操作
@@ -228,13 +234,22 @@ module csr (
     assign mcycleh_we = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MCYCLEH) || 
                         (clint_we_i == `WriteEnable && clint_waddr_i[11:0] == `CSR_MCYCLEH);
 
+    // 计数器每拍步进值，仿真时测试平台可在WFI休眠期间一次性跳过多个周期
+`ifndef SYNTHESIS
+    reg  [`REG_DATA_WIDTH-1:0] sim_cycle_skip = '0;
+    wire [  `REG_DATA_WIDTH:0] cnt_step = {1'b0, sim_cycle_skip} + 1'b1;
+`else
+    wire [  `REG_DATA_WIDTH:0] cnt_step = 'd1;
+`endif
+
     // 检测低32位溢出产生进位
+    wire [`REG_DATA_WIDTH:0] mcycle_sum = {1'b0, mcycle} + cnt_step;
     wire mcycle_carry;
-    assign mcycle_carry = (mcycle == 32'hffffffff) ? 1'b1 : 1'b0;
+    assign mcycle_carry = mcycle_sum[`REG_DATA_WIDTH];
 
     // 低32位寄存器更新
     assign mcycle_next = mcycle_we ? (we_i == `WriteEnable ? data_i : clint_data_i) : 
-                                    (inhibit_cy ? mcycle : mcycle + 1'b1);
+                                    (inhibit_cy ? mcycle : mcycle_sum[`REG_DATA_WIDTH-1:0]);
 
     // 高32位寄存器更新，考虑写操作和进位
     assign mcycleh_next = mcycleh_we
@@ -247,10 +262,11 @@ module csr (
     assign cycleh_we = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_CYCLEH) ||
                        (clint_we_i == `WriteEnable && clint_waddr_i[11:0] == `CSR_CYCLEH);
 
+    wire [`REG_DATA_WIDTH:0] cycle_sum = {1'b0, cycle} + cnt_step;
     wire cycle_carry;
-    assign cycle_carry = (cycle == 32'hffffffff) ? 1'b1 : 1'b0;
+    assign cycle_carry = cycle_sum[`REG_DATA_WIDTH];
 
-    assign cycle_next = cycle_we ? (we_i == `WriteEnable ? data_i : clint_data_i) : (inhibit_cy ? cycle : cycle + 1'b1);
+    assign cycle_next = cycle_we ? (we_i == `WriteEnable ? data_i : clint_data_i) : (inhibit_cy ? cycle : cycle_sum[`REG_DATA_WIDTH-1:0]);
 
     assign cycleh_next = cycleh_we
         ? ((we_i == `WriteEnable ? data_i : clint_data_i) + (cycle_carry && !inhibit_cy ? 1'b1 : 1'b0))
@@ -262,13 +278,17 @@ module csr (
     assign minstreth_we = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MINSTRETH) || 
                           (clint_we_i == `WriteEnable && clint_waddr_i[11:0] == `CSR_MINSTRETH);
 
+    // 本拍完成的指令数，双发射或融合指令为2
+    wire [1:0] minstret_inc = inst_dual_i ? 2'd2 : {1'b0, inst_valid_i};
+    wire [`REG_DATA_WIDTH:0] minstret_sum = {1'b0, minstret} + minstret_inc;
+
     // 检测低32位溢出产生进位
     wire minstret_carry;
-    assign minstret_carry = inst_valid_i && (minstret == 32'hffffffff) ? 1'b1 : 1'b0;
+    assign minstret_carry = minstret_sum[`REG_DATA_WIDTH];
 
     // 低32位寄存器更新
     assign minstret_next = minstret_we ? (we_i == `WriteEnable ? data_i : clint_data_i) :
-                                        ((inst_valid_i && !inhibit_ir) ? minstret + 1'b1 : minstret);
+                                        (!inhibit_ir ? minstret_sum[`REG_DATA_WIDTH-1:0] : minstret);
 
     // 高32位寄存器更新，考虑写操作和进位
     assign minstreth_next = minstreth_we
@@ -276,11 +296,12 @@ module csr (
         : (minstret_carry && !inhibit_ir ? minstreth + 1'b1 : minstreth);
 
     // 实时时钟，每个周期自增
+    wire [`REG_DATA_WIDTH:0] time_sum = {1'b0, time_val} + cnt_step;
     wire time_carry;
-    assign time_carry = (time_val == 32'hffffffff) ? 1'b1 : 1'b0;
+    assign time_carry = time_sum[`REG_DATA_WIDTH];
 
     // 时钟低32位更新
-    assign time_next  = inhibit_tm ? time_val : time_val + 1'b1;
+    assign time_next  = inhibit_tm ? time_val : time_sum[`REG_DATA_WIDTH-1:0];
 
     // 时钟高32位更新，考虑进位
     assign timeh_next = inhibit_tm ? timeh_val : (timeh_val + (time_carry ? 1'b1 : 1'b0));
@@ -386,6 +407,10 @@ module csr (
                          (clint_we_i == `WriteEnable && clint_waddr_i[11:0] == `CSR_MSCRATCH);
     assign mscratch_next = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MSCRATCH) ? data_i : clint_data_i;
 
+    assign mfiret_we = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MFIRET) || 
+                       (clint_we_i == `WriteEnable && clint_waddr_i[11:0] == `CSR_MFIRET);
+    assign mfiret_next = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MFIRET) ? data_i : clint_data_i;
+
     assign mvendorid_we = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MVENDORID) || 
                           (clint_we_i == `WriteEnable && clint_waddr_i[11:0] == `CSR_MVENDORID);
     assign mvendorid_next = (we_i == `WriteEnable && waddr_i[11:0] == `CSR_MVENDORID) ? data_i : clint_data_i;
@@ -506,6 +531,16 @@ module csr (
         .qout (mscratch)
     );
 
+    gnrl_dfflr #(
+        .DW(`REG_DATA_WIDTH)
+    ) mfiret_dfflr (
+        .clk  (clk),
+        .rst_n(rst_n),
+        .lden (mfiret_we),
+        .dnxt (mfiret_next),
+        .qout (mfiret)
+    );
+
     // 新增寄存器的D触发器实例
     // 机器模式
     gnrl_dfflr #(
@@ -665,6 +700,7 @@ module csr (
         (raddr_i[11:0] == `CSR_MIE) ? mie :
         (raddr_i[11:0] == `CSR_MSTATUS) ? mstatus :
         (raddr_i[11:0] == `CSR_MSCRATCH) ? mscratch :
+        (raddr_i[11:0] == `CSR_MFIRET) ? mfiret :
         // 机器模式寄存器
         (raddr_i[11:0] == `CSR_MVENDORID) ? mvendorid :
         (raddr_i[11:0] == `CSR_MARCHID) ? marchid :
@@ -701,6 +737,7 @@ module csr (
         (clint_raddr_i[11:0] == `CSR_MIE) ? mie :
         (clint_raddr_i[11:0] == `CSR_MSTATUS) ? mstatus :
         (clint_raddr_i[11:0] == `CSR_MSCRATCH) ? mscratch :
+        (clint_raddr_i[11:0] == `CSR_MFIRET) ? mfiret :
         // 机器模式寄存器
         (clint_raddr_i[11:0] == `CSR_MVENDORID) ? mvendorid :
         (clint_raddr_i[11:0] == `CSR_MARCHID) ? marchid :
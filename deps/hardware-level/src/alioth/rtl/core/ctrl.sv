@@ -37,8 +37,13 @@ module ctrl (
     input wire                        stall_flag_ex_i,
     input wire                        atom_opt_busy_i,  // 原子操作忙信号
 
+    // from dispatch，分支在分发级提前判定出的重定向
+    input wire                        early_jump_flag_i,
+    input wire [`INST_ADDR_WIDTH-1:0] early_jump_addr_i,
+
     // from clint
     input wire flush_flag_clint_i,  // 添加中断刷新信号输入
+    input wire sleep_i,             // WFI休眠，ID级停顿直至唤醒
 
     // from hdu
     input wire stall_flag_hdu_i,
@@ -61,14 +66,19 @@ module ctrl (
     // 原子操作相关的暂停条件
     wire atom_stall = atom_opt_busy_i & jump_flag_i;
 
+    // 执行级跳转及中断冲刷优先，此时分发级的分支本身也将被冲刷
+    wire ex_jump = jump_flag_i & ~none_data_hazard_stall;
+    wire early_jump = early_jump_flag_i & ~ex_jump & ~flush_flag_clint_i;
+
     // 简化的跳转输出逻辑
-    assign jump_addr_o                      = jump_addr_i;
-    assign jump_flag_o                      = jump_flag_i & ~none_data_hazard_stall;
+    assign jump_addr_o                      = ex_jump ? jump_addr_i : early_jump_addr_i;
+    assign jump_flag_o                      = ex_jump | early_jump;
 
     // 更新暂停标志输出，区分stall和flush
     assign stall_flag_o[`CU_STALL_IF]       = stall_flag_irs_i;
-    assign stall_flag_o[`CU_STALL_ID]       = stall_flag_ex_i | (stall_flag_hdu_i & ~jump_flag_i);
-    assign stall_flag_o[`CU_FLUSH]          = jump_flag_o | flush_flag_clint_i;
+    assign stall_flag_o[`CU_STALL_ID]       = stall_flag_ex_i | (stall_flag_hdu_i & ~jump_flag_i) | sleep_i;
+    assign stall_flag_o[`CU_FLUSH]          = ex_jump | flush_flag_clint_i;
     assign stall_flag_o[`CU_STALL_DISPATCH] = stall_flag_ex_i;
+    assign stall_flag_o[`CU_FLUSH_ID]       = early_jump;
 
 endmodule
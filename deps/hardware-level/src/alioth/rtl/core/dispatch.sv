@@ -43,6 +43,7 @@ module dispatch (
     input wire [ `REG_DATA_WIDTH-1:0] rs1_rdata_i,
     input wire [ `REG_DATA_WIDTH-1:0] rs2_rdata_i,
     input wire                        is_pred_branch_i,
+    input wire [ `BPU_META_WIDTH-1:0] bpu_meta_i,
 
     // 寄存器写入信息 - 用于HDU检测冒险
     input wire [   `REG_ADDR_WIDTH-1:0] reg_waddr_i,
@@ -64,6 +65,36 @@ module dispatch (
     // 写回阶段提交信号 - 用于HDU
     input wire                        commit_valid_i,
     input wire [`COMMIT_ID_WIDTH-1:0] commit_id_i,
+    input wire                        commit2_valid_i,  // LSU独立写端口提交
+    input wire [`COMMIT_ID_WIDTH-1:0] commit2_id_i,
+
+    // LSU写回信号(WBU寄存之前) - 用于load-use旁路
+    input wire                        lsu_reg_we_i,
+    input wire [ `REG_ADDR_WIDTH-1:0] lsu_reg_waddr_i,
+    input wire [ `REG_DATA_WIDTH-1:0] lsu_reg_wdata_i,
+    input wire [`COMMIT_ID_WIDTH-1:0] lsu_commit_id_i,
+
+    // 融合指令标志
+    input wire fused_i,
+    // 压缩指令标志
+    input wire inst_c_i,
+
+    // 双发射第二条ALU指令的译码信息与寄存器读数据
+    input wire                       dual_valid_i,
+    input wire                       dual_reg_we_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg1_raddr_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg2_raddr_i,
+    input wire                       dual_rs1_re_i,
+    input wire                       dual_rs2_re_i,
+    input wire [               31:0] dual_dec_imm_i,
+    input wire [ `DECINFO_WIDTH-1:0] dual_dec_info_bus_i,
+    input wire [`REG_DATA_WIDTH-1:0] dual_rs1_rdata_i,
+    input wire [`REG_DATA_WIDTH-1:0] dual_rs2_rdata_i,
+
+    // 分发级提前判定的分支重定向
+    output wire                        early_jump_flag_o,
+    output wire [`INST_ADDR_WIDTH-1:0] early_jump_addr_o,
 
     // HDU输出信号
     output wire                        hazard_stall_o,
@@ -149,9 +180,11 @@ module dispatch (
     output wire                        mem_op_lhu_o,
     output wire                        mem_op_load_o,
     output wire                        mem_op_store_o,
+    output wire                        mem_op_amo_o,
+    output wire [                 4:0] mem_amo_op_o,
     output wire [`COMMIT_ID_WIDTH-1:0] mem_commit_id_o,
     output wire [                31:0] mem_addr_o,
-    output wire [                 3:0] mem_wmask_o,
+    output wire [                 7:0] mem_wmask_o,
     output wire [                31:0] mem_wdata_o,
 
     // dispatch to SYS
@@ -161,7 +194,9 @@ module dispatch (
     output wire sys_op_ebreak_o,
     output wire sys_op_fence_o,
     output wire sys_op_dret_o,
+    output wire sys_op_fencei_o,
     output wire is_pred_branch_o, // 预测分支信号输出
+    output wire [`BPU_META_WIDTH-1:0] bpu_meta_o, // 分支预测元数据输出
 
     output wire misaligned_load_o,   // 未对齐加载异常信号输出
     output wire misaligned_store_o,  // 未对齐存储异常信号输出
@@ -169,7 +204,19 @@ module dispatch (
     output wire illegal_inst_o,
     // 新增：ALU RAW冒险旁路前递信号输出
     output wire alu_pass_op1_o,
-    output wire alu_pass_op2_o
+    output wire alu_pass_op2_o,
+
+    output wire pipe_fused_o,
+    output wire pipe_inst_c_o,
+
+    // dispatch to ALU(双发射第二条指令)
+    output wire                       pipe_dual_valid_o,
+    output wire                       dual_req_alu_o,
+    output wire [               31:0] dual_alu_op1_o,
+    output wire [               31:0] dual_alu_op2_o,
+    output wire [  `ALU_OP_WIDTH-1:0] dual_alu_op_info_o,
+    output wire                       dual_reg_we_o,
+    output wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_o
 );
 
     // 内部连线，用于连接dispatch_logic和dispatch_pipe
@@ -188,7 +235,7 @@ module dispatch (
 
     // 用于连接dispatch_logic输出到dispatch_pipe输入的内部地址、掩码和数据信号
     wire [                31:0] logic_mem_addr;
-    wire [                 3:0] logic_mem_wmask;
+    wire [                 7:0] logic_mem_wmask;
     wire [                31:0] logic_mem_wdata;
 
     // 用于连接dispatch_logic输出到dispatch_pipe输入的内部信号
@@ -253,6 +300,8 @@ module dispatch (
     wire                        logic_mem_op_sw;
     wire                        logic_mem_op_load;
     wire                        logic_mem_op_store;
+    wire                        logic_mem_op_amo;
+    wire [                 4:0] logic_mem_amo_op;
     wire [`COMMIT_ID_WIDTH-1:0] logic_mem_commit_id;
 
     wire                        logic_sys_op_nop;
@@ -261,6 +310,7 @@ module dispatch (
     wire                        logic_sys_op_ebreak;
     wire                        logic_sys_op_fence;
     wire                        logic_sys_op_dret;
+    wire                        logic_sys_op_fencei;
 
     // 未对齐访存异常信号
     wire                        logic_misaligned_load;
@@ -273,6 +323,24 @@ module dispatch (
     assign div_commit_id_o = commit_id_o;
 
     assign hdu_inst_we_en = !(stall_flag_i[`CU_STALL_ID] || stall_flag_i[`CU_FLUSH]);
+
+    // load-use旁路：LSU返回数据当拍直接送入分发级，比经WBU寄存后写回GPR提前一拍
+    wire lsu_bypass_en = (`LSU_LOAD_BYPASS != 0) && lsu_reg_we_i && (lsu_reg_waddr_i != `ZeroReg);
+    wire [`REG_DATA_WIDTH-1:0] rs1_rdata = (lsu_bypass_en && (reg1_raddr_i == lsu_reg_waddr_i)) ?
+                                           lsu_reg_wdata_i : rs1_rdata_i;
+    wire [`REG_DATA_WIDTH-1:0] rs2_rdata = (lsu_bypass_en && (reg2_raddr_i == lsu_reg_waddr_i)) ?
+                                           lsu_reg_wdata_i : rs2_rdata_i;
+    wire [`REG_DATA_WIDTH-1:0] dual_rs1_rdata = (lsu_bypass_en && (dual_reg1_raddr_i == lsu_reg_waddr_i)) ?
+                                                lsu_reg_wdata_i : dual_rs1_rdata_i;
+    wire [`REG_DATA_WIDTH-1:0] dual_rs2_rdata = (lsu_bypass_en && (dual_reg2_raddr_i == lsu_reg_waddr_i)) ?
+                                                lsu_reg_wdata_i : dual_rs2_rdata_i;
+
+    // 第二条指令的ALU操作数
+    wire                        logic1_req_alu;
+    wire [                31:0] logic1_alu_op1;
+    wire [                31:0] logic1_alu_op2;
+    wire [   `ALU_OP_WIDTH-1:0] logic1_alu_op_info;
+
     // 实例化HDU模块
     hdu u_hdu (
         .clk(clk),
@@ -287,6 +355,19 @@ module dispatch (
         .ex_info_bus(ex_info_bus_i),  // 新增：连接到hdu
         .commit_valid_i(commit_valid_i),
         .commit_id_i(commit_id_i),
+        .commit2_valid_i(commit2_valid_i),
+        .commit2_id_i(commit2_id_i),
+        .lsu_wb_valid_i(lsu_bypass_en),
+        .lsu_wb_id_i(lsu_commit_id_i),
+        .dual_valid_i(dual_valid_i),
+        .dual_rd_addr_i(dual_reg_waddr_i),
+        .dual_rs1_addr_i(dual_reg1_raddr_i),
+        .dual_rs2_addr_i(dual_reg2_raddr_i),
+        .dual_rs1_re_i(dual_rs1_re_i),
+        .dual_rs2_re_i(dual_rs2_re_i),
+        .dual_rd_we_i(dual_reg_we_i),
+        .ex_dual_we_i(dual_reg_we_o),
+        .ex_dual_waddr_i(dual_reg_waddr_o),
         .hazard_stall_o(hazard_stall_o),
         .commit_id_o(hdu_long_inst_id),
         .long_inst_atom_lock_o(long_inst_atom_lock_o),
@@ -306,8 +387,9 @@ module dispatch (
         .dec_info_bus_i(dec_info_bus_i),
         .dec_imm_i     (dec_imm_i),
         .dec_pc_i      (dec_pc_i),
-        .rs1_rdata_i   (rs1_rdata_i),
-        .rs2_rdata_i   (rs2_rdata_i),
+        .dec_inst_c_i  (inst_c_i),
+        .rs1_rdata_i   (rs1_rdata),
+        .rs2_rdata_i   (rs2_rdata),
 
         // ALU信号
         .req_alu_o    (logic_req_alu),
@@ -366,6 +448,8 @@ module dispatch (
         .mem_op_lhu_o  (logic_mem_op_lhu),
         .mem_op_load_o (logic_mem_op_load),
         .mem_op_store_o(logic_mem_op_store),
+        .mem_op_amo_o  (logic_mem_op_amo),
+        .mem_amo_op_o  (logic_mem_amo_op),
         // 直接计算的内存地址和掩码/数据
         .mem_addr_o    (logic_mem_addr),
         .mem_wmask_o   (logic_mem_wmask),
@@ -378,12 +462,136 @@ module dispatch (
         .sys_op_ebreak_o(logic_sys_op_ebreak),
         .sys_op_fence_o (logic_sys_op_fence),
         .sys_op_dret_o  (logic_sys_op_dret),
+        .sys_op_fencei_o(logic_sys_op_fencei),
 
         // 未对齐访存异常信号
         .misaligned_load_o (logic_misaligned_load),
         .misaligned_store_o(logic_misaligned_store)
     );
 
+    // 双发射第二条指令只会是简单ALU指令，仅使用ALU相关输出
+    dispatch_logic u_dispatch_logic1 (
+        .dec_info_bus_i(dual_dec_info_bus_i),
+        .dec_imm_i     (dual_dec_imm_i),
+        .dec_pc_i      (dec_pc_i + 32'd4),
+        .dec_inst_c_i  (1'b0),
+        .rs1_rdata_i   (dual_rs1_rdata),
+        .rs2_rdata_i   (dual_rs2_rdata),
+
+        .req_alu_o    (logic1_req_alu),
+        .alu_op1_o    (logic1_alu_op1),
+        .alu_op2_o    (logic1_alu_op2),
+        .alu_op_info_o(logic1_alu_op_info),
+
+        .req_bjp_o            (),
+        .bjp_op_jal_o         (),
+        .bjp_op_beq_o         (),
+        .bjp_op_bne_o         (),
+        .bjp_op_blt_o         (),
+        .bjp_op_bltu_o        (),
+        .bjp_op_bge_o         (),
+        .bjp_op_bgeu_o        (),
+        .bjp_op_jalr_o        (),
+        .bjp_adder_result_o   (),
+        .bjp_next_pc_o        (),
+        .op1_eq_op2_o         (),
+        .op1_ge_op2_signed_o  (),
+        .op1_ge_op2_unsigned_o(),
+
+        .req_mul_o      (),
+        .mul_op1_o      (),
+        .mul_op2_o      (),
+        .mul_op_mul_o   (),
+        .mul_op_mulh_o  (),
+        .mul_op_mulhsu_o(),
+        .mul_op_mulhu_o (),
+
+        .req_div_o    (),
+        .div_op1_o    (),
+        .div_op2_o    (),
+        .div_op_div_o (),
+        .div_op_divu_o(),
+        .div_op_rem_o (),
+        .div_op_remu_o(),
+
+        .req_csr_o  (),
+        .csr_op1_o  (),
+        .csr_addr_o (),
+        .csr_csrrw_o(),
+        .csr_csrrs_o(),
+        .csr_csrrc_o(),
+
+        .req_mem_o     (),
+        .mem_op_lb_o   (),
+        .mem_op_lh_o   (),
+        .mem_op_lw_o   (),
+        .mem_op_lbu_o  (),
+        .mem_op_lhu_o  (),
+        .mem_op_load_o (),
+        .mem_op_store_o(),
+        .mem_op_amo_o  (),
+        .mem_amo_op_o  (),
+        .mem_addr_o    (),
+        .mem_wmask_o   (),
+        .mem_wdata_o   (),
+
+        .sys_op_nop_o   (),
+        .sys_op_mret_o  (),
+        .sys_op_ecall_o (),
+        .sys_op_ebreak_o(),
+        .sys_op_fence_o (),
+        .sys_op_dret_o  (),
+        .sys_op_fencei_o(),
+
+        .misaligned_load_o (),
+        .misaligned_store_o()
+    );
+
+    // 分支提前判定：分支不参与执行级旁路，能离开分发级时操作数已全部来自GPR或load旁路，
+    // 比较结果与执行级一致。复用exu_bru在分发级判定，误预测时当拍重定向取指；
+    // 送入执行级的预测信息改为实际结果，执行级据此不再重复跳转
+    wire                        early_en = (`BRANCH_EARLY_RESOLVE != 0) && inst_valid_i &&
+                                           !stall_flag_i[`CU_STALL_ID] && !stall_flag_i[`CU_FLUSH];
+    wire                        early_bru_jump;
+    wire [`INST_ADDR_WIDTH-1:0] early_bru_addr;
+    wire                        early_bru_taken;
+
+    exu_bru u_early_bru (
+        .rst_n                (rst_n),
+        .req_bjp_i            (logic_req_bjp & early_en),
+        .bjp_op_jal_i         (logic_bjp_op_jal),
+        .bjp_op_beq_i         (logic_bjp_op_beq),
+        .bjp_op_bne_i         (logic_bjp_op_bne),
+        .bjp_op_blt_i         (logic_bjp_op_blt),
+        .bjp_op_bltu_i        (logic_bjp_op_bltu),
+        .bjp_op_bge_i         (logic_bjp_op_bge),
+        .bjp_op_bgeu_i        (logic_bjp_op_bgeu),
+        .bjp_op_jalr_i        (logic_bjp_op_jalr),
+        .is_pred_branch_i     (is_pred_branch_i),
+        .pred_addr_i          (bpu_meta_i[`BPU_META_ADDR]),
+        .bjp_adder_result_i   (logic_bjp_adder_result),
+        .bjp_next_pc_i        (logic_bjp_next_pc),
+        .op1_eq_op2_i         (logic_op1_eq_op2),
+        .op1_ge_op2_signed_i  (logic_op1_ge_op2_signed),
+        .op1_ge_op2_unsigned_i(logic_op1_ge_op2_unsigned),
+        .sys_op_fence_i       (1'b0),                        // FENCE仍在执行级处理
+        .int_assert_i         (1'b0),
+        .int_addr_i           (`ZeroWord),
+        .jump_flag_o          (early_bru_jump),              // 已排除非对齐目标，由执行级报异常
+        .jump_addr_o          (early_bru_addr),
+        .misaligned_fetch_o   (),
+        .bjp_taken_o          (early_bru_taken),
+        .bjp_target_o         ()
+    );
+
+    assign early_jump_flag_o = early_bru_jump;
+    assign early_jump_addr_o = early_bru_addr;
+
+    // 已重定向的分支：跳转时按预测跳转到实际目标，不跳转时按未预测处理
+    wire                        pipe_is_pred_branch = early_bru_jump ? early_bru_taken : is_pred_branch_i;
+    wire [ `BPU_META_WIDTH-1:0] pipe_bpu_meta = early_bru_jump ?
+                                                {bpu_meta_i[`BPU_META_IDX], early_bru_addr} : bpu_meta_i;
+
     // 实例化dispatch_pipe模块
     dispatch_pipe u_dispatch_pipe (
         .clk         (clk),
@@ -404,9 +612,10 @@ module dispatch (
         .dec_imm_i       (dec_imm_i),
         .dec_info_bus_i  (dec_info_bus_i),
         // 寄存rs1/rs2数据
-        .rs1_rdata_i     (rs1_rdata_i),
-        .rs2_rdata_i     (rs2_rdata_i),
-        .is_pred_branch_i(is_pred_branch_i),  // 连接预测分支信号输入
+        .rs1_rdata_i     (rs1_rdata),
+        .rs2_rdata_i     (rs2_rdata),
+        .is_pred_branch_i(pipe_is_pred_branch),  // 连接预测分支信号输入
+        .bpu_meta_i      (pipe_bpu_meta),
         // 新增：非法指令信号输入
         .illegal_inst_i  (illegal_inst_i),
 
@@ -424,6 +633,18 @@ module dispatch (
         .div_pass_op2_i(div_pass_op2),
         .csr_pass_op1_i(csr_pass_op1),
 
+        .fused_i(fused_i),
+        .inst_c_i(inst_c_i),
+
+        // 双发射第二条ALU指令输入
+        .dual_valid_i      (dual_valid_i),
+        .dual_req_alu_i    (logic1_req_alu),
+        .dual_alu_op1_i    (logic1_alu_op1),
+        .dual_alu_op2_i    (logic1_alu_op2),
+        .dual_alu_op_info_i(logic1_alu_op_info),
+        .dual_reg_we_i     (dual_reg_we_i),
+        .dual_reg_waddr_i  (dual_reg_waddr_i),
+
         // BJP信号输入
         .req_bjp_i            (logic_req_bjp),
         .bjp_op_jal_i         (logic_bjp_op_jal),
@@ -475,6 +696,8 @@ module dispatch (
         .mem_op_lhu_i  (logic_mem_op_lhu),
         .mem_op_load_i (logic_mem_op_load),
         .mem_op_store_i(logic_mem_op_store),
+        .mem_op_amo_i  (logic_mem_op_amo),
+        .mem_amo_op_i  (logic_mem_amo_op),
         .mem_addr_i    (logic_mem_addr),
         .mem_wmask_i   (logic_mem_wmask),
         .mem_wdata_i   (logic_mem_wdata),
@@ -486,6 +709,7 @@ module dispatch (
         .sys_op_ebreak_i(logic_sys_op_ebreak),
         .sys_op_fence_i (logic_sys_op_fence),
         .sys_op_dret_i  (logic_sys_op_dret),
+        .sys_op_fencei_i(logic_sys_op_fencei),
 
         // 未对齐访存异常信号
         .misaligned_load_i (logic_misaligned_load),
@@ -522,6 +746,18 @@ module dispatch (
         .div_pass_op2_o(div_pass_op2_o),
         .csr_pass_op1_o(csr_pass_op1_o),
 
+        .fused_o(pipe_fused_o),
+        .inst_c_o(pipe_inst_c_o),
+
+        // 双发射第二条ALU指令输出
+        .dual_valid_o      (pipe_dual_valid_o),
+        .dual_req_alu_o    (dual_req_alu_o),
+        .dual_alu_op1_o    (dual_alu_op1_o),
+        .dual_alu_op2_o    (dual_alu_op2_o),
+        .dual_alu_op_info_o(dual_alu_op_info_o),
+        .dual_reg_we_o     (dual_reg_we_o),
+        .dual_reg_waddr_o  (dual_reg_waddr_o),
+
         // BJP信号输出
         .req_bjp_o            (req_bjp_o),
         .bjp_op_jal_o         (bjp_op_jal_o),
@@ -575,6 +811,8 @@ module dispatch (
         .mem_op_lhu_o  (mem_op_lhu_o),
         .mem_op_load_o (mem_op_load_o),
         .mem_op_store_o(mem_op_store_o),
+        .mem_op_amo_o  (mem_op_amo_o),
+        .mem_amo_op_o  (mem_amo_op_o),
         .mem_addr_o    (mem_addr_o),
         .mem_wmask_o   (mem_wmask_o),
         .mem_wdata_o   (mem_wdata_o),
@@ -586,7 +824,9 @@ module dispatch (
         .sys_op_ebreak_o   (sys_op_ebreak_o),
         .sys_op_fence_o    (sys_op_fence_o),
         .sys_op_dret_o     (sys_op_dret_o),
+        .sys_op_fencei_o   (sys_op_fencei_o),
         .is_pred_branch_o  (is_pred_branch_o),    // 连接预测分支信号输出
+        .bpu_meta_o        (bpu_meta_o),
         .misaligned_load_o (misaligned_load_o),
         .misaligned_store_o(misaligned_store_o),
         .illegal_inst_o    (illegal_inst_o)       // 新增：非法指令信号输出
@@ -30,6 +30,7 @@ module dispatch_logic (
     input wire [`DECINFO_WIDTH-1:0] dec_info_bus_i,
     input wire [              31:0] dec_imm_i,
     input wire [              31:0] dec_pc_i,
+    input wire                      dec_inst_c_i,  // 压缩指令，顺序下一PC为pc+2
     input wire [              31:0] rs1_rdata_i,
     input wire [              31:0] rs2_rdata_i,
 
@@ -92,10 +93,12 @@ module dispatch_logic (
     output wire mem_op_lhu_o,
     output wire mem_op_load_o,
     output wire mem_op_store_o,
+    output wire mem_op_amo_o,
+    output wire [4:0] mem_amo_op_o,
 
     // 直接计算的内存地址和掩码/数据
     output wire [31:0] mem_addr_o,
-    output wire [ 3:0] mem_wmask_o,
+    output wire [ 7:0] mem_wmask_o,  // [3:0]对应访问地址所在字，[7:4]对应下一个字(非对齐跨字时)
     output wire [31:0] mem_wdata_o,
 
     // dispatch to SYS
@@ -105,6 +108,7 @@ module dispatch_logic (
     output wire sys_op_ebreak_o,
     output wire sys_op_fence_o,
     output wire sys_op_dret_o,
+    output wire sys_op_fencei_o,
 
     // 新增：未对齐访存异常输出
     output wire misaligned_load_o,
@@ -127,9 +131,11 @@ module dispatch_logic (
     // ALU op2
     wire alu_op2_imm = alu_info[`DECINFO_ALU_OP2IMM];  // 使用立即数作为操作数2 (I型指令、LUI、AUIPC)
     wire [31:0] alu_op2 = alu_op2_imm ? dec_imm_i : rs2_rdata_i;
-    assign alu_op2_o = bjp_wb_req ? 32'h4 : op_alu ? alu_op2 : 32'h0;
+    wire [31:0] inst_len = dec_inst_c_i ? 32'h2 : 32'h4;
+    assign alu_op2_o = bjp_wb_req ? inst_len : op_alu ? alu_op2 : 32'h0;
 
     assign alu_op_info_o = {
+        alu_info[`DECINFO_ALU_BMUOP],  // ALU_OP_BMUOP
         bjp_wb_req,  // ALU_OP_JUMP
         alu_info[`DECINFO_ALU_AUIPC],  // ALU_OP_AUIPC
         alu_info[`DECINFO_ALU_LUI],  // ALU_OP_LUI
@@ -192,7 +198,7 @@ module dispatch_logic (
     wire [31:0] bjp_jump_op1 = bjp_op1_rs1 ? rs1_rdata_i : dec_pc_i;
     wire [31:0] bjp_jump_op2 = dec_imm_i;  // 使用立即数作为跳转偏移量
     assign bjp_adder_result_o = bjp_jump_op1 + bjp_jump_op2;
-    assign bjp_next_pc_o      = dec_pc_i + 32'h4;  // 默认下一条指令地址
+    assign bjp_next_pc_o      = dec_pc_i + inst_len;  // 默认下一条指令地址
 
     wire [31:0] bjp_op1 = op_bjp ? rs1_rdata_i : 32'h0;  // 用于分支指令的比较操作数1
     wire [31:0] bjp_op2 = op_bjp ? rs2_rdata_i : 32'h0;  // 用于分支指令的比较操作数2
@@ -223,8 +229,10 @@ module dispatch_logic (
     wire agu_mem_op_lb, agu_mem_op_lh, agu_mem_op_lw, agu_mem_op_lbu, agu_mem_op_lhu;
     wire agu_mem_op_sb, agu_mem_op_sh, agu_mem_op_sw;
     wire agu_mem_op_load, agu_mem_op_store;
+    wire agu_mem_op_amo;
+    wire [ 4:0] agu_mem_amo_op;
     wire [31:0] agu_mem_addr;
-    wire [ 3:0] agu_mem_wmask;
+    wire [ 7:0] agu_mem_wmask;
     wire [31:0] agu_mem_wdata;
     wire agu_misaligned_load, agu_misaligned_store;
 
@@ -244,6 +252,8 @@ module dispatch_logic (
         .mem_op_sw_o   (agu_mem_op_sw),
         .mem_op_load_o (agu_mem_op_load),
         .mem_op_store_o(agu_mem_op_store),
+        .mem_op_amo_o  (agu_mem_op_amo),
+        .mem_amo_op_o  (agu_mem_amo_op),
         .mem_addr_o    (agu_mem_addr),
         .mem_wmask_o   (agu_mem_wmask),
         .mem_wdata_o   (agu_mem_wdata),
@@ -259,6 +269,8 @@ module dispatch_logic (
     assign mem_op_lhu_o   = agu_mem_op_lhu;
     assign mem_op_load_o  = agu_mem_op_load;
     assign mem_op_store_o = agu_mem_op_store;
+    assign mem_op_amo_o   = agu_mem_op_amo;
+    assign mem_amo_op_o   = agu_mem_amo_op;
     assign mem_addr_o     = agu_mem_addr;
     assign mem_wmask_o    = agu_mem_wmask;
     assign mem_wdata_o    = agu_mem_wdata;
@@ -277,5 +289,6 @@ module dispatch_logic (
     assign sys_op_ebreak_o = sys_info[`DECINFO_SYS_EBREAK];  // EBREAK指令：断点
     assign sys_op_fence_o  = sys_info[`DECINFO_SYS_FENCE];  // FENCE指令：内存屏障
     assign sys_op_dret_o   = sys_info[`DECINFO_SYS_DRET];  // DRET指令：从调试模式返回
+    assign sys_op_fencei_o = sys_info[`DECINFO_SYS_FENCEI];  // FENCE.I指令：失效指令缓存
 
 endmodule
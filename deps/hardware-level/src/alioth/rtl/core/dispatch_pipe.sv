@@ -50,6 +50,7 @@ module dispatch_pipe (
     input wire [               31:0] rs1_rdata_i,
     input wire [               31:0] rs2_rdata_i,
     input wire                       is_pred_branch_i,  // 新增：预测分支信号输入
+    input wire [`BPU_META_WIDTH-1:0] bpu_meta_i,        // 分支预测元数据输入
     // 新增：非法指令信号输入
     input wire                       illegal_inst_i,
 
@@ -67,6 +68,18 @@ module dispatch_pipe (
     input wire                     div_pass_op2_i,
     input wire                     csr_pass_op1_i,
 
+    input wire fused_i,  // 融合指令标志
+    input wire inst_c_i,  // 压缩指令标志
+
+    // 双发射第二条ALU指令输入端口
+    input wire                       dual_valid_i,
+    input wire                       dual_req_alu_i,
+    input wire [               31:0] dual_alu_op1_i,
+    input wire [               31:0] dual_alu_op2_i,
+    input wire [  `ALU_OP_WIDTH-1:0] dual_alu_op_info_i,
+    input wire                       dual_reg_we_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_i,
+
     // BJP输入端口
     input wire        req_bjp_i,
     input wire        bjp_op_jal_i,
@@ -120,10 +133,12 @@ module dispatch_pipe (
     input wire mem_op_lhu_i,
     input wire mem_op_load_i,
     input wire mem_op_store_i,
+    input wire mem_op_amo_i,
+    input wire [4:0] mem_amo_op_i,
 
     // 直接计算的内存地址和掩码/数据输入
     input wire [31:0] mem_addr_i,
-    input wire [ 3:0] mem_wmask_i,
+    input wire [ 7:0] mem_wmask_i,
     input wire [31:0] mem_wdata_i,
 
     // 新增：未对齐访存异常输入
@@ -137,6 +152,7 @@ module dispatch_pipe (
     input wire sys_op_ebreak_i,
     input wire sys_op_fence_i,
     input wire sys_op_dret_i,
+    input wire sys_op_fencei_i,
 
     // 指令信息输出端口
     output wire [`INST_ADDR_WIDTH-1:0] inst_addr_o,
@@ -165,6 +181,18 @@ module dispatch_pipe (
     // 新增旁路信号输出
     output wire                     alu_pass_op1_o,
     output wire                     alu_pass_op2_o,
+
+    output wire fused_o,  // 融合指令标志
+    output wire inst_c_o,  // 压缩指令标志
+
+    // 双发射第二条ALU指令输出端口
+    output wire                       dual_valid_o,
+    output wire                       dual_req_alu_o,
+    output wire [               31:0] dual_alu_op1_o,
+    output wire [               31:0] dual_alu_op2_o,
+    output wire [  `ALU_OP_WIDTH-1:0] dual_alu_op_info_o,
+    output wire                       dual_reg_we_o,
+    output wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_o,
     // 新增MUL/DIV/CSR旁路信号输出
     output wire                     mul_pass_op1_o,
     output wire                     mul_pass_op2_o,
@@ -224,10 +252,12 @@ module dispatch_pipe (
     output wire mem_op_lhu_o,
     output wire mem_op_load_o,
     output wire mem_op_store_o,
+    output wire mem_op_amo_o,
+    output wire [4:0] mem_amo_op_o,
 
     // 保留这些计算好的内存地址和掩码/数据输出
     output wire [31:0] mem_addr_o,
-    output wire [ 3:0] mem_wmask_o,
+    output wire [ 7:0] mem_wmask_o,
     output wire [31:0] mem_wdata_o,
 
     // 新增：未对齐访存异常输出
@@ -241,7 +271,9 @@ module dispatch_pipe (
     output wire sys_op_ebreak_o,
     output wire sys_op_fence_o,
     output wire sys_op_dret_o,
+    output wire sys_op_fencei_o,
     output wire is_pred_branch_o,  // 新增：预测分支信号输出
+    output wire [`BPU_META_WIDTH-1:0] bpu_meta_o,  // 分支预测元数据输出
     // 新增：非法指令信号输出
     output wire illegal_inst_o
 );
@@ -876,6 +908,28 @@ module dispatch_pipe (
     );
     assign mem_op_store_o = mem_op_store;
 
+    wire mem_op_amo_dnxt = mem_op_amo_i;
+    wire mem_op_amo;
+    gnrl_dfflr #(1) mem_op_amo_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        mem_op_amo_dnxt,
+        mem_op_amo
+    );
+    assign mem_op_amo_o = mem_op_amo;
+
+    wire [4:0] mem_amo_op_dnxt = mem_amo_op_i;
+    wire [4:0] mem_amo_op;
+    gnrl_dfflr #(5) mem_amo_op_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        mem_amo_op_dnxt,
+        mem_amo_op
+    );
+    assign mem_amo_op_o = mem_amo_op;
+
     // SYS信号寄存
     wire sys_op_nop_dnxt = sys_op_nop_i;
     wire sys_op_nop;
@@ -943,6 +997,17 @@ module dispatch_pipe (
     );
     assign sys_op_dret_o = sys_op_dret;
 
+    wire sys_op_fencei_dnxt = flush_en ? 1'b0 : sys_op_fencei_i;
+    wire sys_op_fencei;
+    gnrl_dfflr #(1) sys_op_fencei_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        sys_op_fencei_dnxt,
+        sys_op_fencei
+    );
+    assign sys_op_fencei_o = sys_op_fencei;
+
     // 新增：rs1_rdata寄存器
     wire [31:0] rs1_rdata_dnxt = rs1_rdata_i;
     wire [31:0] rs1_rdata;
@@ -979,6 +1044,15 @@ module dispatch_pipe (
     );
     assign is_pred_branch_o = is_pred_branch;
 
+    // 分支预测元数据寄存器
+    gnrl_dfflr #(`BPU_META_WIDTH) bpu_meta_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        bpu_meta_i,
+        bpu_meta_o
+    );
+
     // 新增：内存地址寄存器
     wire [31:0] mem_addr_dnxt = mem_addr_i;
     wire [31:0] mem_addr;
@@ -992,9 +1066,9 @@ module dispatch_pipe (
     assign mem_addr_o = mem_addr;
 
     // 新增：内存写掩码寄存器
-    wire [3:0] mem_wmask_dnxt = mem_wmask_i;
-    wire [3:0] mem_wmask;
-    gnrl_dfflr #(4) mem_wmask_ff (
+    wire [7:0] mem_wmask_dnxt = mem_wmask_i;
+    wire [7:0] mem_wmask;
+    gnrl_dfflr #(8) mem_wmask_ff (
         clk,
         rst_n,
         reg_update_en,
@@ -1155,4 +1229,76 @@ module dispatch_pipe (
     );
     assign csr_pass_op1_o = csr_pass_op1;
 
+    // 融合指令标志寄存器
+    wire fused_dnxt = flush_en ? 1'b0 : fused_i;
+    wire fused;
+    gnrl_dfflr #(1) fused_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        fused_dnxt,
+        fused
+    );
+    assign fused_o = fused;
+
+    // 压缩指令标志寄存器
+    wire inst_c_dnxt = flush_en ? 1'b0 : inst_c_i;
+    wire inst_c;
+    gnrl_dfflr #(1) inst_c_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        inst_c_dnxt,
+        inst_c
+    );
+    assign inst_c_o = inst_c;
+
+    // 双发射第二条ALU指令：与第一条同步插入气泡/保持
+    wire dual_valid_dnxt = flush_en ? 1'b0 : dual_valid_i;
+    wire dual_valid;
+    gnrl_dfflr #(1) dual_valid_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        dual_valid_dnxt,
+        dual_valid
+    );
+    assign dual_valid_o = dual_valid;
+
+    wire dual_req_alu_dnxt = flush_en ? 1'b0 : (dual_valid_i && dual_req_alu_i);
+    wire dual_req_alu;
+    gnrl_dfflr #(1) dual_req_alu_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        dual_req_alu_dnxt,
+        dual_req_alu
+    );
+    assign dual_req_alu_o = dual_req_alu;
+
+    wire dual_reg_we_dnxt = flush_en ? `WriteDisable : (dual_valid_i && dual_reg_we_i);
+    wire dual_reg_we;
+    gnrl_dfflr #(1) dual_reg_we_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        dual_reg_we_dnxt,
+        dual_reg_we
+    );
+    assign dual_reg_we_o = dual_reg_we;
+
+    localparam DUAL_ALU_W = 64 + `ALU_OP_WIDTH + `REG_ADDR_WIDTH;
+    wire [DUAL_ALU_W-1:0] dual_alu_dnxt = {
+        dual_alu_op1_i, dual_alu_op2_i, dual_alu_op_info_i, dual_reg_waddr_i
+    };
+    wire [DUAL_ALU_W-1:0] dual_alu;
+    gnrl_dfflr #(DUAL_ALU_W) dual_alu_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        dual_alu_dnxt,
+        dual_alu
+    );
+    assign {dual_alu_op1_o, dual_alu_op2_o, dual_alu_op_info_o, dual_reg_waddr_o} = dual_alu;
+
 endmodule
@@ -25,8 +25,10 @@
 `include "defines.svh"
 
 // 除法模块
-// 试商法实现32位整数除法
-// 每次除法运算至少需要33个时钟周期才能完成
+// 多位恢复余数法实现32位整数除法，每个周期产生`DIV_RADIX_BITS位商
+// 启动时跳过被除数的前导零，运算周期数随被除数有效位数减少：
+// 共需 2 + ceil(有效位数 / `DIV_RADIX_BITS) 个时钟周期
+// 除数为0、被除数小于除数、除数为2的幂(含有符号溢出 -2^31 / -1)时在启动周期直接给出结果
 module div (
     input wire clk,
     input wire rst_n,
@@ -39,11 +41,14 @@ module div (
     input wire [                3:0] op_i,          // 操作类型
 
     // to ex
-    output reg [`REG_DATA_WIDTH-1:0] result_o,  // 除法结果，高32位是余数，低32位是商
+    output reg [`REG_DATA_WIDTH-1:0] result_o,  // 除法结果，商或余数
     output reg busy_o,  // 正在运算信号
     output reg valid_o  // 输出有效信号
 );
 
+    // 每周期产生的商位数：1/2/4，越大延迟越短、面积越大
+    localparam int RADIX_BITS = `DIV_RADIX_BITS;
+
     // 状态定义
     typedef enum logic [3:0] {
         STATE_IDLE  = 4'b0001,
@@ -56,10 +61,9 @@ module div (
     reg [`REG_DATA_WIDTH-1:0] dividend_r;
     reg [`REG_DATA_WIDTH-1:0] divisor_r;
     reg [3:0] op_r;
-    reg [31:0] count;
+    reg [5:0] count;  // 剩余迭代次数
     reg [`REG_DATA_WIDTH-1:0] div_result;
     reg [`REG_DATA_WIDTH-1:0] div_remain;
-    reg [`REG_DATA_WIDTH-1:0] minuend;
     reg invert_result;
 
     // 从op_i解析具体操作类型
@@ -67,17 +71,60 @@ module div (
     wire op_divu = op_r[1];
     wire op_rem = op_r[2];
     wire op_remu = op_r[3];
+    wire op_signed = op_div | op_rem;
+
+    // 参与运算的无符号操作数(有符号运算取绝对值)
+    wire [31:0] dividend_abs = (op_signed && dividend_r[31]) ? -dividend_r : dividend_r;
+    wire [31:0] divisor_abs = (op_signed && divisor_r[31]) ? -divisor_r : divisor_r;
+
+    // 运算结束后是否要对结果取补码
+    wire invert_nxt = (op_div && (dividend_r[31] ^ divisor_r[31])) || (op_rem && dividend_r[31]);
+
+    // 被除数前导零个数及除数最高有效位位置
+    reg [5:0] dividend_lz;
+    reg [4:0] divisor_msb;
+    always_comb begin
+        dividend_lz = 6'd32;
+        for (int k = 0; k < 32; k = k + 1) begin
+            if (dividend_abs[k]) dividend_lz = 6'(31 - k);
+        end
+        divisor_msb = 5'd0;
+        for (int k = 0; k < 32; k = k + 1) begin
+            if (divisor_abs[k]) divisor_msb = 5'(k);
+        end
+    end
 
-    wire [31:0] dividend_invert = (-dividend_r);
-    wire [31:0] divisor_invert = (-divisor_r);
-    wire minuend_ge_divisor = minuend >= divisor_r;
-    wire [31:0] minuend_sub_res = minuend - divisor_r;
-    wire [31:0] div_result_tmp = minuend_ge_divisor ? ({div_result[30:0], 1'b1}) : ({div_result[30:0], 1'b0});
-    wire [31:0] minuend_tmp = minuend_ge_divisor ? minuend_sub_res[30:0] : minuend[30:0];
-
-    // 绝对值信号
-    wire [31:0] dividend_abs = dividend_r[31] ? -dividend_r : dividend_r;
-    wire [31:0] divisor_abs = divisor_r[31] ? -divisor_r : divisor_r;
+    // 前导零跳过：按RADIX_BITS对齐，剩余位数决定迭代次数
+    wire [5:0] skip_bits = dividend_lz & ~6'(RADIX_BITS - 1);
+    wire [5:0] iter_num = 6'((32 - skip_bits) / RADIX_BITS);
+
+    // 除数为2的幂：商为移位结果，余数为低位
+    wire divisor_pow2 = ((divisor_abs & (divisor_abs - 32'd1)) == `ZeroWord);
+    wire [31:0] pow2_quot = dividend_abs >> divisor_msb;
+    wire [31:0] pow2_rem = dividend_abs & (divisor_abs - 32'd1);
+    wire [31:0] pow2_res = (op_div | op_divu) ? pow2_quot : pow2_rem;
+
+    // 单周期RADIX_BITS级恢复余数迭代
+    reg [`REG_DATA_WIDTH-1:0] calc_remain;
+    reg [`REG_DATA_WIDTH-1:0] calc_result;
+    reg [`REG_DATA_WIDTH-1:0] calc_dividend;
+    reg [`REG_DATA_WIDTH:0] calc_partial;
+    always_comb begin
+        calc_remain   = div_remain;
+        calc_result   = div_result;
+        calc_dividend = dividend_r;
+        for (int k = 0; k < RADIX_BITS; k = k + 1) begin
+            calc_partial  = {calc_remain, calc_dividend[31]};
+            calc_dividend = {calc_dividend[30:0], 1'b0};
+            if (calc_partial >= {1'b0, divisor_r}) begin
+                calc_partial = calc_partial - {1'b0, divisor_r};
+                calc_result  = {calc_result[30:0], 1'b1};
+            end else begin
+                calc_result = {calc_result[30:0], 1'b0};
+            end
+            calc_remain = calc_partial[31:0];
+        end
+    end
 
     // 状态机实现
     always @(posedge clk) begin
@@ -89,11 +136,10 @@ module div (
             op_r          <= 4'h0;
             dividend_r    <= `ZeroWord;
             divisor_r     <= `ZeroWord;
-            minuend       <= `ZeroWord;
             invert_result <= 1'b0;
             busy_o        <= 1'b0;
             valid_o       <= 1'b0;
-            count         <= `ZeroWord;
+            count         <= 6'd0;
         end else begin
             case (state)
                 STATE_IDLE: begin
@@ -106,7 +152,7 @@ module div (
                             state      <= STATE_START;
                             busy_o     <= 1'b1;
                         end else begin
-                            op_r       <= 3'h0;
+                            op_r       <= 4'h0;
                             dividend_r <= `ZeroWord;
                             divisor_r  <= `ZeroWord;
                             result_o   <= `ZeroWord;
@@ -127,73 +173,43 @@ module div (
                         state   <= STATE_IDLE;
                         busy_o  <= 1'b0;
                         valid_o <= 1'b1;
-                        // 提前退出：被除数小于除数
-                    end else if (
-                        (op_div | op_rem) ? (dividend_abs < divisor_abs) : (dividend_r < divisor_r)
-                    ) begin
-                        if (op_div) begin
-                            // 有符号除法，商为0，符号由被除数和除数决定
-                            result_o <= 32'b0;
-                        end else if (op_rem) begin
-                            // 有符号余数，余数就是被除数
-                            result_o <= dividend_r;
-                        end else if (op_divu) begin
+                        // 提前退出：被除数小于除数，商为0，余数就是被除数
+                    end else if (dividend_abs < divisor_abs) begin
+                        if (op_div | op_divu) begin
                             result_o <= 32'b0;
-                        end else if (op_remu) begin
+                        end else begin
                             result_o <= dividend_r;
                         end
                         state   <= STATE_IDLE;
                         busy_o  <= 1'b0;
                         valid_o <= 1'b1;
-                        // 除数不为0
+                        // 提前退出：除数为2的幂，移位得到结果
+                    end else if (divisor_pow2) begin
+                        result_o <= invert_nxt ? -pow2_res : pow2_res;
+                        state    <= STATE_IDLE;
+                        busy_o   <= 1'b0;
+                        valid_o  <= 1'b1;
                     end else begin
-                        busy_o     <= 1'b1;
-                        count      <= 32'h40000000;
-                        state      <= STATE_CALC;
-                        div_result <= `ZeroWord;
-                        div_remain <= `ZeroWord;
-
-                        // DIV和REM这两条指令是有符号数运算指令
-                        if (op_div | op_rem) begin
-                            // 被除数求补码
-                            if (dividend_r[31] == 1'b1) begin
-                                dividend_r <= dividend_invert;
-                                minuend    <= dividend_invert[31];
-                            end else begin
-                                minuend <= dividend_r[31];
-                            end
-                            // 除数求补码
-                            if (divisor_r[31] == 1'b1) begin
-                                divisor_r <= divisor_invert;
-                            end
-                        end else begin
-                            minuend <= dividend_r[31];
-                        end
-
-                        // 运算结束后是否要对结果取补码
-                        if ((op_div && (dividend_r[31] ^ divisor_r[31] == 1'b1))
-                            || (op_rem && (dividend_r[31] == 1'b1))) begin
-                            invert_result <= 1'b1;
-                        end else begin
-                            invert_result <= 1'b0;
-                        end
+                        busy_o        <= 1'b1;
+                        state         <= STATE_CALC;
+                        div_result    <= `ZeroWord;
+                        div_remain    <= `ZeroWord;
+                        // 跳过被除数前导零
+                        dividend_r    <= dividend_abs << skip_bits;
+                        divisor_r     <= divisor_abs;
+                        count         <= iter_num;
+                        invert_result <= invert_nxt;
                     end
                 end
 
                 STATE_CALC: begin
                     busy_o     <= 1'b1;
-                    dividend_r <= {dividend_r[30:0], 1'b0};
-                    div_result <= div_result_tmp;
-                    count      <= {1'b0, count[31:1]};
-                    if (|count) begin
-                        minuend <= {minuend_tmp[30:0], dividend_r[30]};
-                    end else begin
+                    dividend_r <= calc_dividend;
+                    div_result <= calc_result;
+                    div_remain <= calc_remain;
+                    count      <= count - 6'd1;
+                    if (count == 6'd1) begin
                         state <= STATE_END;
-                        if (minuend_ge_divisor) begin
-                            div_remain <= minuend_sub_res;
-                        end else begin
-                            div_remain <= minuend;
-                        end
                     end
                 end
 
@@ -216,6 +232,10 @@ module div (
                     end
                 end
 
+                default: begin
+                    state <= STATE_IDLE;
+                end
+
             endcase
         end
     end
@@ -48,6 +48,7 @@ module exu (
     input wire div_wb_ready_i,   // DIV写回握手信号
     input wire csr_wb_ready_i,   // CSR写回握手信号
     input wire is_pred_branch_i, // 添加预测分支指令标志输入
+    input wire [`INST_ADDR_WIDTH-1:0] pred_addr_i,  // 预测的跳转目标
 
     // from regs
     input wire [`REG_DATA_WIDTH-1:0] reg1_rdata_i,
@@ -64,6 +65,14 @@ module exu (
     input wire                     alu_pass_op1_i,  // 新增：ALU旁路信号
     input wire                     alu_pass_op2_i,  // 新增：ALU旁路信号
 
+    // dispatch to ALU(双发射第二条指令)
+    input wire                       dual_req_alu_i,
+    input wire [               31:0] dual_alu_op1_i,
+    input wire [               31:0] dual_alu_op2_i,
+    input wire [  `ALU_OP_WIDTH-1:0] dual_alu_op_info_i,
+    input wire                       dual_reg_we_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_i,
+
     // dispatch to BJP
     input wire        req_bjp_i,
     input wire        bjp_op_jal_i,
@@ -122,11 +131,13 @@ module exu (
     input wire                        mem_op_lhu_i,
     input wire                        mem_op_load_i,
     input wire                        mem_op_store_i,
+    input wire                        mem_op_amo_i,
+    input wire [                 4:0] mem_amo_op_i,
     input wire [`COMMIT_ID_WIDTH-1:0] mem_commit_id_i,
     // 新增：直接访存信号
     input wire [                31:0] mem_addr_i,
     input wire [                31:0] mem_wdata_i,
-    input wire [                 3:0] mem_wmask_i,
+    input wire [                 7:0] mem_wmask_i,
 
     // dispatch to SYS
     input wire sys_op_nop_i,
@@ -145,6 +156,11 @@ module exu (
     output wire [ `REG_ADDR_WIDTH-1:0] alu_reg_waddr_o,
     output wire [`COMMIT_ID_WIDTH-1:0] alu_commit_id_o,
 
+    // 双发射第二条ALU指令结果，不经写回仲裁
+    output wire [ `REG_DATA_WIDTH-1:0] dual_reg_wdata_o,
+    output wire                        dual_reg_we_o,
+    output wire [ `REG_ADDR_WIDTH-1:0] dual_reg_waddr_o,
+
     output wire [ `REG_DATA_WIDTH-1:0] mul_reg_wdata_o,
     output wire                        mul_reg_we_o,
     output wire [ `REG_ADDR_WIDTH-1:0] mul_reg_waddr_o,
@@ -179,6 +195,14 @@ module exu (
     // 输出LSU未完成传输事务信号
     output wire mem_store_busy_o,
 
+    // DTCM直连访存端口
+    output wire [`BUS_ADDR_WIDTH-1:0] dtcm_raddr_o,
+    input  wire [`BUS_DATA_WIDTH-1:0] dtcm_rdata_i,
+    output wire                       dtcm_we_o,
+    output wire [                3:0] dtcm_wmask_o,
+    output wire [`BUS_ADDR_WIDTH-1:0] dtcm_waddr_o,
+    output wire [`BUS_DATA_WIDTH-1:0] dtcm_wdata_o,
+
     // 添加系统操作信号输出到顶层
     output wire exu_op_ecall_o,
     output wire exu_op_ebreak_o,
@@ -186,6 +210,9 @@ module exu (
 
     // misaligned_fetch信号输出
     output wire                     misaligned_fetch_o,
+    // 分支实际结果，用于训练分支预测器
+    output wire                        bjp_taken_o,
+    output wire [`INST_ADDR_WIDTH-1:0] bjp_target_o,
     // AXI接口 - 新增
     output wire [`BUS_ID_WIDTH-1:0] M_AXI_AWID,          // 使用BUS_ID_WIDTH定义位宽
     output wire [             31:0] M_AXI_AWADDR,
@@ -297,6 +324,8 @@ module exu (
         .mem_op_lhu_i  (mem_op_lhu_i),
         .mem_op_load_i (mem_op_load_i),
         .mem_op_store_i(mem_op_store_i),
+        .mem_op_amo_i  (mem_op_amo_i),
+        .mem_amo_op_i  (mem_amo_op_i),
         .rd_addr_i     (reg_waddr_i),
         .mem_addr_i    (mem_addr_i),
         .mem_wdata_i   (mem_wdata_i),
@@ -310,6 +339,13 @@ module exu (
         .reg_waddr_o   (lsu_reg_waddr_o),
         .commit_id_o   (lsu_commit_id_o),
 
+        .dtcm_raddr_o  (dtcm_raddr_o),
+        .dtcm_rdata_i  (dtcm_rdata_i),
+        .dtcm_we_o     (dtcm_we_o),
+        .dtcm_wmask_o  (dtcm_wmask_o),
+        .dtcm_waddr_o  (dtcm_waddr_o),
+        .dtcm_wdata_o  (dtcm_wdata_o),
+
         // AXI接口连接
         .M_AXI_AWID   (M_AXI_AWID),
         .M_AXI_AWADDR (M_AXI_AWADDR),
@@ -381,6 +417,31 @@ module exu (
         .alu_result_bypass_o(alu_result_bypass)
     );
 
+    // 双发射第二条指令的ALU，操作数已在分发级读出，不做旁路前递
+    exu_alu u_alu1 (
+        .clk                (clk),
+        .rst_n              (rst_n),
+        .req_alu_i          (dual_req_alu_i),
+        .hazard_stall_i     (hazard_stall_i),
+        .alu_op1_i          (dual_alu_op1_i),
+        .alu_op2_i          (dual_alu_op2_i),
+        .alu_op_info_i      (dual_alu_op_info_i),
+        .alu_rd_i           (dual_reg_waddr_i),
+        .commit_id_i        ({`COMMIT_ID_WIDTH{1'b0}}),
+        .alu_pass_op1_i     (1'b0),
+        .alu_pass_op2_i     (1'b0),
+        .wb_ready_i         (1'b1),
+        .reg_we_i           (dual_reg_we_i),
+        .alu_stall_o        (),
+        .int_assert_i       (int_assert_i),
+        .misaligned_fetch_i (1'b0),
+        .result_o           (dual_reg_wdata_o),
+        .reg_we_o           (dual_reg_we_o),
+        .reg_waddr_o        (dual_reg_waddr_o),
+        .commit_id_o        (),
+        .alu_result_bypass_o()
+    );
+
     // 分支单元模块例化 - 使用从顶层接收的dispatch信号
     exu_bru u_bru (
         .rst_n                (rst_n),
@@ -394,6 +455,7 @@ module exu (
         .bjp_op_bgeu_i        (bjp_op_bgeu_i),
         .bjp_op_jalr_i        (bjp_op_jalr_i),
         .is_pred_branch_i     (is_pred_branch_i),       // 新增：预测分支指令标志输入
+        .pred_addr_i          (pred_addr_i),
         // 新增信号
         .bjp_adder_result_i   (bjp_adder_result_i),
         .bjp_next_pc_i        (bjp_next_pc_i),
@@ -406,7 +468,9 @@ module exu (
         .jump_flag_o          (bru_jump_flag),
         .jump_addr_o          (bru_jump_addr),
         // 新增：连接misaligned_fetch信号
-        .misaligned_fetch_o   (misaligned_fetch_bru)
+        .misaligned_fetch_o   (misaligned_fetch_bru),
+        .bjp_taken_o          (bjp_taken_o),
+        .bjp_target_o         (bjp_target_o)
     );
 
     // CSR处理单元模块例化
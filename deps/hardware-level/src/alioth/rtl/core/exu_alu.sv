@@ -78,22 +78,85 @@ module exu_alu (
     wire        op_auipc = alu_op_info_i[`ALU_OP_AUIPC];
     wire        op_jump = alu_op_info_i[`ALU_OP_JUMP];
 
+    // 位操作(Zba/Zbb/Zbs)类型，BITMANIP_EN为0时译码级不会产生非零编码
+    wire [`BMU_OP_WIDTH-1:0] bmu_op = alu_op_info_i[`ALU_OP_BMUOP];
+    wire        op_sh1add = (bmu_op == `BMU_OP_SH1ADD);
+    wire        op_sh2add = (bmu_op == `BMU_OP_SH2ADD);
+    wire        op_sh3add = (bmu_op == `BMU_OP_SH3ADD);
+    wire        op_andn = (bmu_op == `BMU_OP_ANDN);
+    wire        op_orn = (bmu_op == `BMU_OP_ORN);
+    wire        op_xnor = (bmu_op == `BMU_OP_XNOR);
+    wire        op_clz = (bmu_op == `BMU_OP_CLZ);
+    wire        op_ctz = (bmu_op == `BMU_OP_CTZ);
+    wire        op_cpop = (bmu_op == `BMU_OP_CPOP);
+    wire        op_min = (bmu_op == `BMU_OP_MIN);
+    wire        op_max = (bmu_op == `BMU_OP_MAX);
+    wire        op_minu = (bmu_op == `BMU_OP_MINU);
+    wire        op_maxu = (bmu_op == `BMU_OP_MAXU);
+    wire        op_sext_b = (bmu_op == `BMU_OP_SEXTB);
+    wire        op_sext_h = (bmu_op == `BMU_OP_SEXTH);
+    wire        op_zext_h = (bmu_op == `BMU_OP_ZEXTH);
+    wire        op_rol = (bmu_op == `BMU_OP_ROL);
+    wire        op_ror = (bmu_op == `BMU_OP_ROR);
+    wire        op_rev8 = (bmu_op == `BMU_OP_REV8);
+    wire        op_orc_b = (bmu_op == `BMU_OP_ORCB);
+    wire        op_bclr = (bmu_op == `BMU_OP_BCLR);
+    wire        op_bset = (bmu_op == `BMU_OP_BSET);
+    wire        op_binv = (bmu_op == `BMU_OP_BINV);
+    wire        op_bext = (bmu_op == `BMU_OP_BEXT);
+
     // 指令分类信号 - 便于复用运算器
     wire        op_addsub = op_add | op_sub;  // 加减法操作
     wire        op_shift = op_sll | op_srl | op_sra;  // 移位操作
     wire        op_logic = op_xor | op_or | op_and;  // 逻辑操作
     wire        op_compare = op_slt | op_sltu;  // 比较操作
     wire        op_mvop2 = op_lui;  // 直接使用操作数2
+    wire        op_shadd = op_sh1add | op_sh2add | op_sh3add;  // 移位加(Zba)
+    wire        op_minmax = op_min | op_max | op_minu | op_maxu;  // 最值，复用比较
+    wire        op_rotate = op_rol | op_ror;  // 循环移位，复用移位器
+    wire        op_count = op_clz | op_ctz;  // 前导/末尾零计数
+
+    // 32位按位翻转
+    function automatic [31:0] bit_rev32(input [31:0] x);
+        integer i;
+        begin
+            for (i = 0; i < 32; i = i + 1) bit_rev32[i] = x[31-i];
+        end
+    endfunction
+
+    // 末尾零个数，全零时为32
+    function automatic [5:0] count_tz32(input [31:0] x);
+        integer i;
+        begin
+            count_tz32 = 6'd32;
+            for (i = 31; i >= 0; i = i - 1) if (x[i]) count_tz32 = i[5:0];
+        end
+    endfunction
+
+    // 置位个数
+    function automatic [5:0] count_pop32(input [31:0] x);
+        integer i;
+        begin
+            count_pop32 = 6'd0;
+            for (i = 0; i < 32; i = i + 1) count_pop32 = count_pop32 + {5'b0, x[i]};
+        end
+    endfunction
 
     //////////////////////////////////////////////////////////////
     // 1. 实现移位器 - 统一实现左移，右移通过输入翻转实现
+    //    输入拼接为64位后左移，高32位即为循环左移结果
     //////////////////////////////////////////////////////////////
     wire [31:0] shifter_in1;
     wire [ 4:0] shifter_in2;
     wire [31:0] shifter_res;
+    wire [63:0] shifter_res_dw;
+
+    // 移位器使用者：基本移位、循环移位、单比特提取(bext按右移取最低位)
+    wire shifter_op = op_shift | op_rotate | op_bext;
+    wire shifter_rev = op_sra | op_srl | op_ror | op_bext;
 
     // 为右移操作翻转输入位
-    assign shifter_in1 = {32{op_shift}} & ((op_sra | op_srl) ? {  // 输入位反转
+    assign shifter_in1 = {32{shifter_op}} & (shifter_rev ? {  // 输入位反转
         mux_op1[00],mux_op1[01],mux_op1[02],mux_op1[03],
             mux_op1[04],mux_op1[05],mux_op1[06],mux_op1[07],
             mux_op1[08],mux_op1[09],mux_op1[10],mux_op1[11],
@@ -105,10 +168,11 @@ module exu_alu (
         } : mux_op1
     );
 
-    assign shifter_in2 = {5{op_shift}} & mux_op2[4:0];
+    assign shifter_in2 = {5{shifter_op}} & mux_op2[4:0];
 
     // 执行左移操作
-    assign shifter_res = (shifter_in1 << shifter_in2);
+    assign shifter_res_dw = {shifter_in1, shifter_in1} << shifter_in2;
+    assign shifter_res = shifter_res_dw[31:0];
 
     // 左移结果
     wire [31:0] sll_res = shifter_res;
@@ -153,6 +217,10 @@ module exu_alu (
     wire [31:0] shift_mask = ~(32'hffffffff >> shifter_in2);
     wire [31:0] sra_res = (srl_res & (~shift_mask)) | ({32{mux_op1[31]}} & shift_mask);
 
+    // 循环移位结果 - 循环右移同样通过翻转实现
+    wire [31:0] rol_res = shifter_res_dw[63:32];
+    wire [31:0] ror_res = bit_rev32(shifter_res_dw[63:32]);
+
     //////////////////////////////////////////////////////////////
     // 2. 实现加减法器 - 统一处理加减法和比较操作
     //////////////////////////////////////////////////////////////
@@ -165,13 +233,19 @@ module exu_alu (
     wire op_unsigned = op_sltu;
 
     // 加减法操作 - 复用于加减法、比较、地址计算等
-    wire adder_op = op_addsub | op_compare | op_auipc | op_jump;
+    wire adder_op = op_addsub | op_compare | op_auipc | op_jump | op_shadd | op_minmax;
+    wire adder_sub = op_sub | op_compare | op_minmax;
+
+    // 移位加：rs1左移1/2/3位后与rs2相加
+    wire [31:0] shadd_op1 = ({32{op_sh1add}} & {mux_op1[30:0], 1'b0}) |
+                            ({32{op_sh2add}} & {mux_op1[29:0], 2'b0}) |
+                            ({32{op_sh3add}} & {mux_op1[28:0], 3'b0});
 
     // 操作数选择 - 使用门控优化
     // 无符号操作时不进行符号扩展
-    assign adder_in1 = {32{adder_op}} & mux_op1;
-    assign adder_in2 = {32{adder_op}} & (op_sub | op_compare ? ~mux_op2 : mux_op2);
-    assign adder_cin = adder_op & (op_sub | op_compare);
+    assign adder_in1 = {32{adder_op}} & (op_shadd ? shadd_op1 : mux_op1);
+    assign adder_in2 = {32{adder_op}} & (adder_sub ? ~mux_op2 : mux_op2);
+    assign adder_cin = adder_op & adder_sub;
 
     // 执行加法运算
     assign adder_res = {1'b0, adder_in1} + {1'b0, adder_in2} + {{32{1'b0}}, adder_cin};
@@ -182,6 +256,9 @@ module exu_alu (
     wire [31:0] xor_res = {32{op_xor}} & (mux_op1 ^ mux_op2);
     wire [31:0] or_res = {32{op_or}} & (mux_op1 | mux_op2);
     wire [31:0] and_res = {32{op_and}} & (mux_op1 & mux_op2);
+    wire [31:0] andn_res = {32{op_andn}} & (mux_op1 & ~mux_op2);
+    wire [31:0] orn_res = {32{op_orn}} & (mux_op1 | ~mux_op2);
+    wire [31:0] xnor_res = {32{op_xnor}} & ~(mux_op1 ^ mux_op2);
 
     //////////////////////////////////////////////////////////////
     // 4. 实现比较运算结果
@@ -214,7 +291,33 @@ module exu_alu (
     wire [31:0] lui_res = mux_op2;
 
     //////////////////////////////////////////////////////////////
-    // 6. 结果选择器 - 根据操作类型选择最终结果
+    // 6. 位操作结果 - 最值复用比较结果，其余为独立的组合逻辑
+    //////////////////////////////////////////////////////////////
+    // 最值：op1 < op2 时min取op1，max取op2
+    wire minmax_lt = (op_minu | op_maxu) ? is_lt_unsigned : is_lt_signed;
+    wire minmax_sel_op1 = minmax_lt ^ (op_max | op_maxu);
+    wire [31:0] minmax_res = minmax_sel_op1 ? mux_op1 : mux_op2;
+
+    // 前导零由末尾零计数器对翻转后的操作数计算
+    wire [31:0] count_in = {32{op_count}} & (op_clz ? bit_rev32(mux_op1) : mux_op1);
+    wire [31:0] count_res = {26'b0, count_tz32(count_in)};
+    wire [31:0] cpop_res = {26'b0, count_pop32({32{op_cpop}} & mux_op1)};
+
+    wire [31:0] sext_b_res = {{24{mux_op1[7]}}, mux_op1[7:0]};
+    wire [31:0] sext_h_res = {{16{mux_op1[15]}}, mux_op1[15:0]};
+    wire [31:0] zext_h_res = {16'b0, mux_op1[15:0]};
+    wire [31:0] rev8_res = {mux_op1[7:0], mux_op1[15:8], mux_op1[23:16], mux_op1[31:24]};
+    wire [31:0] orc_b_res = {{8{|mux_op1[31:24]}}, {8{|mux_op1[23:16]}}, {8{|mux_op1[15:8]}}, {8{|mux_op1[7:0]}}};
+
+    // 单比特操作，位序号取op2低5位
+    wire [31:0] bit_mask = 32'h1 << mux_op2[4:0];
+    wire [31:0] bclr_res = mux_op1 & ~bit_mask;
+    wire [31:0] bset_res = mux_op1 | bit_mask;
+    wire [31:0] binv_res = mux_op1 ^ bit_mask;
+    wire [31:0] bext_res = {31'b0, srl_res[0]};
+
+    //////////////////////////////////////////////////////////////
+    // 7. 结果选择器 - 根据操作类型选择最终结果
     //////////////////////////////////////////////////////////////
     wire [31:0] alu_res =
         ({32{int_assert_i == `INT_ASSERT}} & 32'h0) |
@@ -229,7 +332,25 @@ module exu_alu (
         ({32{op_sra}} & sra_res) |
         ({32{op_slt}} & slt_res) |
         ({32{op_sltu}} & sltu_res) |
-        ({32{op_lui}} & lui_res);
+        ({32{op_lui}} & lui_res) |
+        ({32{op_shadd}} & adder_res[31:0]) |
+        ({32{op_andn}} & andn_res) |
+        ({32{op_orn}} & orn_res) |
+        ({32{op_xnor}} & xnor_res) |
+        ({32{op_minmax}} & minmax_res) |
+        ({32{op_count}} & count_res) |
+        ({32{op_cpop}} & cpop_res) |
+        ({32{op_sext_b}} & sext_b_res) |
+        ({32{op_sext_h}} & sext_h_res) |
+        ({32{op_zext_h}} & zext_h_res) |
+        ({32{op_rol}} & rol_res) |
+        ({32{op_ror}} & ror_res) |
+        ({32{op_rev8}} & rev8_res) |
+        ({32{op_orc_b}} & orc_b_res) |
+        ({32{op_bclr}} & bclr_res) |
+        ({32{op_bset}} & bset_res) |
+        ({32{op_binv}} & binv_res) |
+        ({32{op_bext}} & bext_res);
 
     // 所有算术逻辑操作都需要写回寄存器
     // 如果misaligned_fetch_i为1，则忽略op_jump
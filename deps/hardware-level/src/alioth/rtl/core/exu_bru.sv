@@ -37,6 +37,7 @@ module exu_bru (
     input wire        bjp_op_bgeu_i,
     input wire        bjp_op_jalr_i,    // JALR指令标志
     input wire        is_pred_branch_i, // 前级是否进行了分支预测
+    input wire [31:0] pred_addr_i,      // 前级预测的跳转目标(JALR校验用)
 
     input wire [31:0] bjp_adder_result_i,
     input wire [31:0] bjp_next_pc_i,
@@ -53,7 +54,10 @@ module exu_bru (
     output wire                        jump_flag_o,
     output wire [`INST_ADDR_WIDTH-1:0] jump_addr_o,
     // 新增：非对齐跳转信号
-    output wire                        misaligned_fetch_o
+    output wire                        misaligned_fetch_o,
+    // 分支实际结果，用于训练分支预测器
+    output wire                        bjp_taken_o,
+    output wire [`INST_ADDR_WIDTH-1:0] bjp_target_o
 );
     // 内部信号
     wire        jump_flag;
@@ -80,16 +84,26 @@ module exu_bru (
     // JALR目标地址需要清除最低位
     assign jalr_target_addr = (bjp_adder_result_i & ~32'h1);
 
+    // JALR预测了目标但与实际目标不一致，需要跳转到实际目标
+    wire jalr_pred_miss = is_pred_branch_i & req_bjp_i & bjp_op_jalr_i &
+                          (jalr_target_addr != pred_addr_i);
+
     // 跳转标志判断，增加预测回退条件
-    assign jump_flag = (branch_cond & ~is_pred_branch_i) | sys_op_fence_i | pred_rollback;
+    assign jump_flag = (branch_cond & ~is_pred_branch_i) | sys_op_fence_i | pred_rollback |
+                       jalr_pred_miss;
 
     // 跳转地址选择逻辑
     assign jump_addr_o = (sys_op_fence_i || pred_rollback) ? bjp_next_pc_i :
                          (bjp_op_jalr_i ? jalr_target_addr : bjp_adder_result_i);
 
     // 非对齐跳转判断（跳转地址低2位非0）
-    assign misaligned_fetch_o = ((jump_addr_o[1:0] != 2'b00) && (jump_flag || bjp_op_jal_i));
+    // 支持压缩指令时跳转目标只需半字对齐
+    wire [1:0] fetch_align_mask = (`RVC_EN != 0) ? 2'b01 : 2'b11;
+    assign misaligned_fetch_o = (((jump_addr_o[1:0] & fetch_align_mask) != 2'b00) && (jump_flag || bjp_op_jal_i));
+
+    assign jump_flag_o = jump_flag & ~misaligned_fetch_o & ~int_assert_i;
 
-    assign jump_flag_o = jump_flag & ~misaligned_fetch_o & ~int_assert_i;  // 跳转标志输出，排除预测回退情况，并屏蔽中断
+    assign bjp_taken_o = branch_cond | bjp_op_jal_i;
+    assign bjp_target_o = bjp_op_jalr_i ? jalr_target_addr : bjp_adder_result_i;  // 跳转标志输出，排除预测回退情况，并屏蔽中断
 
 endmodule
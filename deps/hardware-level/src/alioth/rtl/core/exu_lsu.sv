@@ -48,13 +48,15 @@ module exu_lsu #(
 
     input wire       mem_op_load_i,
     input wire       mem_op_store_i,
+    input wire       mem_op_amo_i,
+    input wire [4:0] mem_amo_op_i,
     input wire [4:0] rd_addr_i,
 
     // 新增的输入信号，直接提供写数据相关信号
     input wire [               31:0] mem_addr_i,
     input wire [`REG_DATA_WIDTH-1:0] mem_wdata_i,
 
-    input wire [3:0] mem_wmask_i,
+    input wire [7:0] mem_wmask_i,  // [7:4]非零表示store跨字，需拆成两次写入
 
     input wire [`COMMIT_ID_WIDTH-1:0] commit_id_i,
 
@@ -74,6 +76,14 @@ module exu_lsu #(
 
     output wire [`COMMIT_ID_WIDTH-1:0] commit_id_o,
 
+    // DTCM直连访存端口，读地址当拍给出、数据下一拍有效，写入当拍完成
+    output wire [                  31:0] dtcm_raddr_o,
+    input  wire [C_M_AXI_DATA_WIDTH-1:0] dtcm_rdata_i,
+    output wire                          dtcm_we_o,
+    output wire [                   3:0] dtcm_wmask_o,
+    output wire [                  31:0] dtcm_waddr_o,
+    output wire [C_M_AXI_DATA_WIDTH-1:0] dtcm_wdata_o,
+
     // AXI Master接口
     // 写地址通道
     output wire [    C_M_AXI_ID_WIDTH-1:0] M_AXI_AWID,
@@ -154,10 +164,12 @@ module exu_lsu #(
     reg input_fifo_mem_op_lhu[0:INPUT_FIFO_DEPTH-1];
     reg input_fifo_mem_op_load[0:INPUT_FIFO_DEPTH-1];
     reg input_fifo_mem_op_store[0:INPUT_FIFO_DEPTH-1];
+    reg input_fifo_mem_op_amo[0:INPUT_FIFO_DEPTH-1];
+    reg [4:0] input_fifo_mem_amo_op[0:INPUT_FIFO_DEPTH-1];
     reg [4:0] input_fifo_rd_addr[0:INPUT_FIFO_DEPTH-1];
     reg [31:0] input_fifo_mem_addr[0:INPUT_FIFO_DEPTH-1];
     reg [31:0] input_fifo_mem_wdata[0:INPUT_FIFO_DEPTH-1];
-    reg [3:0] input_fifo_mem_wmask[0:INPUT_FIFO_DEPTH-1];
+    reg [7:0] input_fifo_mem_wmask[0:INPUT_FIFO_DEPTH-1];
     reg [`COMMIT_ID_WIDTH-1:0] input_fifo_commit_id[0:INPUT_FIFO_DEPTH-1];
 
     // 输入FIFO状态信号
@@ -190,16 +202,33 @@ module exu_lsu #(
     wire effective_mem_op_ldh_i = 1'b0;
     wire effective_mem_op_load_i = input_fifo_empty ? mem_op_load_i : input_fifo_mem_op_load[input_fifo_rd_ptr];
     wire effective_mem_op_store_i = input_fifo_empty ? mem_op_store_i : input_fifo_mem_op_store[input_fifo_rd_ptr];
+    wire effective_mem_op_amo_i = input_fifo_empty ? mem_op_amo_i : input_fifo_mem_op_amo[input_fifo_rd_ptr];
+    wire [4:0] effective_mem_amo_op_i = input_fifo_empty ? mem_amo_op_i : input_fifo_mem_amo_op[input_fifo_rd_ptr];
     wire [4:0] effective_rd_addr_i = input_fifo_empty ? rd_addr_i : input_fifo_rd_addr[input_fifo_rd_ptr];
     wire [31:0] effective_mem_addr_i = input_fifo_empty ? mem_addr_i : input_fifo_mem_addr[input_fifo_rd_ptr];
     wire [31:0] effective_mem_wdata_i = input_fifo_empty ? mem_wdata_i : input_fifo_mem_wdata[input_fifo_rd_ptr];
-    wire [3:0] effective_mem_wmask_i = input_fifo_empty ? mem_wmask_i : input_fifo_mem_wmask[input_fifo_rd_ptr];
+    wire [7:0] effective_mem_wmask_i = input_fifo_empty ? mem_wmask_i : input_fifo_mem_wmask[input_fifo_rd_ptr];
     wire [`COMMIT_ID_WIDTH-1:0] effective_commit_id_i = input_fifo_empty ? commit_id_i : input_fifo_commit_id[input_fifo_rd_ptr];
 
-    // 输入FIFO控制逻辑 - 简化为普通请求处理
-    wire input_request_accepted = effective_req_mem_i && !int_assert_i &&
-                                  ((effective_mem_op_load_i && M_AXI_ARVALID && M_AXI_ARREADY) ||
-                                   (effective_mem_op_store_i && M_AXI_AWVALID && M_AXI_AWREADY));
+    // 存储缓冲接收、load前递命中与DTCM直连访问信号，定义见下方
+    wire sb_push;
+    wire ld_fwd_fire;
+    wire dtcm_ld_fire;
+    wire dtcm_st_fire;
+    wire amo_done;
+    wire ma_ld;
+    wire ma_st;
+    wire ma_ld_done;
+    wire ma_st_done;
+
+    // 输入FIFO控制逻辑 - load在AR握手、前递命中或DTCM直连读发出时完成，
+    // store进入存储缓冲或直接写入DTCM即完成；原子操作在整个读-改-写序列结束后才弹出，
+    // 序列一旦开始即不受中断请求打断
+    // 非对齐load/store同样在拆分出的两次访问都完成后才弹出
+    wire input_request_accepted = (effective_req_mem_i && !int_assert_i && !ma_ld && !ma_st &&
+                                   ((effective_mem_op_load_i && ((M_AXI_ARVALID && M_AXI_ARREADY) || ld_fwd_fire || dtcm_ld_fire)) ||
+                                    (effective_mem_op_store_i && (sb_push || dtcm_st_fire)))) ||
+                                  amo_done || ma_ld_done || ma_st_done;
 
     // 推入条件：所有指令都按32位指令处理
     wire should_push_input_fifo = req_mem_i && !int_assert_i && input_fifo_wr_allow && 
@@ -236,12 +265,6 @@ module exu_lsu #(
     reg [FIFO_CNT_WIDTH-1:0] read_fifo_count;
     reg  [            1:0] read_fifo_op;    // FIFO操作码：00-无操作，01-只弹出，10-只推入，11-同时推入弹出
 
-    // 写FIFO计数器和状态
-    reg [FIFO_PTR_WIDTH-1:0] write_fifo_wr_ptr;
-    reg [FIFO_PTR_WIDTH-1:0] write_fifo_rd_ptr;
-    reg [FIFO_CNT_WIDTH-1:0] write_fifo_count;
-    reg  [            1:0] write_fifo_op;   // FIFO操作码：00-无操作，01-只弹出，10-只推入，11-同时推入弹出
-
     // 读取请求FIFO数组 - 改为reg类型
     reg read_fifo_mem_op_lb[0:FIFO_DEPTH-1];
     reg read_fifo_mem_op_lh[0:FIFO_DEPTH-1];
@@ -252,10 +275,6 @@ module exu_lsu #(
     reg [1:0] read_fifo_mem_addr_index[0:FIFO_DEPTH-1];
     reg [`COMMIT_ID_WIDTH-1:0] read_fifo_commit_id[0:FIFO_DEPTH-1];
 
-    // 写请求FIFO数组 - 改为reg类型
-    reg [31:0] write_fifo_data[0:FIFO_DEPTH-1];
-    reg [3:0] write_fifo_strb[0:FIFO_DEPTH-1];
-
     // 输出寄存器 - 改为reg类型
     reg [31:0] current_reg_wdata_r;
     reg reg_write_valid_r;
@@ -265,45 +284,376 @@ module exu_lsu #(
     // 读写FIFO状态信号
     wire read_fifo_empty;
     wire read_fifo_full;
-    wire write_fifo_empty;
-    wire write_fifo_full;
     wire read_fifo_wr_allow;  // 允许写入
     wire read_fifo_rd_allow;  // 允许读取
-    wire write_fifo_wr_allow;  // 允许写入
-    wire write_fifo_rd_allow;  // 允许读取
 
     // FIFO状态计算 - 使用计数器
     assign read_fifo_empty     = (read_fifo_count == {FIFO_CNT_WIDTH{1'b0}});
     assign read_fifo_full      = (read_fifo_count == FIFO_DEPTH[FIFO_CNT_WIDTH-1:0]);
-    assign write_fifo_empty    = (write_fifo_count == {FIFO_CNT_WIDTH{1'b0}});
-    assign write_fifo_full     = (write_fifo_count == FIFO_DEPTH[FIFO_CNT_WIDTH-1:0]);
 
     // FIFO保护机制
     assign read_fifo_wr_allow  = !read_fifo_full;
     assign read_fifo_rd_allow  = !read_fifo_empty;
-    assign write_fifo_wr_allow = !write_fifo_full;
-    assign write_fifo_rd_allow = !write_fifo_empty;
 
     // 生成请求有效信号
     assign read_req_valid      = valid_op && is_load_op;
     assign write_req_valid     = valid_op && is_store_op;
 
+    // ==================== 存储缓冲(posted write) ====================
+    // store进入缓冲即视为完成，由缓冲在后台按AW/W/B顺序写出；
+    // 条目保留到收到B响应为止，期间供后续load做地址匹配与前递
+    localparam SB_DEPTH = `LSU_STORE_BUF_DEPTH;
+    localparam SB_PTR_WIDTH = $clog2(SB_DEPTH);
+    localparam SB_CNT_WIDTH = $clog2(SB_DEPTH + 1);
+
+    localparam [31:0] ITCM_BASE = `ITCM_BASE_ADDR;
+    localparam [31:0] DTCM_BASE = `DTCM_BASE_ADDR;
+    localparam [31:0] XMEM_BASE = `XMEM_BASE_ADDR;
+
+    reg  [            31:0] sb_addr             [0:SB_DEPTH-1];
+    reg  [            31:0] sb_data             [0:SB_DEPTH-1];
+    reg  [             3:0] sb_strb             [0:SB_DEPTH-1];
+    reg  [SB_PTR_WIDTH-1:0] sb_wr_ptr;  // 新条目写入位置
+    reg  [SB_PTR_WIDTH-1:0] sb_iss_ptr;  // 下一个待发出AW/W的条目
+    reg  [SB_PTR_WIDTH-1:0] sb_rd_ptr;  // 最老的等待B响应的条目
+    reg  [SB_CNT_WIDTH-1:0] sb_count;  // 有效条目数(含已发出未响应)
+    reg  [SB_CNT_WIDTH-1:0] sb_infl;  // 已发出AW/W、等待B响应的条目数
+    reg                     sb_aw_done;  // 当前条目AW已握手
+    reg                     sb_w_done;  // 当前条目W已握手
+
+    wire                    sb_empty = (sb_count == {SB_CNT_WIDTH{1'b0}});
+    wire                    sb_full = (sb_count == SB_DEPTH[SB_CNT_WIDTH-1:0]);
+    wire                    sb_pend = (sb_count != sb_infl);  // 尚有未发出的条目
+
+    // AW与W同拍给出，二者分别握手后该条目即发出完毕
+    wire                    sb_aw_ok = sb_aw_done || (M_AXI_AWVALID && M_AXI_AWREADY);
+    wire                    sb_w_ok = sb_w_done || (M_AXI_WVALID && M_AXI_WREADY);
+    wire                    sb_issue = sb_pend && sb_aw_ok && sb_w_ok;
+    wire                    sb_bresp = M_AXI_BVALID && M_AXI_BREADY && !sb_empty;
+
+    // ==================== DTCM直连端口 ====================
+    // DTCM地址范围内的访存不经AXI互联：store当拍写入SRAM，load下一拍返回数据；
+    // DTCM的store不进入存储缓冲，因此缓冲中的条目不会与DTCM的load重叠
+    wire dtcm_hit = (`DTCM_DIRECT_PORT != 0) &&
+                    (effective_mem_addr_i[31:`DTCM_ADDR_WIDTH] == DTCM_BASE[31:`DTCM_ADDR_WIDTH]);
+
+    reg  dtcm_rd_pend;  // 上一拍发出了DTCM读，本拍返回数据
+
+    assign sb_push = write_req_valid && !dtcm_hit && !sb_full;
+
+    // 存储器区域(ITCM/DTCM/XMEM)的load可越过缓冲中的store先行读取；
+    // 外设区域的load需等待缓冲排空，保证对设备寄存器的访问顺序
+    wire ld_is_mem = (effective_mem_addr_i[31:`ITCM_ADDR_WIDTH] == ITCM_BASE[31:`ITCM_ADDR_WIDTH]) ||
+                     (effective_mem_addr_i[31:`DTCM_ADDR_WIDTH] == DTCM_BASE[31:`DTCM_ADDR_WIDTH]) ||
+                     (effective_mem_addr_i[31:`XMEM_ADDR_WIDTH] == XMEM_BASE[31:`XMEM_ADDR_WIDTH]);
+
+    // load访问的字节掩码，按地址低2位左移成8位，[7:4]非零表示跨字
+    wire [7:0] ld_mask8 = ({8{effective_mem_op_lb_i | effective_mem_op_lbu_i}} & (8'b0000_0001 << mem_addr_index)) |
+                          ({8{effective_mem_op_lh_i | effective_mem_op_lhu_i}} & (8'b0000_0011 << mem_addr_index)) |
+                          ({8{effective_mem_op_lw_i}} & (8'b0000_1111 << mem_addr_index));
+    wire [3:0] ld_mask = ld_mask8[3:0];
+
+    // 跨字的非对齐访问(AGU在LSU_MISALIGNED_EN为0时已报异常，不会送到这里)
+    assign ma_ld = (`LSU_MISALIGNED_EN != 0) && read_req_valid && (ld_mask8[7:4] != 4'b0);
+    assign ma_st = (`LSU_MISALIGNED_EN != 0) && write_req_valid && (effective_mem_wmask_i[7:4] != 4'b0);
+
+    // 按字节从老到新合并同一字地址的缓冲条目，得到每个字节最新的store数据
+    reg  [             3:0] fwd_bvalid;
+    reg  [            31:0] fwd_data;
+    reg  [SB_PTR_WIDTH-1:0] fwd_idx;
+
+    always_comb begin
+        fwd_bvalid = 4'b0;
+        fwd_data   = 32'b0;
+        fwd_idx    = sb_rd_ptr;
+        for (int i = 0; i < SB_DEPTH; i++) begin
+            if ((i < sb_count) && (sb_addr[fwd_idx][31:2] == effective_mem_addr_i[31:2])) begin
+                for (int b = 0; b < 4; b++) begin
+                    if (sb_strb[fwd_idx][b]) begin
+                        fwd_bvalid[b]     = 1'b1;
+                        fwd_data[b*8+:8] = sb_data[fwd_idx][b*8+:8];
+                    end
+                end
+            end
+            fwd_idx = fwd_idx + 1'b1;
+        end
+    end
+
+    // 与缓冲重叠的load：字节被完全覆盖时直接前递(需读FIFO为空以保持写回顺序)，否则等待对应store写出
+    wire ld_sb_hit = |(fwd_bvalid & ld_mask);
+    wire ld_fwd_ok = (`LSU_STORE_FWD != 0) && ld_is_mem && read_fifo_empty && !dtcm_rd_pend &&
+                     ((fwd_bvalid & ld_mask) == ld_mask);
+    wire ld_sb_block = ld_sb_hit || (!ld_is_mem && !sb_empty);
+
+    assign ld_fwd_fire = read_req_valid && !ma_ld && ld_sb_hit && ld_fwd_ok;
+
+    // DTCM直连读：需读FIFO为空，保证与AXI读返回不在同一拍写回
+    reg                         dtcm_rd_lb;
+    reg                         dtcm_rd_lh;
+    reg                         dtcm_rd_lw;
+    reg                         dtcm_rd_lbu;
+    reg                         dtcm_rd_lhu;
+    reg  [                 1:0] dtcm_rd_addr_index;
+    reg  [ `REG_ADDR_WIDTH-1:0] dtcm_rd_rd_addr;
+    reg  [`COMMIT_ID_WIDTH-1:0] dtcm_rd_commit_id;
+
+    assign dtcm_ld_fire = read_req_valid && !ma_ld && dtcm_hit && read_fifo_empty && !ld_sb_block;
+    assign dtcm_st_fire = write_req_valid && dtcm_hit;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            dtcm_rd_pend       <= 1'b0;
+            dtcm_rd_lb         <= 1'b0;
+            dtcm_rd_lh         <= 1'b0;
+            dtcm_rd_lw         <= 1'b0;
+            dtcm_rd_lbu        <= 1'b0;
+            dtcm_rd_lhu        <= 1'b0;
+            dtcm_rd_addr_index <= 2'b0;
+            dtcm_rd_rd_addr    <= {`REG_ADDR_WIDTH{1'b0}};
+            dtcm_rd_commit_id  <= {`COMMIT_ID_WIDTH{1'b0}};
+        end else begin
+            dtcm_rd_pend <= dtcm_ld_fire;
+            if (dtcm_ld_fire) begin
+                dtcm_rd_lb         <= effective_mem_op_lb_i;
+                dtcm_rd_lh         <= effective_mem_op_lh_i;
+                dtcm_rd_lw         <= effective_mem_op_lw_i;
+                dtcm_rd_lbu        <= effective_mem_op_lbu_i;
+                dtcm_rd_lhu        <= effective_mem_op_lhu_i;
+                dtcm_rd_addr_index <= mem_addr_index;
+                dtcm_rd_rd_addr    <= effective_rd_addr_i;
+                dtcm_rd_commit_id  <= effective_commit_id_i;
+            end
+        end
+    end
+
+    // ==================== A扩展原子操作 ====================
+    // LR/SC/AMO在队首等待存储缓冲排空、在途读全部返回后独占执行：AMO读出旧值即写回rd，
+    // 再把运算结果写回存储器，序列结束才弹出队首，后续访存不会插入读写之间；
+    // 经AXI访问时AR/AW置LOCK，标识这是一次独占的读-改-写序列
+    localparam AMO_IDLE = 3'd0;
+    localparam AMO_AR = 3'd1;  // 发出读地址
+    localparam AMO_RD = 3'd2;  // 等待读数据(DTCM为下一拍)
+    localparam AMO_WR = 3'd3;  // 写回存储器：DTCM当拍写入，AXI发出AW/W
+    localparam AMO_B = 3'd4;  // 等待AXI写响应
+
+    reg  [ 2:0] amo_state;
+    reg         amo_dtcm;  // 本次序列经DTCM直连端口访问
+    reg  [31:0] amo_wdata;  // 待写回存储器的值
+    reg         amo_aw_done;
+    reg         amo_w_done;
+    reg         resv_valid;  // LR保留有效
+    reg  [29:0] resv_addr;  // LR保留的字地址
+
+    wire        amo_is_lr = (effective_mem_amo_op_i == `INST_LR);
+    wire        amo_is_sc = (effective_mem_amo_op_i == `INST_SC);
+    wire        resv_hit = resv_valid && (resv_addr == effective_mem_addr_i[31:2]);
+
+    // 之前的访存全部完成后开始；SC未命中保留时不访存，当拍以rd=1完成
+    wire        amo_start = valid_op && effective_mem_op_amo_i && (amo_state == AMO_IDLE) &&
+                            sb_empty && read_fifo_empty && !dtcm_rd_pend;
+    wire        sc_fail = amo_start && amo_is_sc && !resv_hit;
+
+    wire        amo_rvalid = (amo_state == AMO_RD) && (amo_dtcm || M_AXI_RVALID);
+    wire [31:0] amo_rdata = amo_dtcm ? dtcm_rdata_i : M_AXI_RDATA;
+    wire        amo_axi_ar = (amo_state == AMO_AR);
+    wire        amo_axi_rd = (amo_state == AMO_RD) && !amo_dtcm;
+    wire        amo_axi_wr = (amo_state == AMO_WR) && !amo_dtcm;
+    wire        amo_dtcm_we = (amo_state == AMO_WR) && amo_dtcm;
+    wire        amo_aw_ok = amo_aw_done || (M_AXI_AWVALID && M_AXI_AWREADY);
+    wire        amo_w_ok = amo_w_done || (M_AXI_WVALID && M_AXI_WREADY);
+
+    assign amo_done = sc_fail || (amo_rvalid && amo_is_lr) || amo_dtcm_we ||
+                      ((amo_state == AMO_B) && M_AXI_BVALID);
+
+    // rd写回：LR/AMO在读数据返回时写回旧值，SC在序列结束时写回成功(0)/失败(1)
+    wire        amo_wb = ((amo_rvalid && !amo_is_sc) || (amo_done && amo_is_sc)) &&
+                         (effective_rd_addr_i != `ZeroReg);
+    wire [31:0] amo_wb_data = amo_is_sc ? {31'b0, sc_fail} : amo_rdata;
+
+    // 读-改-写运算，rs2经AGU的写数据通路送入
+    wire [31:0] amo_src = effective_mem_wdata_i;
+    reg  [31:0] amo_result;
+
+    always_comb begin
+        case (effective_mem_amo_op_i)
+            `INST_AMOSWAP: amo_result = amo_src;
+            `INST_AMOADD:  amo_result = amo_rdata + amo_src;
+            `INST_AMOXOR:  amo_result = amo_rdata ^ amo_src;
+            `INST_AMOAND:  amo_result = amo_rdata & amo_src;
+            `INST_AMOOR:   amo_result = amo_rdata | amo_src;
+            `INST_AMOMIN:  amo_result = ($signed(amo_rdata) < $signed(amo_src)) ? amo_rdata : amo_src;
+            `INST_AMOMAX:  amo_result = ($signed(amo_rdata) > $signed(amo_src)) ? amo_rdata : amo_src;
+            `INST_AMOMINU: amo_result = (amo_rdata < amo_src) ? amo_rdata : amo_src;
+            `INST_AMOMAXU: amo_result = (amo_rdata > amo_src) ? amo_rdata : amo_src;
+            default:       amo_result = amo_src;
+        endcase
+    end
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            amo_state   <= AMO_IDLE;
+            amo_dtcm    <= 1'b0;
+            amo_wdata   <= 32'b0;
+            amo_aw_done <= 1'b0;
+            amo_w_done  <= 1'b0;
+            resv_valid  <= 1'b0;
+            resv_addr   <= 30'b0;
+        end else begin
+            case (amo_state)
+                AMO_IDLE: begin
+                    if (amo_start && !sc_fail) begin
+                        amo_dtcm  <= dtcm_hit;
+                        amo_wdata <= amo_src;  // SC直接写入rs2
+                        amo_state <= amo_is_sc ? AMO_WR : (dtcm_hit ? AMO_RD : AMO_AR);
+                    end
+                end
+                AMO_AR: begin
+                    if (M_AXI_ARREADY) amo_state <= AMO_RD;
+                end
+                AMO_RD: begin
+                    if (amo_rvalid) begin
+                        amo_wdata <= amo_result;
+                        amo_state <= amo_is_lr ? AMO_IDLE : AMO_WR;
+                    end
+                end
+                AMO_WR: begin
+                    if (amo_dtcm || (amo_aw_ok && amo_w_ok)) begin
+                        amo_aw_done <= 1'b0;
+                        amo_w_done  <= 1'b0;
+                        amo_state   <= amo_dtcm ? AMO_IDLE : AMO_B;
+                    end else begin
+                        amo_aw_done <= amo_aw_ok;
+                        amo_w_done  <= amo_w_ok;
+                    end
+                end
+                AMO_B: begin
+                    if (M_AXI_BVALID) amo_state <= AMO_IDLE;
+                end
+                default: amo_state <= AMO_IDLE;
+            endcase
+
+            // 任何SC都清除保留；进入异常/中断处理时也清除，使被打断的LR/SC序列重试
+            if (int_assert_i || (amo_start && amo_is_sc)) begin
+                resv_valid <= 1'b0;
+            end else if (amo_rvalid && amo_is_lr) begin
+                resv_valid <= 1'b1;
+                resv_addr  <= effective_mem_addr_i[31:2];
+            end
+        end
+    end
+
+    // ==================== 非对齐访存拆分 ====================
+    // 跨字的store拆成两个对齐的写条目依次送入存储缓冲(或DTCM)，第二个条目写入后弹出队首；
+    // 跨字的load与原子操作一样在队首等待之前的访存全部完成，再依次读出两个字，
+    // 拼接后按原地址偏移取出数据写回，两次读之间不插入其他访存
+    localparam MA_IDLE = 3'd0;
+    localparam MA_AR0 = 3'd1;  // 发出低位字读地址
+    localparam MA_RD0 = 3'd2;  // 等待低位字(DTCM为下一拍)
+    localparam MA_AR1 = 3'd3;  // 发出高位字读地址
+    localparam MA_RD1 = 3'd4;  // 等待高位字，返回后合并写回
+
+    reg  [ 2:0] ma_state;
+    reg         ma_dtcm;  // 本次拆分读经DTCM直连端口访问
+    reg  [31:0] ma_rdata0;  // 低位字
+    reg         ma_st_hi;  // 跨字store的低位字已写入，下一个写入高位字
+
+    wire [31:0] ma_word1_addr = {effective_mem_addr_i[31:2] + 30'd1, 2'b00};
+
+    wire        ma_ld_start = ma_ld && (ma_state == MA_IDLE) && sb_empty && read_fifo_empty && !dtcm_rd_pend;
+    wire        ma_rvalid = ((ma_state == MA_RD0) || (ma_state == MA_RD1)) && (ma_dtcm || M_AXI_RVALID);
+    wire [31:0] ma_rdata = ma_dtcm ? dtcm_rdata_i : M_AXI_RDATA;
+    wire        ma_axi_ar = (ma_state == MA_AR0) || (ma_state == MA_AR1);
+    wire        ma_axi_rd = ((ma_state == MA_RD0) || (ma_state == MA_RD1)) && !ma_dtcm;
+
+    assign ma_ld_done = (ma_state == MA_RD1) && ma_rvalid;
+    assign ma_st_done = ma_st && ma_st_hi && (sb_push || dtcm_st_fire);
+
+    // 高位字:低位字拼接后按地址偏移取出，再按原load类型做符号/零扩展
+    wire [63:0] ma_rdata_dw = {ma_rdata, ma_rdata0};
+    wire [31:0] ma_merged = ma_rdata_dw[{mem_addr_index, 3'b000}+:32];
+
+    // 当前写入的store条目：跨字store的第二次写入改为下一个字地址和高4位掩码
+    wire [31:0] st_addr = ma_st_hi ? ma_word1_addr : effective_mem_addr_i;
+    wire [ 3:0] st_strb = ma_st_hi ? effective_mem_wmask_i[7:4] : effective_mem_wmask_i[3:0];
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            ma_state     <= MA_IDLE;
+            ma_dtcm      <= 1'b0;
+            ma_rdata0    <= 32'b0;
+            ma_st_hi     <= 1'b0;
+        end else begin
+            case (ma_state)
+                MA_IDLE: begin
+                    if (ma_ld_start) begin
+                        ma_dtcm  <= dtcm_hit;
+                        ma_state <= dtcm_hit ? MA_RD0 : MA_AR0;
+                    end
+                end
+                MA_AR0: begin
+                    if (M_AXI_ARREADY) ma_state <= MA_RD0;
+                end
+                MA_RD0: begin
+                    if (ma_rvalid) begin
+                        ma_rdata0 <= ma_rdata;
+                        ma_state  <= ma_dtcm ? MA_RD1 : MA_AR1;
+                    end
+                end
+                MA_AR1: begin
+                    if (M_AXI_ARREADY) ma_state <= MA_RD1;
+                end
+                MA_RD1: begin
+                    if (ma_rvalid) ma_state <= MA_IDLE;
+                end
+                default: ma_state <= MA_IDLE;
+            endcase
+
+            if (ma_st_done) begin
+                ma_st_hi <= 1'b0;
+            end else if (ma_st && (sb_push || dtcm_st_fire)) begin
+                ma_st_hi <= 1'b1;
+            end
+        end
+    end
+
+`ifndef SYNTHESIS
+    // 拆分完成的非对齐load/store数(仅供仿真统计)
+    reg [31:0] ma_load_cnt;
+    reg [31:0] ma_store_cnt;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            ma_load_cnt  <= 32'b0;
+            ma_store_cnt <= 32'b0;
+        end else begin
+            if (ma_ld_done) ma_load_cnt <= ma_load_cnt + 1'b1;
+            if (ma_st_done) ma_store_cnt <= ma_store_cnt + 1'b1;
+        end
+    end
+`endif
+
+    // DTCM拆分读在低位字返回的同拍给出高位字地址
+    assign dtcm_raddr_o = (ma_state == MA_RD0) ? ma_word1_addr : effective_mem_addr_i;
+    assign dtcm_we_o    = dtcm_st_fire || amo_dtcm_we;
+    assign dtcm_wmask_o = amo_dtcm_we ? 4'b1111 : st_strb;
+    assign dtcm_waddr_o = amo_dtcm_we ? effective_mem_addr_i : st_addr;
+    assign dtcm_wdata_o = amo_dtcm_we ? amo_wdata : effective_mem_wdata_i;
+
+    // 读FIFO满或与存储缓冲冲突时不发送读请求；DTCM读返回当拍也不发送，避免与同周期响应冲突
+    wire ld_arvalid = read_req_valid && !ma_ld && !dtcm_hit && !read_fifo_full && !ld_sb_block && !dtcm_rd_pend;
+
     // 同周期响应判断
     wire same_cycle_response;
-    assign same_cycle_response = (read_fifo_empty & M_AXI_ARVALID & M_AXI_ARREADY & M_AXI_RVALID & axi_rready);
+    assign same_cycle_response = (read_fifo_empty & ld_arvalid & M_AXI_ARREADY & M_AXI_RVALID & axi_rready);
 
     // 访存阻塞信号 - 简化为32位指令处理
     assign mem_stall_o = req_mem_i && !int_assert_i && input_fifo_full;
-    assign mem_busy_o = !write_fifo_empty;
+    assign mem_busy_o = !sb_empty || (amo_state != AMO_IDLE) || (ma_state != MA_IDLE) || ma_st_hi;
 
     // 读请求FIFO操作
     wire read_fifo_wr_en;
     wire read_fifo_rd_en;
 
-    // 写请求FIFO操作
-    wire write_fifo_wr_en;
-    wire write_fifo_rd_en;
-
     // AXI控制信号
     wire axi_rready;
     wire axi_bready;
@@ -312,40 +662,47 @@ module exu_lsu #(
     assign axi_rready = 1'b1;  // 始终保持读数据通道ready
 
     // 读FIFO写入使能 - 当地址握手成功但数据未同时到达时，添加保护机制
-    assign read_fifo_wr_en = (M_AXI_ARVALID & M_AXI_ARREADY) & (~(M_AXI_RVALID | read_fifo_full) | read_fifo_rd_allow) & read_fifo_wr_allow;
+    assign read_fifo_wr_en = (ld_arvalid & M_AXI_ARREADY) & (~(M_AXI_RVALID | read_fifo_full) | read_fifo_rd_allow) & read_fifo_wr_allow;
 
     // 读FIFO读取使能 - 当等待数据且数据到达时，添加保护机制
     assign read_fifo_rd_en = M_AXI_RVALID & axi_rready & read_fifo_rd_allow;
 
-    // 写FIFO写入使能 - 当地址握手成功但数据握手失败时，添加保护机制
-    assign write_fifo_wr_en = write_req_valid & M_AXI_AWREADY & ~M_AXI_WREADY & write_fifo_wr_allow;
-
-    // 写FIFO读取使能 - 当FIFO非空且数据握手成功时，添加保护机制
-    assign write_fifo_rd_en = write_fifo_rd_allow & M_AXI_WREADY;
-
     // FIFO操作码生成，使用位拼接整理
     assign read_fifo_op = {read_fifo_wr_en, read_fifo_rd_en};
-    assign write_fifo_op = {write_fifo_wr_en, write_fifo_rd_en};
 
-    // 寄存器写回逻辑 - 修改ldl判断条件
+    // 寄存器写回逻辑 - AXI读返回、缓冲前递或原子操作结果
     wire reg_write_valid_set;
     wire reg_write_valid_nxt;
 
-    assign reg_write_valid_set = (axi_rready & M_AXI_RVALID);
+    assign reg_write_valid_set = (axi_rready & M_AXI_RVALID & !amo_axi_rd & !ma_axi_rd) | ld_fwd_fire | dtcm_rd_pend |
+                                 amo_wb | ma_ld_done;
     assign reg_write_valid_nxt = reg_write_valid_set;
 
-    // 直接从AXI读取数据
-    assign axi_read_data       = M_AXI_RDATA;
-
-    // 从FIFO中获取当前处理的请求信息 - 使用effective信号
-    wire [1:0] curr_mem_addr_index = same_cycle_response ? mem_addr_index : read_fifo_mem_addr_index[read_fifo_rd_ptr];
-    wire curr_mem_op_lb = same_cycle_response ? effective_mem_op_lb_i : read_fifo_mem_op_lb[read_fifo_rd_ptr];
-    wire curr_mem_op_lh = same_cycle_response ? effective_mem_op_lh_i : read_fifo_mem_op_lh[read_fifo_rd_ptr];
-    wire curr_mem_op_lw = same_cycle_response ? effective_mem_op_lw_i : read_fifo_mem_op_lw[read_fifo_rd_ptr];
-    wire curr_mem_op_lbu = same_cycle_response ? effective_mem_op_lbu_i : read_fifo_mem_op_lbu[read_fifo_rd_ptr];
-    wire curr_mem_op_lhu = same_cycle_response ? effective_mem_op_lhu_i : read_fifo_mem_op_lhu[read_fifo_rd_ptr];
-    wire [`REG_ADDR_WIDTH-1:0] curr_rd_addr = same_cycle_response ? effective_rd_addr_i : read_fifo_rd_addr[read_fifo_rd_ptr];
-    wire [`COMMIT_ID_WIDTH-1:0] curr_commit_id = same_cycle_response ? effective_commit_id_i : read_fifo_commit_id[read_fifo_rd_ptr];
+    // 前递与DTCM读返回时读FIFO均为空且未发出AR，不会与AXI读返回同拍
+    assign axi_read_data       = dtcm_rd_pend ? dtcm_rdata_i :
+                                 ld_fwd_fire  ? fwd_data :
+                                 ma_ld_done   ? ma_merged : M_AXI_RDATA;
+
+    // 从FIFO中获取当前处理的请求信息 - 同周期响应、前递或拆分读完成时使用effective信号，DTCM读返回时使用其暂存信息；
+    // 拆分读的数据已按偏移对齐，按偏移0取值
+    wire use_curr_req = same_cycle_response | ld_fwd_fire | ma_ld_done;
+    wire [1:0] curr_mem_addr_index = dtcm_rd_pend ? dtcm_rd_addr_index :
+                                     ma_ld_done   ? 2'b00 :
+                                     use_curr_req ? mem_addr_index : read_fifo_mem_addr_index[read_fifo_rd_ptr];
+    wire curr_mem_op_lb = dtcm_rd_pend ? dtcm_rd_lb :
+                          use_curr_req ? effective_mem_op_lb_i : read_fifo_mem_op_lb[read_fifo_rd_ptr];
+    wire curr_mem_op_lh = dtcm_rd_pend ? dtcm_rd_lh :
+                          use_curr_req ? effective_mem_op_lh_i : read_fifo_mem_op_lh[read_fifo_rd_ptr];
+    wire curr_mem_op_lw = dtcm_rd_pend ? dtcm_rd_lw :
+                          use_curr_req ? effective_mem_op_lw_i : read_fifo_mem_op_lw[read_fifo_rd_ptr];
+    wire curr_mem_op_lbu = dtcm_rd_pend ? dtcm_rd_lbu :
+                           use_curr_req ? effective_mem_op_lbu_i : read_fifo_mem_op_lbu[read_fifo_rd_ptr];
+    wire curr_mem_op_lhu = dtcm_rd_pend ? dtcm_rd_lhu :
+                           use_curr_req ? effective_mem_op_lhu_i : read_fifo_mem_op_lhu[read_fifo_rd_ptr];
+    wire [`REG_ADDR_WIDTH-1:0] curr_rd_addr = dtcm_rd_pend ? dtcm_rd_rd_addr :
+                                              use_curr_req ? effective_rd_addr_i : read_fifo_rd_addr[read_fifo_rd_ptr];
+    wire [`COMMIT_ID_WIDTH-1:0] curr_commit_id = dtcm_rd_pend ? dtcm_rd_commit_id :
+                                                 use_curr_req ? effective_commit_id_i : read_fifo_commit_id[read_fifo_rd_ptr];
 
     // 字节加载数据的与或逻辑
     wire [31:0] lb_data, lh_data, lw_data, lbu_data, lhu_data;
@@ -400,10 +757,6 @@ module exu_lsu #(
            ({32{curr_mem_op_lhu}} & lhu_data) |
            ({32{curr_mem_op_lw}} & lw_data);  // ldl直接使用读取数据
 
-    // 从FIFO获取或直接使用的写数据 - 使用effective信号
-    wire [31:0] mem_wdata_out = !write_fifo_empty ? write_fifo_data[write_fifo_rd_ptr] : effective_mem_wdata_i;
-    wire [3:0] mem_wmask_out = !write_fifo_empty ? write_fifo_strb[write_fifo_rd_ptr] : effective_mem_wmask_i;
-
     // 输入请求FIFO更新逻辑 - 简化为普通32位指令处理
     always_ff @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
@@ -420,10 +773,12 @@ module exu_lsu #(
                 input_fifo_mem_op_lhu[i]   <= 1'b0;
                 input_fifo_mem_op_load[i]  <= 1'b0;
                 input_fifo_mem_op_store[i] <= 1'b0;
+                input_fifo_mem_op_amo[i]   <= 1'b0;
+                input_fifo_mem_amo_op[i]   <= 5'b0;
                 input_fifo_rd_addr[i]      <= 5'b0;
                 input_fifo_mem_addr[i]     <= 32'b0;
                 input_fifo_mem_wdata[i]    <= 32'b0;
-                input_fifo_mem_wmask[i]    <= 4'b0;
+                input_fifo_mem_wmask[i]    <= 8'b0;
                 input_fifo_commit_id[i]    <= {`COMMIT_ID_WIDTH{1'b0}};
             end
         end else begin
@@ -442,6 +797,8 @@ module exu_lsu #(
                         input_fifo_mem_op_lhu[input_fifo_wr_ptr] <= mem_op_lhu_i;
                         input_fifo_mem_op_load[input_fifo_wr_ptr] <= mem_op_load_i;
                         input_fifo_mem_op_store[input_fifo_wr_ptr] <= mem_op_store_i;
+                        input_fifo_mem_op_amo[input_fifo_wr_ptr] <= mem_op_amo_i;
+                        input_fifo_mem_amo_op[input_fifo_wr_ptr] <= mem_amo_op_i;
                         input_fifo_rd_addr[input_fifo_wr_ptr] <= rd_addr_i;
                         input_fifo_mem_addr[input_fifo_wr_ptr] <= mem_addr_i;
                         input_fifo_mem_wdata[input_fifo_wr_ptr] <= mem_wdata_i[31:0];
@@ -469,6 +826,8 @@ module exu_lsu #(
                     input_fifo_mem_op_lhu[input_fifo_wr_ptr] <= mem_op_lhu_i;
                     input_fifo_mem_op_load[input_fifo_wr_ptr] <= mem_op_load_i;
                     input_fifo_mem_op_store[input_fifo_wr_ptr] <= mem_op_store_i;
+                    input_fifo_mem_op_amo[input_fifo_wr_ptr] <= mem_op_amo_i;
+                    input_fifo_mem_amo_op[input_fifo_wr_ptr] <= mem_amo_op_i;
                     input_fifo_rd_addr[input_fifo_wr_ptr] <= rd_addr_i;
                     input_fifo_mem_addr[input_fifo_wr_ptr] <= mem_addr_i;
                     input_fifo_mem_wdata[input_fifo_wr_ptr] <= mem_wdata_i[31:0];
@@ -545,44 +904,48 @@ module exu_lsu #(
         end
     end
 
-    // 合并写数据通道FIFO
+    // 存储缓冲更新逻辑
     always_ff @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
-            write_fifo_wr_ptr <= {FIFO_PTR_WIDTH{1'b0}};
-            write_fifo_rd_ptr <= {FIFO_PTR_WIDTH{1'b0}};
-            write_fifo_count  <= {FIFO_CNT_WIDTH{1'b0}};
-            // 重置所有写FIFO条目
-            for (int i = 0; i < FIFO_DEPTH; i++) begin
-                write_fifo_data[i] <= 32'b0;
-                write_fifo_strb[i] <= 4'b0;
+            sb_wr_ptr  <= {SB_PTR_WIDTH{1'b0}};
+            sb_iss_ptr <= {SB_PTR_WIDTH{1'b0}};
+            sb_rd_ptr  <= {SB_PTR_WIDTH{1'b0}};
+            sb_count   <= {SB_CNT_WIDTH{1'b0}};
+            sb_infl    <= {SB_CNT_WIDTH{1'b0}};
+            sb_aw_done <= 1'b0;
+            sb_w_done  <= 1'b0;
+            // 重置所有缓冲条目
+            for (int i = 0; i < SB_DEPTH; i++) begin
+                sb_addr[i] <= 32'b0;
+                sb_data[i] <= 32'b0;
+                sb_strb[i] <= 4'b0;
             end
         end else begin
-            case (write_fifo_op)
-                2'b10: begin  // 只推入
-                    if (write_fifo_wr_allow) begin
-                        write_fifo_wr_ptr <= (write_fifo_wr_ptr + 1'b1) % FIFO_DEPTH;
-                        write_fifo_count <= write_fifo_count + 1'b1;
-                        write_fifo_data[write_fifo_wr_ptr] <= effective_mem_wdata_i;
-                        write_fifo_strb[write_fifo_wr_ptr] <= effective_mem_wmask_i;
-                    end
-                end
-                2'b01: begin  // 只弹出
-                    if (write_fifo_rd_allow) begin
-                        write_fifo_rd_ptr <= (write_fifo_rd_ptr + 1'b1) % FIFO_DEPTH;
-                        write_fifo_count  <= write_fifo_count - 1'b1;
-                    end
-                end
-                2'b11: begin  // 同时推入弹出
-                    write_fifo_wr_ptr                  <= (write_fifo_wr_ptr + 1'b1) % FIFO_DEPTH;
-                    write_fifo_rd_ptr                  <= (write_fifo_rd_ptr + 1'b1) % FIFO_DEPTH;
-                    // 计数器不变
-                    write_fifo_data[write_fifo_wr_ptr] <= effective_mem_wdata_i;
-                    write_fifo_strb[write_fifo_wr_ptr] <= effective_mem_wmask_i;
-                end
-                default: begin
-                    // 保持当前状态
-                end
-            endcase
+            // 推入：来自输入队首的store
+            if (sb_push) begin
+                sb_wr_ptr          <= (sb_wr_ptr + 1'b1) % SB_DEPTH;
+                sb_addr[sb_wr_ptr] <= st_addr;
+                sb_data[sb_wr_ptr] <= effective_mem_wdata_i;
+                sb_strb[sb_wr_ptr] <= st_strb;
+            end
+
+            // 发出：AW/W均握手后转入等待B响应
+            if (sb_issue) begin
+                sb_iss_ptr <= (sb_iss_ptr + 1'b1) % SB_DEPTH;
+                sb_aw_done <= 1'b0;
+                sb_w_done  <= 1'b0;
+            end else if (sb_pend) begin
+                sb_aw_done <= sb_aw_ok;
+                sb_w_done  <= sb_w_ok;
+            end
+
+            // 释放：收到B响应后移除最老条目
+            if (sb_bresp) begin
+                sb_rd_ptr <= (sb_rd_ptr + 1'b1) % SB_DEPTH;
+            end
+
+            sb_count <= sb_count + sb_push - sb_bresp;
+            sb_infl  <= sb_infl + sb_issue - sb_bresp;
         end
     end
 
@@ -590,49 +953,53 @@ module exu_lsu #(
     // 写控制信号逻辑
     assign axi_bready    = 1'b1;  // 始终准备接收写响应
 
-    // 写地址通道 - 使用effective信号，添加write_fifo_full阻塞
+    // 写地址通道 - 由存储缓冲按序发出；原子操作写回时缓冲已排空，改由其独占
     assign M_AXI_AWID    = 'b0;
-    assign M_AXI_AWADDR  = effective_mem_addr_i;
+    assign M_AXI_AWADDR  = amo_axi_wr ? effective_mem_addr_i : sb_addr[sb_iss_ptr];
     assign M_AXI_AWLEN   = 8'b0;  // 单次传输
     assign M_AXI_AWSIZE  = 3'b010;  // 4字节
     assign M_AXI_AWBURST = 2'b01;  // INCR
-    assign M_AXI_AWLOCK  = 1'b0;
+    assign M_AXI_AWLOCK  = amo_axi_wr;
     assign M_AXI_AWCACHE = 4'b0010;
     assign M_AXI_AWPROT  = 3'h0;
     assign M_AXI_AWQOS   = 4'h0;
     assign M_AXI_AWUSER  = 'b1;
-    assign M_AXI_AWVALID = write_req_valid && !write_fifo_full;  // 写FIFO满时不发送写请求
+    assign M_AXI_AWVALID = (sb_pend && !sb_aw_done) || (amo_axi_wr && !amo_aw_done);
 
     // 写数据通道
-    assign M_AXI_WDATA   = mem_wdata_out;
-    assign M_AXI_WSTRB   = mem_wmask_out;
+    assign M_AXI_WDATA   = amo_axi_wr ? amo_wdata : sb_data[sb_iss_ptr];
+    assign M_AXI_WSTRB   = amo_axi_wr ? 4'b1111 : sb_strb[sb_iss_ptr];
     assign M_AXI_WLAST   = 1'b1;  // 每次写入一组数据，Burst长度为1
     assign M_AXI_WUSER   = 'b0;
-    assign M_AXI_WVALID  = write_req_valid || !write_fifo_empty;
+    assign M_AXI_WVALID  = (sb_pend && !sb_w_done) || (amo_axi_wr && !amo_w_done);
 
     // 写响应通道
     assign M_AXI_BREADY  = axi_bready;
 
     // 读地址通道 - 使用effective信号，添加read_fifo_full阻塞
-    assign M_AXI_ARID    = 'b0;  // ARID固定为0,使用顺序Outstanding
-    assign M_AXI_ARADDR  = effective_mem_addr_i;
+    // 互联对不同从设备的读响应按发出顺序返回，且AXI-Lite外设不回传ID，
+    // 因此ARID固定为0，多个在途读请求由读FIFO按序跟踪(最多FIFO_DEPTH个)
+    assign M_AXI_ARID    = 'b0;
+    assign M_AXI_ARADDR  = (ma_state == MA_AR1) ? ma_word1_addr : effective_mem_addr_i;
     assign M_AXI_ARLEN   = 8'b0;  // 单次传输
     assign M_AXI_ARSIZE  = 3'b010;  // 4字节
     assign M_AXI_ARBURST = 2'b01;  // INCR
-    assign M_AXI_ARLOCK  = 1'b0;
+    assign M_AXI_ARLOCK  = amo_axi_ar;
     assign M_AXI_ARCACHE = 4'b0010;
     assign M_AXI_ARPROT  = 3'h0;
     assign M_AXI_ARQOS   = 4'h0;
     assign M_AXI_ARUSER  = 'b1;
-    assign M_AXI_ARVALID = read_req_valid && !read_fifo_full;  // 读FIFO满时不发送读请求
+    // 原子操作与拆分读的读地址在缓冲排空、读FIFO为空后单独发出
+    assign M_AXI_ARVALID = ld_arvalid || amo_axi_ar || ma_axi_ar;
 
     // 读数据通道
     assign M_AXI_RREADY  = axi_rready;
 
     // 寄存器写回信号 - 直接使用组合逻辑连接，支持64位
+    // 原子操作执行期间没有其他在途load，其写回不会与load写回同拍
     assign reg_we_o      = reg_write_valid_nxt;
-    assign reg_wdata_o   = current_reg_wdata;
-    assign reg_waddr_o   = curr_rd_addr;
-    assign commit_id_o   = curr_commit_id;
+    assign reg_wdata_o   = amo_wb ? amo_wb_data : current_reg_wdata;
+    assign reg_waddr_o   = amo_wb ? effective_rd_addr_i : curr_rd_addr;
+    assign commit_id_o   = amo_wb ? effective_commit_id_i : curr_commit_id;
 
 endmodule
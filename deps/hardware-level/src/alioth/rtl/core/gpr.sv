@@ -35,6 +35,22 @@ module gpr (
     input wire [`REG_ADDR_WIDTH-1:0] waddr_i,  // 写寄存器地址
     input wire [`REG_DATA_WIDTH-1:0] wdata_i,  // 写寄存器数据
 
+    // from wbu，LSU独立写回端口
+    input wire                       we2_i,     // 写寄存器标志2
+    input wire [`REG_ADDR_WIDTH-1:0] waddr2_i,  // 写寄存器地址2
+    input wire [`REG_DATA_WIDTH-1:0] wdata2_i,  // 写寄存器数据2
+
+    // from wbu，双发射第二条指令写回
+    input wire                       we3_i,     // 写寄存器标志3
+    input wire [`REG_ADDR_WIDTH-1:0] waddr3_i,  // 写寄存器地址3
+    input wire [`REG_DATA_WIDTH-1:0] wdata3_i,  // 写寄存器数据3
+
+    // from clint，快速中断寄存器影子组
+    input wire                       bank_sel_i,   // 1: 调用者保存寄存器访问影子组
+    input wire                       bank_load_i,  // 进入快速中断，影子组ra/a0装载
+    input wire [`REG_DATA_WIDTH-1:0] bank_ra_i,    // 装入影子组ra的返回地址
+    input wire [`REG_DATA_WIDTH-1:0] bank_a0_i,    // 装入影子组a0的处理函数参数
+
     // from id
     input wire [`REG_ADDR_WIDTH-1:0] raddr1_i,  // 读寄存器1地址
 
@@ -45,53 +61,103 @@ module gpr (
     input wire [`REG_ADDR_WIDTH-1:0] raddr2_i,  // 读寄存器2地址
 
     // to id
-    output wire [`REG_DATA_WIDTH-1:0] rdata2_o  // 读寄存器2数据
+    output wire [`REG_DATA_WIDTH-1:0] rdata2_o,  // 读寄存器2数据
+
+    // 双发射第二条指令的读端口
+    input  wire [`REG_ADDR_WIDTH-1:0] raddr3_i,  // 读寄存器3地址
+    output wire [`REG_DATA_WIDTH-1:0] rdata3_o,  // 读寄存器3数据
+    input  wire [`REG_ADDR_WIDTH-1:0] raddr4_i,  // 读寄存器4地址
+    output wire [`REG_DATA_WIDTH-1:0] rdata4_o   // 读寄存器4数据
 
 );
 
     wire [`REG_DATA_WIDTH-1:0] regs[0:`REG_NUM - 1];
     wire [`REG_NUM-1:0] reg_we;  // 每个寄存器的写使能信号
+    wire [`REG_NUM-1:0] reg_we2;  // 写端口2命中的寄存器
+    wire [`REG_NUM-1:0] reg_we3;  // 写端口3命中的寄存器
 
     // 为每个寄存器生成写使能信号
     // 零寄存器(x0)永远不能被写入
-    assign reg_we[0] = 1'b0;
+    assign reg_we[0]  = 1'b0;
+    assign reg_we2[0] = 1'b0;
+    assign reg_we3[0] = 1'b0;
 
     // 为其他寄存器生成写使能信号
+    // 各写端口由冒险检测保证不会同时写同一寄存器
     genvar i;
     generate
         for (i = 1; i < `REG_NUM; i = i + 1) begin : gen_reg_we
-            assign reg_we[i] = (we_i == `WriteEnable) && (waddr_i == i) && rst_n;
+            assign reg_we2[i] = (we2_i == `WriteEnable) && (waddr2_i == i) && rst_n;
+            assign reg_we3[i] = (we3_i == `WriteEnable) && (waddr3_i == i) && rst_n;
+            assign reg_we[i]  = ((we_i == `WriteEnable) && (waddr_i == i) && rst_n) || reg_we2[i] || reg_we3[i];
         end
     endgenerate
 
+    // 调用者保存寄存器(ra/t0-t6/a0-a7)另有一组影子寄存器，快速中断期间读写影子组，
+    // 切换时刻由clint保证流水线中无未写回的指令
     generate
         for (i = 0; i < `REG_NUM; i = i + 1) begin : gen_regs
-            gnrl_dfflr #(
-                .DW(`REG_DATA_WIDTH)
-            ) reg_dfflr (
-                .clk(clk),
-                .rst_n(rst_n),
-                .lden(reg_we[i]),
-                .dnxt(wdata_i),
-                .qout(regs[i])
-            );
+            localparam SHADOW = (`CLINT_FAST_IRQ != 0) &&
+                ((i == 1) || (i >= 5 && i <= 7) || (i >= 10 && i <= 17) || (i >= 28));
+            wire [`REG_DATA_WIDTH-1:0] wdata = reg_we2[i] ? wdata2_i : reg_we3[i] ? wdata3_i : wdata_i;
+
+            if (SHADOW) begin : gen_bank
+                wire [`REG_DATA_WIDTH-1:0] main_q;
+                wire [`REG_DATA_WIDTH-1:0] shadow_q;
+                wire bank_ld = bank_load_i && ((i == 1) || (i == 10));
+                wire [`REG_DATA_WIDTH-1:0] bank_ld_data = (i == 1) ? bank_ra_i : bank_a0_i;
+
+                gnrl_dfflr #(
+                    .DW(`REG_DATA_WIDTH)
+                ) reg_dfflr (
+                    .clk(clk),
+                    .rst_n(rst_n),
+                    .lden(reg_we[i] && !bank_sel_i),
+                    .dnxt(wdata),
+                    .qout(main_q)
+                );
+
+                gnrl_dfflr #(
+                    .DW(`REG_DATA_WIDTH)
+                ) shadow_dfflr (
+                    .clk(clk),
+                    .rst_n(rst_n),
+                    .lden((reg_we[i] && bank_sel_i) || bank_ld),
+                    .dnxt(bank_ld ? bank_ld_data : wdata),
+                    .qout(shadow_q)
+                );
+
+                assign regs[i] = bank_sel_i ? shadow_q : main_q;
+            end else begin : gen_main
+                gnrl_dfflr #(
+                    .DW(`REG_DATA_WIDTH)
+                ) reg_dfflr (
+                    .clk(clk),
+                    .rst_n(rst_n),
+                    .lden(reg_we[i]),
+                    .dnxt(wdata),
+                    .qout(regs[i])
+                );
+            end
         end
     endgenerate
 
-    // 读寄存器1
-    // 如果读地址为零寄存器，则返回零
-    // 如果读地址等于写地址，并且正在写操作，则直接返回写数据
-    // 否则返回寄存器值
-    assign rdata1_o = (raddr1_i == `ZeroReg) ? `ZeroWord :
-                      ((raddr1_i == waddr_i) && (we_i == `WriteEnable)) ? wdata_i :
-                      regs[raddr1_i];
-
-    // 读寄存器2
+    // 读寄存器
     // 如果读地址为零寄存器，则返回零
-    // 如果读地址等于写地址，并且正在写操作，则直接返回写数据
+    // 如果读地址等于某个写端口的写地址，并且正在写操作，则直接返回写数据
     // 否则返回寄存器值
-    assign rdata2_o = (raddr2_i == `ZeroReg) ? `ZeroWord :
-                      ((raddr2_i == waddr_i) && (we_i == `WriteEnable)) ? wdata_i :
-                      regs[raddr2_i];
+    function automatic [`REG_DATA_WIDTH-1:0] gpr_read(input [`REG_ADDR_WIDTH-1:0] raddr,
+                                                      input [`REG_DATA_WIDTH-1:0] rval);
+        if (raddr == `ZeroReg) gpr_read = `ZeroWord;
+        else if ((raddr == waddr_i) && (we_i == `WriteEnable)) gpr_read = wdata_i;
+        else if ((raddr == waddr2_i) && (we2_i == `WriteEnable)) gpr_read = wdata2_i;
+        else if ((raddr == waddr3_i) && (we3_i == `WriteEnable)) gpr_read = wdata3_i;
+        else gpr_read = rval;
+    endfunction
+
+    assign rdata1_o = gpr_read(raddr1_i, regs[raddr1_i]);
+    assign rdata2_o = gpr_read(raddr2_i, regs[raddr2_i]);
+    assign rdata3_o = gpr_read(raddr3_i, regs[raddr3_i]);
+    assign rdata4_o = gpr_read(raddr4_i, regs[raddr4_i]);
 
 endmodule
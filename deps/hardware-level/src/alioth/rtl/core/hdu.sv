@@ -43,10 +43,30 @@ module hdu (
     input wire                        commit_valid_i,  // 长指令执行完成有效信号
     input wire [`COMMIT_ID_WIDTH-1:0] commit_id_i,     // 执行完成的长指令ID
 
+    // LSU独立写端口的完成信号，可与上一组同拍有效
+    input wire                        commit2_valid_i,
+    input wire [`COMMIT_ID_WIDTH-1:0] commit2_id_i,
+
+    // LSU写回旁路：load数据已在分发级旁路可用，RAW检测提前一拍解除
+    input wire                        lsu_wb_valid_i,
+    input wire [`COMMIT_ID_WIDTH-1:0] lsu_wb_id_i,
+
+    // 双发射第二条ALU指令：不分配表项，也不参与ALU旁路前递
+    input wire                       dual_valid_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_rd_addr_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_rs1_addr_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_rs2_addr_i,
+    input wire                       dual_rs1_re_i,
+    input wire                       dual_rs2_re_i,
+    input wire                       dual_rd_we_i,
+    // 执行级中第二条ALU指令的写回信息，其结果下一拍才写入GPR
+    input wire                       ex_dual_we_i,
+    input wire [`REG_ADDR_WIDTH-1:0] ex_dual_waddr_i,
+
     // 控制信号
     output wire hazard_stall_o,  // 暂停流水线信号
     output wire [`COMMIT_ID_WIDTH-1:0] commit_id_o,  // 为新的长指令分配的ID
-    output wire long_inst_atom_lock_o,  // 原子锁信号，FIFO中有未销毁的长指令时为1
+    output wire long_inst_atom_lock_o,  // 原子锁信号，ID占用表中有未提交的长指令时为1
     output wire alu_pass_op1_o,  // ALU rs1 RAW冒险旁路前递，特判放行
     output wire alu_pass_op2_o,  // ALU rs2 RAW冒险旁路前递，特判放行
     output wire mul_pass_op1_o,  // MUL rs1 RAW冒险旁路前递
@@ -56,162 +76,159 @@ module hdu (
     output wire csr_pass_op1_o  // CSR rs1 RAW冒险旁路前递
 );
 
-    // 定义FIFO表项结构
-    typedef struct packed {
-        logic [`REG_ADDR_WIDTH-1:0] rd_addr;
-        logic [`EX_INFO_BUS_WIDTH-1:0] exu_type;
-    } fifo_entry_t;
+    // 记分板深度由长指令ID位宽决定
+    localparam SB_DEPTH = 1 << `COMMIT_ID_WIDTH;
+
+    // ID占用表：仅记录每个ID对应的目的寄存器，提交时据此定位需清除的寄存器挂起位
+    reg [SB_DEPTH-1:0] id_valid;
+    reg [`REG_ADDR_WIDTH-1:0] id_rd_addr[0:SB_DEPTH-1];
 
-    reg [7:0] fifo_valid;  // 有效位，深度8
-    fifo_entry_t fifo_entry[0:7];  // 存储表项结构体，深度8
+    // 每个寄存器的挂起位，以及最近一次写该寄存器的长指令ID与执行单元类型
+    // 同一执行单元按序写回，WAW放行后只需跟踪最新的写者
+    reg [`REG_NUM-1:0] reg_pend;
+    reg [`COMMIT_ID_WIDTH-1:0] reg_pend_id[0:`REG_NUM-1];
+    reg [`EX_INFO_BUS_WIDTH-1:0] reg_pend_type[0:`REG_NUM-1];
 
     // 冒险检测信号
-    reg raw_hazard;  // 读后写冒险
-    reg waw_hazard;  // 写后写冒险
+    wire raw_hazard;  // 读后写冒险
+    wire waw_hazard;  // 写后写冒险
     wire hazard;  // 总冒险信号
 
-    // ALU RAW冒险掩码及其对应ID
-    reg [7:0] alu_raw_mask;
-    reg [2:0] alu_raw_mask_id;  // 记录当前mask对应的commit_id
-
-    // RAW冒险对象指示
-    reg alu_raw_rs1, alu_raw_rs2;
-    reg mul_raw_rs1, mul_raw_rs2;
-    reg div_raw_rs1, div_raw_rs2;
-    reg        csr_raw_rs1;
-
-    // RAW冒险向量
-    wire [7:0] raw_hazard_vec;
-    wire [7:0] waw_hazard_vec;
-    wire [7:0] masked_raw_hazard_vec;
-
-    wire       is_alu_inst = (ex_info_bus == `EX_INFO_ALU);
-    wire       is_mul_inst = (ex_info_bus == `EX_INFO_MUL);
-    wire       is_div_inst = (ex_info_bus == `EX_INFO_DIV);
-    wire       is_csr_inst = (ex_info_bus == `EX_INFO_CSR);
-    wire       is_alu_bypass_inst = (ex_info_bus[`EX_INFO_BYPASS_BIT] == 1'b0);
-
-    genvar i;
-    generate
-        for (i = 0; i < 8; i = i + 1) begin : hazard_vec_gen
-            assign raw_hazard_vec[i] = fifo_valid[i] && !(commit_valid_i && commit_id_i == i) &&
-                ((rs1_re && rs1_addr == fifo_entry[i].rd_addr) || (rs2_re && rs2_addr == fifo_entry[i].rd_addr));
-            // waw检测：只有exu_type不同才算冲突
-            assign waw_hazard_vec[i] = fifo_valid[i] && !(commit_valid_i && commit_id_i == i) &&
-                (rd_we && rd_addr == fifo_entry[i].rd_addr && ex_info_bus != fifo_entry[i].exu_type);
-        end
-    endgenerate
+    // 最近一条ALU写寄存器指令的ID，其结果可旁路前递给下一条ALU/MUL/DIV/CSR指令
+    reg alu_last_valid;
+    reg [`COMMIT_ID_WIDTH-1:0] alu_last_id;
+
+    wire is_alu_inst = (ex_info_bus == `EX_INFO_ALU);
+    wire is_mul_inst = (ex_info_bus == `EX_INFO_MUL);
+    wire is_div_inst = (ex_info_bus == `EX_INFO_DIV);
+    wire is_csr_inst = (ex_info_bus == `EX_INFO_CSR);
+    wire is_alu_bypass_inst = (ex_info_bus[`EX_INFO_BYPASS_BIT] == 1'b0);
+
+    // 寄存器仍在等待写回：挂起且对应ID本拍未提交/未经LSU旁路
+    function automatic logic reg_busy(input logic [`REG_ADDR_WIDTH-1:0] addr, input logic lsu_release);
+        reg_busy = reg_pend[addr] && !(commit_valid_i && commit_id_i == reg_pend_id[addr]) &&
+            !(commit2_valid_i && commit2_id_i == reg_pend_id[addr]) &&
+            !(lsu_release && lsu_wb_valid_i && lsu_wb_id_i == reg_pend_id[addr]);
+    endfunction
+
+    // 寄存器最新写者为执行级ALU指令，可由ALU结果旁路
+    wire alu_fwd_en = alu_last_valid && !(commit_valid_i && commit_id_i == alu_last_id);
+    wire rs1_alu_fwd = alu_fwd_en && (reg_pend_id[rs1_addr] == alu_last_id);
+    wire rs2_alu_fwd = alu_fwd_en && (reg_pend_id[rs2_addr] == alu_last_id);
+
+    wire rs1_busy = rs1_re && reg_busy(rs1_addr, 1'b1);
+    wire rs2_busy = rs2_re && reg_busy(rs2_addr, 1'b1);
+
+    // RAW冒险（旁路前递类指令屏蔽执行级ALU指令的结果）
+    wire rs1_raw = rs1_busy && !(is_alu_bypass_inst && rs1_alu_fwd);
+    wire rs2_raw = rs2_busy && !(is_alu_bypass_inst && rs2_alu_fwd);
+    assign raw_hazard = rs1_raw || rs2_raw;
+
+    // waw检测：只有exu_type不同才算冲突
+    assign waw_hazard = rd_we && reg_busy(rd_addr, 1'b0) && (ex_info_bus != reg_pend_type[rd_addr]);
+
+    // load-use冒险：因等待load结果而暂停(仅供仿真统计)
+    wire load_use_stall = (rs1_raw && reg_pend_type[rs1_addr] == `EX_INFO_LOAD) ||
+                          (rs2_raw && reg_pend_type[rs2_addr] == `EX_INFO_LOAD);
+
+    // 第二条指令的RAW/WAW检测，不做旁路前递屏蔽
+    wire dual_raw = (dual_rs1_re_i && reg_busy(dual_rs1_addr_i, 1'b1)) ||
+                    (dual_rs2_re_i && reg_busy(dual_rs2_addr_i, 1'b1));
+    wire dual_waw = dual_rd_we_i && reg_busy(dual_rd_addr_i, 1'b0);
+
+    // 执行级第二条指令尚未写回，读取其目的寄存器的指令需等待一拍
+    wire ex_dual_en = ex_dual_we_i && (ex_dual_waddr_i != `ZeroReg);
+    wire ex_dual_raw = ex_dual_en &&
+        ((rs1_re && rs1_addr == ex_dual_waddr_i) || (rs2_re && rs2_addr == ex_dual_waddr_i) ||
+         (dual_valid_i && dual_rs1_re_i && dual_rs1_addr_i == ex_dual_waddr_i) ||
+         (dual_valid_i && dual_rs2_re_i && dual_rs2_addr_i == ex_dual_waddr_i));
+
+    wire dual_hazard = dual_valid_i && (dual_raw || dual_waw);
 
-    // RAW冒险掩码更新
-    always @(posedge clk or negedge rst_n) begin
-        if (~rst_n) begin
-            alu_raw_mask    <= 8'hFF;
-            alu_raw_mask_id <= 3'd0;
-        end else begin
-            // 清除已完成的长指令
-            if (commit_valid_i && (alu_raw_mask_id == commit_id_i)) begin
-                alu_raw_mask    <= 8'hFF;
-                alu_raw_mask_id <= 3'd0;
-            end
-            // 添加新的ALU写寄存器指令，分配mask并记录id
-            if (rd_we_valid && ~hazard && is_alu_inst && rd_we) begin
-                alu_raw_mask    <= ~(8'b1 << commit_id_o);
-                alu_raw_mask_id <= commit_id_o;
-            end
+    // 只有在有新指令且存在冒险时才暂停流水线
+    assign hazard = (raw_hazard || waw_hazard || dual_hazard || ex_dual_raw);
+    wire sb_full = &id_valid;
+    assign hazard_stall_o = hazard || sb_full;  // 如果记分板已满也暂停流水线
+
+    // 记分板满导致的暂停(仅供仿真统计)
+    wire sb_full_stall = sb_full && !hazard;
+
+    // 为新的长指令分配ID：优先编码选出编号最小的空闲ID
+    reg [`COMMIT_ID_WIDTH-1:0] free_id;
+    always @(*) begin
+        free_id = {`COMMIT_ID_WIDTH{1'b0}};
+        for (int k = SB_DEPTH - 1; k >= 0; k = k - 1) begin
+            if (!id_valid[k]) free_id = k[`COMMIT_ID_WIDTH-1:0];
         end
     end
+    assign commit_id_o = (rd_we_valid && ~hazard) ? free_id : {`COMMIT_ID_WIDTH{1'b0}};
 
-    assign masked_raw_hazard_vec = is_alu_bypass_inst ? (raw_hazard_vec & alu_raw_mask) : raw_hazard_vec;
-    // RAW冒险输出（掩码屏蔽新分配ID）
-    assign raw_hazard = |masked_raw_hazard_vec;
-    assign waw_hazard = |waw_hazard_vec;
+    wire alloc_en = rd_we_valid && ~hazard;
+    wire [`REG_ADDR_WIDTH-1:0] commit_rd = id_rd_addr[commit_id_i];
+    wire [`REG_ADDR_WIDTH-1:0] commit2_rd = id_rd_addr[commit2_id_i];
 
-    // 只有在有新指令且存在冒险时才暂停流水线
-    assign hazard = (raw_hazard || waw_hazard);
-    assign hazard_stall_o = hazard || (&fifo_valid);  // 如果FIFO已满也暂停流水线
-
-    // 为新的长指令分配ID - 使用assign语句
-    assign commit_id_o = (rd_we_valid && ~hazard) ?
-        ( ~fifo_valid[0] ? 0 :
-          ~fifo_valid[1] ? 1 :
-          ~fifo_valid[2] ? 2 :
-          ~fifo_valid[3] ? 3 :
-          ~fifo_valid[4] ? 4 :
-          ~fifo_valid[5] ? 5 :
-          ~fifo_valid[6] ? 6 :
-          ~fifo_valid[7] ? 7 : 0 ) : 0;
-
-    // 更新FIFO
+    // 更新ID占用表与寄存器挂起位，同拍分配覆盖提交清除
     always @(posedge clk or negedge rst_n) begin
         if (~rst_n) begin
-            // 复位时清空FIFO
-            for (int i = 0; i < 8; i = i + 1) begin
-                fifo_valid[i]          <= 1'b0;
-                fifo_entry[i].rd_addr  <= 5'h0;
-                fifo_entry[i].exu_type <= {`EX_INFO_BUS_WIDTH{1'b0}};
+            id_valid       <= {SB_DEPTH{1'b0}};
+            reg_pend       <= {`REG_NUM{1'b0}};
+            alu_last_valid <= 1'b0;
+            alu_last_id    <= {`COMMIT_ID_WIDTH{1'b0}};
+            for (int k = 0; k < SB_DEPTH; k = k + 1) begin
+                id_rd_addr[k] <= `ZeroReg;
+            end
+            for (int k = 0; k < `REG_NUM; k = k + 1) begin
+                reg_pend_id[k]   <= {`COMMIT_ID_WIDTH{1'b0}};
+                reg_pend_type[k] <= {`EX_INFO_BUS_WIDTH{1'b0}};
             end
         end else begin
-            // 清除已完成的长指令
+            // 清除已完成的长指令，仅当其仍是该寄存器的最新写者时清挂起位
             if (commit_valid_i) begin
-                fifo_valid[commit_id_i] <= 1'b0;
+                id_valid[commit_id_i] <= 1'b0;
+                if (reg_pend_id[commit_rd] == commit_id_i) begin
+                    reg_pend[commit_rd] <= 1'b0;
+                end
+                if (alu_last_id == commit_id_i) begin
+                    alu_last_valid <= 1'b0;
+                end
             end
-
-            // 添加新的长指令到FIFO
-            if (rd_we_valid && ~hazard) begin
-                fifo_valid[commit_id_o]          <= 1'b1;
-                fifo_entry[commit_id_o].rd_addr  <= rd_addr;
-                fifo_entry[commit_id_o].exu_type <= ex_info_bus;
+            if (commit2_valid_i) begin
+                id_valid[commit2_id_i] <= 1'b0;
+                if (reg_pend_id[commit2_rd] == commit2_id_i) begin
+                    reg_pend[commit2_rd] <= 1'b0;
+                end
             end
-        end
-    end
 
-    // RAW冒险对象检测（对ALU/MUL/DIV/CSR指令有效）
-    always @(*) begin
-        alu_raw_rs1 = 1'b0;
-        alu_raw_rs2 = 1'b0;
-        mul_raw_rs1 = 1'b0;
-        mul_raw_rs2 = 1'b0;
-        div_raw_rs1 = 1'b0;
-        div_raw_rs2 = 1'b0;
-        csr_raw_rs1 = 1'b0;
-        if (is_alu_inst) begin
-            // 只需检查alu_raw_mask_id对应的FIFO表项，且只关心通道一写回
-            if (fifo_valid[alu_raw_mask_id] && alu_raw_mask != 8'hFF &&
-                !(commit_valid_i && commit_id_i == alu_raw_mask_id)) begin
-                if (rs1_re && rs1_addr == fifo_entry[alu_raw_mask_id].rd_addr) alu_raw_rs1 = 1'b1;
-                if (rs2_re && rs2_addr == fifo_entry[alu_raw_mask_id].rd_addr) alu_raw_rs2 = 1'b1;
-            end
-        end
-        if (is_mul_inst) begin
-            if (fifo_valid[alu_raw_mask_id] && alu_raw_mask != 8'hFF &&
-                !(commit_valid_i && commit_id_i == alu_raw_mask_id)) begin
-                if (rs1_re && rs1_addr == fifo_entry[alu_raw_mask_id].rd_addr) mul_raw_rs1 = 1'b1;
-                if (rs2_re && rs2_addr == fifo_entry[alu_raw_mask_id].rd_addr) mul_raw_rs2 = 1'b1;
-            end
-        end
-        if (is_div_inst) begin
-            if (fifo_valid[alu_raw_mask_id] && alu_raw_mask != 8'hFF &&
-                !(commit_valid_i && commit_id_i == alu_raw_mask_id)) begin
-                if (rs1_re && rs1_addr == fifo_entry[alu_raw_mask_id].rd_addr) div_raw_rs1 = 1'b1;
-                if (rs2_re && rs2_addr == fifo_entry[alu_raw_mask_id].rd_addr) div_raw_rs2 = 1'b1;
-            end
-        end
-        if (is_csr_inst) begin
-            if (fifo_valid[alu_raw_mask_id] && alu_raw_mask != 8'hFF &&
-                !(commit_valid_i && commit_id_i == alu_raw_mask_id)) begin
-                if (rs1_re && rs1_addr == fifo_entry[alu_raw_mask_id].rd_addr) csr_raw_rs1 = 1'b1;
+            // 添加新的长指令，x0不挂起
+            if (alloc_en) begin
+                id_valid[free_id]   <= 1'b1;
+                id_rd_addr[free_id] <= rd_addr;
+                if (rd_addr != `ZeroReg) begin
+                    reg_pend[rd_addr]      <= 1'b1;
+                    reg_pend_id[rd_addr]   <= free_id;
+                    reg_pend_type[rd_addr] <= ex_info_bus;
+                end
+                // 新的ALU写寄存器指令成为旁路源
+                if (is_alu_inst && rd_we) begin
+                    alu_last_valid <= 1'b1;
+                    alu_last_id    <= free_id;
+                end
             end
         end
     end
 
-    assign alu_pass_op1_o        = alu_raw_rs1;
-    assign alu_pass_op2_o        = alu_raw_rs2;
-    assign mul_pass_op1_o        = mul_raw_rs1;
-    assign mul_pass_op2_o        = mul_raw_rs2;
-    assign div_pass_op1_o        = div_raw_rs1;
-    assign div_pass_op2_o        = div_raw_rs2;
-    assign csr_pass_op1_o        = csr_raw_rs1;
+    // RAW冒险对象检测（对ALU/MUL/DIV/CSR指令有效），只关心执行级ALU指令的结果
+    wire pass_op1 = rs1_busy && rs1_alu_fwd;
+    wire pass_op2 = rs2_busy && rs2_alu_fwd;
+
+    assign alu_pass_op1_o        = is_alu_inst && pass_op1;
+    assign alu_pass_op2_o        = is_alu_inst && pass_op2;
+    assign mul_pass_op1_o        = is_mul_inst && pass_op1;
+    assign mul_pass_op2_o        = is_mul_inst && pass_op2;
+    assign div_pass_op1_o        = is_div_inst && pass_op1;
+    assign div_pass_op2_o        = is_div_inst && pass_op2;
+    assign csr_pass_op1_o        = is_csr_inst && pass_op1;
 
-    // 生成原子锁信号 - 当FIFO中有任何一个有效的长指令时为1
-    assign long_inst_atom_lock_o = |fifo_valid;
+    // 生成原子锁信号 - ID占用表中任一ID被占用时为1(不写寄存器的长指令不置挂起位，故不能只看reg_pend)
+    assign long_inst_atom_lock_o = |id_valid;
 endmodule
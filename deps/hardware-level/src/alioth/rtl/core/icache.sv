@@ -0,0 +1,289 @@
+/*         
+ The MIT License (MIT)
+
+ Copyright © 2025 Yusen Wang @yusen.w@qq.com
+                                                                         
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+                                                                         
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+                                                                         
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+`include "defines.svh"
+
+// L1指令缓存
+// 位于ifu_axi_master与M0 AXI总线之间，只处理读通道:
+//   XMEM区域的取指请求查表，命中时下一周期返回，缺失时以INCR突发回填整行后再返回；
+//   其他区域(ITCM等)的请求直通总线。
+// 直通请求与缓存请求不同时在途，保证返回顺序与请求顺序一致。
+// fence.i时整体失效，回填过程中失效的行不置有效。
+module icache #(
+    parameter WAYS       = 2,   // 相联度，1或2
+    parameter SET_WIDTH  = 6,   // 组索引位宽
+    parameter LINE_WORDS = 4,   // 每行字数
+    parameter C_AXI_ID_WIDTH   = 2,
+    parameter C_AXI_ADDR_WIDTH = 32,
+    parameter C_AXI_DATA_WIDTH = 32
+) (
+    input wire clk,
+    input wire rst_n,
+
+    input wire invalidate_i,  // 全部失效(fence.i)
+
+    // 来自ifu_axi_master的读请求
+    input  wire [  C_AXI_ID_WIDTH-1:0] S_AXI_ARID,
+    input  wire [C_AXI_ADDR_WIDTH-1:0] S_AXI_ARADDR,
+    input  wire [                 7:0] S_AXI_ARLEN,
+    input  wire [                 2:0] S_AXI_ARSIZE,
+    input  wire [                 1:0] S_AXI_ARBURST,
+    input  wire                        S_AXI_ARLOCK,
+    input  wire [                 3:0] S_AXI_ARCACHE,
+    input  wire [                 2:0] S_AXI_ARPROT,
+    input  wire [                 3:0] S_AXI_ARQOS,
+    input  wire [                 3:0] S_AXI_ARUSER,
+    input  wire                        S_AXI_ARVALID,
+    output wire                        S_AXI_ARREADY,
+    output wire [  C_AXI_ID_WIDTH-1:0] S_AXI_RID,
+    output wire [C_AXI_DATA_WIDTH-1:0] S_AXI_RDATA,
+    output wire [                 1:0] S_AXI_RRESP,
+    output wire                        S_AXI_RLAST,
+    output wire [                 3:0] S_AXI_RUSER,
+    output wire                        S_AXI_RVALID,
+    input  wire                        S_AXI_RREADY,
+
+    // 到总线的读请求
+    output wire [  C_AXI_ID_WIDTH-1:0] M_AXI_ARID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] M_AXI_ARADDR,
+    output wire [                 7:0] M_AXI_ARLEN,
+    output wire [                 2:0] M_AXI_ARSIZE,
+    output wire [                 1:0] M_AXI_ARBURST,
+    output wire                        M_AXI_ARLOCK,
+    output wire [                 3:0] M_AXI_ARCACHE,
+    output wire [                 2:0] M_AXI_ARPROT,
+    output wire [                 3:0] M_AXI_ARQOS,
+    output wire [                 3:0] M_AXI_ARUSER,
+    output wire                        M_AXI_ARVALID,
+    input  wire                        M_AXI_ARREADY,
+    input  wire [  C_AXI_ID_WIDTH-1:0] M_AXI_RID,
+    input  wire [C_AXI_DATA_WIDTH-1:0] M_AXI_RDATA,
+    input  wire [                 1:0] M_AXI_RRESP,
+    input  wire                        M_AXI_RLAST,
+    input  wire [                 3:0] M_AXI_RUSER,
+    input  wire                        M_AXI_RVALID,
+    output wire                        M_AXI_RREADY
+);
+
+    localparam SETS = 1 << SET_WIDTH;
+    localparam WORD_W = $clog2(LINE_WORDS);
+    localparam OFF_W = WORD_W + 2;
+    localparam TAG_W = C_AXI_ADDR_WIDTH - SET_WIDTH - OFF_W;
+    localparam [C_AXI_ADDR_WIDTH-1:0] XMEM_BASE = `XMEM_BASE_ADDR;
+
+    // 状态机
+    localparam S_IDLE = 2'd0;  // 空闲
+    localparam S_LOOKUP = 2'd1;  // 查表并返回当前拍
+    localparam S_REFILL_AR = 2'd2;  // 发出回填请求
+    localparam S_REFILL_R = 2'd3;  // 接收回填数据
+
+    // ---------------- 表项存储 ----------------
+    reg [C_AXI_DATA_WIDTH-1:0] data_r [0:WAYS*SETS*LINE_WORDS-1];
+    reg [           TAG_W-1:0] tag_r  [0:WAYS*SETS-1];
+    reg [       WAYS*SETS-1:0] valid_r;
+    reg [            SETS-1:0] lru_r;  // 两路时指向下次替换的路
+
+    reg [1:0] state;
+    reg [C_AXI_ADDR_WIDTH-1:0] req_addr;  // 当前拍地址
+    reg [C_AXI_ID_WIDTH-1:0] req_id;
+    reg [7:0] req_beats_left;  // 当前拍之后剩余的拍数
+    reg victim_way;  // 回填的目标路
+    reg [WORD_W-1:0] refill_cnt;  // 回填拍号
+    reg refill_err;  // 回填时总线返回错误
+    reg refill_inv;  // 回填期间收到失效请求
+    reg err_pend;  // 当前拍以错误响应返回
+    reg [3:0] pt_cnt;  // 在途的直通请求数
+
+    // ---------------- 地址拆分 ----------------
+    wire s_cacheable = (S_AXI_ARADDR[C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH] ==
+                        XMEM_BASE[C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH]);
+
+    wire [SET_WIDTH-1:0] req_set = req_addr[OFF_W+:SET_WIDTH];
+    wire [TAG_W-1:0] req_tag = req_addr[C_AXI_ADDR_WIDTH-1:OFF_W+SET_WIDTH];
+    wire [WORD_W-1:0] req_word = req_addr[2+:WORD_W];
+
+    function automatic integer line_base(input integer way, input [SET_WIDTH-1:0] set);
+        line_base = (way * SETS + set) * LINE_WORDS;
+    endfunction
+
+    // ---------------- 查表 ----------------
+    reg hit;
+    reg hit_way;
+    integer w;
+    always @(*) begin
+        hit     = 1'b0;
+        hit_way = 1'b0;
+        for (w = 0; w < WAYS; w = w + 1) begin
+            if (valid_r[w*SETS+req_set] && (tag_r[w*SETS+req_set] == req_tag)) begin
+                hit     = 1'b1;
+                hit_way = w[0];
+            end
+        end
+    end
+
+    // 优先替换无效路，否则按LRU
+    wire way0_valid = valid_r[req_set];
+    wire pick_way = (WAYS == 1) ? 1'b0 : (!way0_valid ? 1'b0 :
+                    !valid_r[SETS+req_set] ? 1'b1 : lru_r[req_set]);
+
+    wire lookup = (state == S_LOOKUP);
+    wire resp_valid = lookup && (hit || err_pend);
+    wire resp_last = (req_beats_left == 8'd0);
+    wire resp_hsked = resp_valid && S_AXI_RREADY;
+    wire lookup_done = resp_hsked && resp_last;
+
+    // ---------------- 请求接收 ----------------
+    wire pt_active = (pt_cnt != 4'd0);
+    wire cache_ready = ((state == S_IDLE) || lookup_done) && !pt_active;
+    wire cache_accept = S_AXI_ARVALID && s_cacheable && cache_ready;
+    wire pt_req = S_AXI_ARVALID && !s_cacheable && (state == S_IDLE);
+    wire pt_ar_hsked = pt_req && M_AXI_ARREADY;
+    wire pt_r_done = pt_active && M_AXI_RVALID && S_AXI_RREADY && M_AXI_RLAST;
+
+    assign S_AXI_ARREADY = s_cacheable ? cache_ready : ((state == S_IDLE) && M_AXI_ARREADY);
+
+    // ---------------- 总线侧 ----------------
+    wire refill_ar = (state == S_REFILL_AR);
+    wire refill_r = (state == S_REFILL_R);
+    wire [C_AXI_ADDR_WIDTH-1:0] line_addr = {req_addr[C_AXI_ADDR_WIDTH-1:OFF_W], {OFF_W{1'b0}}};
+
+    assign M_AXI_ARID    = refill_ar ? req_id : S_AXI_ARID;
+    assign M_AXI_ARADDR  = refill_ar ? line_addr : S_AXI_ARADDR;
+    assign M_AXI_ARLEN   = refill_ar ? 8'(LINE_WORDS - 1) : S_AXI_ARLEN;
+    assign M_AXI_ARSIZE  = refill_ar ? 3'd2 : S_AXI_ARSIZE;
+    assign M_AXI_ARBURST = refill_ar ? 2'b01 : S_AXI_ARBURST;
+    assign M_AXI_ARLOCK  = S_AXI_ARLOCK;
+    assign M_AXI_ARCACHE = S_AXI_ARCACHE;
+    assign M_AXI_ARPROT  = S_AXI_ARPROT;
+    assign M_AXI_ARQOS   = S_AXI_ARQOS;
+    assign M_AXI_ARUSER  = S_AXI_ARUSER;
+    assign M_AXI_ARVALID = refill_ar || pt_req;
+    assign M_AXI_RREADY  = pt_active ? S_AXI_RREADY : refill_r;
+
+    // ---------------- 返回后级 ----------------
+    assign S_AXI_RID    = pt_active ? M_AXI_RID : req_id;
+    assign S_AXI_RDATA  = pt_active ? M_AXI_RDATA : data_r[line_base(hit_way, req_set)+req_word];
+    assign S_AXI_RRESP  = pt_active ? M_AXI_RRESP : (err_pend ? 2'b10 : 2'b00);
+    assign S_AXI_RLAST  = pt_active ? M_AXI_RLAST : resp_last;
+    assign S_AXI_RUSER  = 4'h0;
+    assign S_AXI_RVALID = pt_active ? M_AXI_RVALID : resp_valid;
+
+    // ---------------- 状态更新 ----------------
+    always @(posedge clk) begin
+        if (!rst_n) begin
+            state          <= S_IDLE;
+            valid_r        <= {(WAYS * SETS) {1'b0}};
+            lru_r          <= {SETS{1'b0}};
+            req_addr       <= {C_AXI_ADDR_WIDTH{1'b0}};
+            req_id         <= {C_AXI_ID_WIDTH{1'b0}};
+            req_beats_left <= 8'd0;
+            victim_way     <= 1'b0;
+            refill_cnt     <= {WORD_W{1'b0}};
+            refill_err     <= 1'b0;
+            refill_inv     <= 1'b0;
+            err_pend       <= 1'b0;
+            pt_cnt         <= 4'd0;
+        end else begin
+            pt_cnt <= pt_cnt + (pt_ar_hsked ? 4'd1 : 4'd0) - (pt_r_done ? 4'd1 : 4'd0);
+
+            case (state)
+                S_IDLE: begin
+                    if (cache_accept) begin
+                        req_addr       <= S_AXI_ARADDR;
+                        req_id         <= S_AXI_ARID;
+                        req_beats_left <= S_AXI_ARLEN;
+                        state          <= S_LOOKUP;
+                    end
+                end
+                S_LOOKUP: begin
+                    if (resp_hsked) begin
+                        err_pend <= 1'b0;
+                        if (hit && (WAYS > 1)) lru_r[req_set] <= ~hit_way;
+                        if (!resp_last) begin
+                            req_addr       <= req_addr + 4;
+                            req_beats_left <= req_beats_left - 1'b1;
+                        end else if (cache_accept) begin
+                            // 最后一拍返回的同时接收下一个请求
+                            req_addr       <= S_AXI_ARADDR;
+                            req_id         <= S_AXI_ARID;
+                            req_beats_left <= S_AXI_ARLEN;
+                        end else begin
+                            state <= S_IDLE;
+                        end
+                    end else if (!hit && !err_pend) begin
+                        victim_way <= pick_way;
+                        refill_err <= 1'b0;
+                        refill_inv <= 1'b0;
+                        state      <= S_REFILL_AR;
+                    end
+                end
+                S_REFILL_AR: begin
+                    if (M_AXI_ARREADY) begin
+                        refill_cnt <= {WORD_W{1'b0}};
+                        state      <= S_REFILL_R;
+                    end
+                end
+                S_REFILL_R: begin
+                    if (M_AXI_RVALID) begin
+                        data_r[line_base(victim_way, req_set)+refill_cnt] <= M_AXI_RDATA;
+                        refill_cnt <= refill_cnt + 1'b1;
+                        if (M_AXI_RRESP[1]) refill_err <= 1'b1;
+                        if (M_AXI_RLAST) begin
+                            tag_r[victim_way*SETS+req_set] <= req_tag;
+                            // 出错或回填期间被失效的行不置有效，错误以响应形式返回给取指
+                            if (!(refill_err || M_AXI_RRESP[1] || refill_inv || invalidate_i)) begin
+                                valid_r[victim_way*SETS+req_set] <= 1'b1;
+                            end
+                            err_pend <= refill_err || M_AXI_RRESP[1];
+                            state    <= S_LOOKUP;
+                        end
+                    end
+                end
+                default: state <= S_IDLE;
+            endcase
+
+            if (invalidate_i) begin
+                valid_r <= {(WAYS * SETS) {1'b0}};
+                if (state == S_REFILL_AR || state == S_REFILL_R) refill_inv <= 1'b1;
+            end
+        end
+    end
+
+`ifndef SYNTHESIS
+    // 命中/缺失统计(仅供仿真统计)：命中按返回拍计，缺失按发起回填的次数计
+    reg [31:0] hit_cnt;
+    reg [31:0] miss_cnt;
+
+    always @(posedge clk) begin
+        if (!rst_n) begin
+            hit_cnt  <= 32'd0;
+            miss_cnt <= 32'd0;
+        end else if (state == S_LOOKUP) begin
+            if (resp_hsked && hit) hit_cnt <= hit_cnt + 1'b1;
+            if (!resp_hsked && !hit && !err_pend) miss_cnt <= miss_cnt + 1'b1;
+        end
+    end
+`endif
+
+endmodule
@@ -34,7 +34,12 @@ module idu (
     input wire [`INST_DATA_WIDTH-1:0] inst_i,            // 指令内容
     input wire [`INST_ADDR_WIDTH-1:0] inst_addr_i,       // 指令地址
     input wire                        is_pred_branch_i,  // 添加预测分支指令标志输入
+    input wire [ `BPU_META_WIDTH-1:0] bpu_meta_i,        // 分支预测元数据
     input wire                        inst_valid_i,      // 新增：指令有效输入
+    input wire [`INST_DATA_WIDTH-1:0] inst1_i,           // 相邻的下一条指令
+    input wire                        inst1_valid_i,     // 第二条指令与第一条成对发射
+    input wire                        inst1_fuse_i,      // 第二条指令与第一条融合
+    input wire                        inst_c_i,          // 压缩指令(已在取指级展开)
 
     // from ctrl
     input wire [`CU_BUS_WIDTH-1:0] stall_flag_i,  // 流水线暂停标志
@@ -53,13 +58,27 @@ module idu (
     output wire [31:0] dec_imm_o,  // 立即数
     output wire [`DECINFO_WIDTH-1:0] dec_info_bus_o,  // 译码信息总线
     output wire is_pred_branch_o,  // 添加预测分支指令标志输出
+    output wire [`BPU_META_WIDTH-1:0] bpu_meta_o,  // 分支预测元数据
     output wire inst_valid_o,  // 新增：指令有效输出
     output wire illegal_inst_o,  // 新增：非法指令输出
     output wire [`INST_DATA_WIDTH-1:0] inst_o,  // 新增：指令内容输出
     output wire rs1_re_o,  // 新增：rs1寄存器是否需要访问
     output wire rs2_re_o,  // 新增：rs2寄存器是否需要
     output wire [`EX_INFO_BUS_WIDTH-1:0] ex_info_bus_o,  // 新增：ex单元类型输出
-    output wire irs_stall_flag_o  // 指令保留栈FIFO暂停信号输出
+    output wire irs_stall_flag_o,  // 指令保留栈FIFO暂停信号输出
+    output wire fused_o,  // 当前指令为两条指令融合而成
+    output wire inst_c_o,  // 当前指令为压缩指令，顺序下一PC为inst_addr_o + 2
+
+    // 双发射第二条指令(简单ALU指令)的译码结果
+    output wire dual_valid_o,
+    output wire dual_reg_we_o,
+    output wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_o,
+    output wire [`REG_ADDR_WIDTH-1:0] dual_reg1_raddr_o,
+    output wire [`REG_ADDR_WIDTH-1:0] dual_reg2_raddr_o,
+    output wire dual_rs1_re_o,
+    output wire dual_rs2_re_o,
+    output wire [31:0] dual_dec_imm_o,
+    output wire [`DECINFO_WIDTH-1:0] dual_dec_info_bus_o
 );
 
     // 内部连线，连接id和id_pipe
@@ -85,8 +104,23 @@ module idu (
     wire [  `INST_DATA_WIDTH-1:0] fifo_inst;
     wire [  `INST_ADDR_WIDTH-1:0] fifo_inst_addr;
     wire                          fifo_is_pred_branch;
+    wire [   `BPU_META_WIDTH-1:0] fifo_bpu_meta;
     wire                          fifo_inst_valid;
     wire                          fifo_full;
+    wire [  `INST_DATA_WIDTH-1:0] fifo_inst1;
+    wire                          fifo_inst1_valid;
+    wire                          fifo_inst1_fuse;
+    wire                          fifo_inst_c;
+
+    // 第二条指令译码结果
+    wire                          id1_reg_we;
+    wire [   `REG_ADDR_WIDTH-1:0] id1_reg_waddr;
+    wire [   `REG_ADDR_WIDTH-1:0] id1_reg1_raddr;
+    wire [   `REG_ADDR_WIDTH-1:0] id1_reg2_raddr;
+    wire                          id1_rs1_re;
+    wire                          id1_rs2_re;
+    wire [                  31:0] id1_dec_imm;
+    wire [    `DECINFO_WIDTH-1:0] id1_dec_info_bus;
 
     wire                          stall_idu_req;
 
@@ -99,11 +133,11 @@ module idu (
     assign stall_idu_req = stall_flag_i[`CU_STALL_ID];
     assign push_req = stall_idu_req;  // 当ID阶段需要暂停时，推入新指令
     assign fifo_stall = stall_idu_req;  // 当ID阶段需要暂停时，FIFO也需要暂停
-    assign fifo_flush = stall_flag_i[`CU_FLUSH];  // 当需要flush时，FIFO也需要flush
+    assign fifo_flush = stall_flag_i[`CU_FLUSH] | stall_flag_i[`CU_FLUSH_ID];  // 当需要flush时，FIFO也需要flush
 
     // 实例化inst_reserve_stack FIFO
     inst_reserve_stack #(
-        .FIFO_DEPTH(4)
+        .FIFO_DEPTH(`IRS_DEPTH)
     ) u_inst_reserve_stack (
         .clk             (clk),
         .rst_n           (rst_n),
@@ -114,11 +148,21 @@ module idu (
         .inst_i          (inst_i),
         .inst_addr_i     (inst_addr_i),
         .is_pred_branch_i(is_pred_branch_i),
+        .bpu_meta_i      (bpu_meta_i),
         .inst_valid_i    (inst_valid_i),
+        .inst1_i         (inst1_i),
+        .inst1_valid_i   (inst1_valid_i),
+        .inst1_fuse_i    (inst1_fuse_i),
+        .inst_c_i        (inst_c_i),
         .inst_o          (fifo_inst),
         .inst_addr_o     (fifo_inst_addr),
         .is_pred_branch_o(fifo_is_pred_branch),
-        .inst_valid_o    (fifo_inst_valid)
+        .bpu_meta_o      (fifo_bpu_meta),
+        .inst_valid_o    (fifo_inst_valid),
+        .inst1_o         (fifo_inst1),
+        .inst1_valid_o   (fifo_inst1_valid),
+        .inst1_fuse_o    (fifo_inst1_fuse),
+        .inst_c_o        (fifo_inst_c)
     );
 
     // 输出最终rs1_re/rs2_re信号
@@ -156,6 +200,49 @@ module idu (
         .ex_info_bus_o (id_ex_info_bus)    // 新增
     );
 
+    // 双发射第二条指令译码，仅使用寄存器与ALU相关的输出
+    idu_decode u_idu_decode1 (
+        .rst_n(rst_n),
+
+        .inst_i      (fifo_inst1),
+        .inst_addr_i (fifo_inst_addr + 32'd4),
+        .inst_valid_i(fifo_inst1_valid),
+
+        .reg1_raddr_o(id1_reg1_raddr),
+        .reg2_raddr_o(id1_reg2_raddr),
+        .rs1_re_o    (id1_rs1_re),
+        .rs2_re_o    (id1_rs2_re),
+
+        .csr_raddr_o(),
+
+        .dec_imm_o     (id1_dec_imm),
+        .dec_info_bus_o(id1_dec_info_bus),
+        .inst_addr_o   (),
+        .reg_we_o      (id1_reg_we),
+        .reg_waddr_o   (id1_reg_waddr),
+        .csr_we_o      (),
+        .csr_waddr_o   (),
+        .illegal_inst_o(),
+        .ex_info_bus_o ()
+    );
+
+    // 指令融合：第二条指令已在取指级确认与第一条构成lui/auipc+addi或slli+srli，
+    // 此处只改写第一条的立即数与ALU操作，其余译码结果沿用第一条
+    wire                          fuse_en = (`MACRO_FUSION != 0) && fifo_inst1_fuse;
+    wire [                  31:0] fuse_addi_imm = {{20{fifo_inst1[31]}}, fifo_inst1[31:20]};
+    wire                          fuse_shift = id_dec_info_bus[`DECINFO_ALU_SLL];
+    wire [                  31:0] fuse_dec_imm = fuse_shift ? (32'hffffffff >> id_dec_imm[4:0]) :
+                                                              (id_dec_imm + fuse_addi_imm);
+    reg  [    `DECINFO_WIDTH-1:0] fuse_dec_info_bus;
+    always @(*) begin
+        fuse_dec_info_bus = id_dec_info_bus;
+        if (fuse_shift) begin
+            fuse_dec_info_bus[`DECINFO_ALU_SLL] = 1'b0;
+            fuse_dec_info_bus[`DECINFO_ALU_AND] = 1'b1;
+        end
+    end
+    wire [                  31:0] id_fused_dec_imm = fuse_en ? fuse_dec_imm : id_dec_imm;
+    wire [    `DECINFO_WIDTH-1:0] id_fused_dec_info_bus = fuse_en ? fuse_dec_info_bus : id_dec_info_bus;
 
     idu_id_pipe u_idu_id_pipe (
         .clk  (clk),
@@ -174,12 +261,25 @@ module idu (
         .csr_we_i        (id_csr_we),
         .csr_waddr_i     (id_csr_waddr),
         .csr_raddr_i     (id_csr_raddr),
-        .dec_info_bus_i  (id_dec_info_bus),
-        .dec_imm_i       (id_dec_imm),
+        .dec_info_bus_i  (id_fused_dec_info_bus),
+        .dec_imm_i       (id_fused_dec_imm),
+        .fused_i         (fuse_en),
+        .inst_c_i        (fifo_inst_c),
         .is_pred_branch_i(fifo_is_pred_branch),  // 改为fifo输出
+        .bpu_meta_i      (fifo_bpu_meta),
         .inst_valid_i    (fifo_inst_valid),      // 改为fifo输出
         .illegal_inst_i  (id_illegal_inst),      // 新增：非法指令输入
         .ex_info_bus_i   (id_ex_info_bus),       // 新增
+        // 双发射第二条指令
+        .dual_valid_i       (fifo_inst1_valid),
+        .dual_reg_we_i      (id1_reg_we),
+        .dual_reg_waddr_i   (id1_reg_waddr),
+        .dual_reg1_raddr_i  (id1_reg1_raddr),
+        .dual_reg2_raddr_i  (id1_reg2_raddr),
+        .dual_rs1_re_i      (id1_rs1_re),
+        .dual_rs2_re_i      (id1_rs2_re),
+        .dual_dec_imm_i     (id1_dec_imm),
+        .dual_dec_info_bus_i(id1_dec_info_bus),
 
         // from ctrl
         .stall_flag_i(stall_flag_i),
@@ -196,12 +296,24 @@ module idu (
         .dec_imm_o       (dec_imm_o),
         .dec_info_bus_o  (dec_info_bus_o),
         .is_pred_branch_o(is_pred_branch_o),  // 添加预测分支信号输出
+        .bpu_meta_o      (bpu_meta_o),
         .inst_valid_o    (inst_valid_o),      // 新增：指令有效输出
         .illegal_inst_o  (illegal_inst_o),    // 新增：非法指令输出
         .inst_o          (inst_o),            // 新增：指令内容输出
         .rs1_re_o        (id_pipe_rs1_re),    // 新增：rs1寄存器是否需要访问
         .rs2_re_o        (id_pipe_rs2_re),    // 新增：rs2寄存器是否需要访问
-        .ex_info_bus_o   (ex_info_bus_o)      // 新增
+        .ex_info_bus_o   (ex_info_bus_o),     // 新增
+        .fused_o         (fused_o),
+        .inst_c_o        (inst_c_o),
+        .dual_valid_o       (dual_valid_o),
+        .dual_reg_we_o      (dual_reg_we_o),
+        .dual_reg_waddr_o   (dual_reg_waddr_o),
+        .dual_reg1_raddr_o  (dual_reg1_raddr_o),
+        .dual_reg2_raddr_o  (dual_reg2_raddr_o),
+        .dual_rs1_re_o      (dual_rs1_re_o),
+        .dual_rs2_re_o      (dual_rs2_re_o),
+        .dual_dec_imm_o     (dual_dec_imm_o),
+        .dual_dec_info_bus_o(dual_dec_info_bus_o)
     );
 
 endmodule
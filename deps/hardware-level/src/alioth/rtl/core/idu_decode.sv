@@ -46,7 +46,7 @@ module idu_decode (
 
     // to ex
     output wire [                  31:0] dec_imm_o,       // 立即数
-    output wire [    `DECINFO_WIDTH-1:0] dec_info_bus_o,  // 译码信息  [18:0] 
+    output wire [    `DECINFO_WIDTH-1:0] dec_info_bus_o,  // 译码信息  [21:0] 
     output wire [  `INST_ADDR_WIDTH-1:0] inst_addr_o,     // 指令地址
     output wire                          reg_we_o,        // 写通用寄存器标志
     output wire [   `REG_ADDR_WIDTH-1:0] reg_waddr_o,     // 写通用寄存器地址
@@ -63,6 +63,7 @@ module idu_decode (
     wire [6:0] opcode = inst_i[6:0];
     wire [2:0] funct3 = inst_i[14:12];
     wire [6:0] funct7 = inst_i[31:25];
+    wire [4:0] funct5 = inst_i[31:27];
     wire [4:0] rd = inst_i[11:7];
     wire [4:0] rs1 = inst_i[19:15];
     wire [4:0] rs2 = inst_i[24:20];
@@ -88,6 +89,7 @@ module idu_decode (
     wire opcode_0110011 = (opcode == 7'b0110011);
     wire opcode_0001111 = (opcode == 7'b0001111);
     wire opcode_1110011 = (opcode == 7'b1110011);
+    wire opcode_0101111 = (opcode == 7'b0101111);
 
     // 指令funct3域的取值
     wire funct3_000 = (funct3 == 3'b000);
@@ -165,6 +167,73 @@ module idu_decode (
     wire inst_mret = (inst == `INST_MRET);
     wire inst_dret = (inst == `INST_DRET);
 
+    // A扩展：LR/SC及AMO均为字访问，aq/rl位忽略(LSU按序执行，天然满足顺序要求)
+    wire inst_type_amo = (`LSU_ATOMIC_EN != 0) & opcode_0101111 & funct3_010 &
+                         ((funct5 == `INST_AMOADD) | (funct5 == `INST_AMOSWAP) |
+                          ((funct5 == `INST_LR) & (rs2 == 5'h0)) | (funct5 == `INST_SC) |
+                          (funct5 == `INST_AMOXOR) | (funct5 == `INST_AMOOR) |
+                          (funct5 == `INST_AMOAND) | (funct5 == `INST_AMOMIN) |
+                          (funct5 == `INST_AMOMAX) | (funct5 == `INST_AMOMINU) |
+                          (funct5 == `INST_AMOMAXU));
+    wire inst_lr = inst_type_amo & (funct5 == `INST_LR);
+
+    // Zba/Zbb/Zbs：均为单周期ALU操作，移位立即数形式(shamt[5]必须为0)沿用inst[24:20]
+    wire bitmanip_en = (`BITMANIP_EN != 0);
+    wire zb_op = bitmanip_en & opcode_0110011;
+    wire zb_opi = bitmanip_en & opcode_0010011;
+    wire inst_sh1add = zb_op & funct3_010 & (funct7 == `INST_ZB_SHADD);
+    wire inst_sh2add = zb_op & funct3_100 & (funct7 == `INST_ZB_SHADD);
+    wire inst_sh3add = zb_op & funct3_110 & (funct7 == `INST_ZB_SHADD);
+    wire inst_andn = zb_op & funct3_111 & (funct7 == `INST_ZB_NEG);
+    wire inst_orn = zb_op & funct3_110 & (funct7 == `INST_ZB_NEG);
+    wire inst_xnor = zb_op & funct3_100 & (funct7 == `INST_ZB_NEG);
+    wire inst_min = zb_op & funct3_100 & (funct7 == `INST_ZB_MINMAX);
+    wire inst_minu = zb_op & funct3_101 & (funct7 == `INST_ZB_MINMAX);
+    wire inst_max = zb_op & funct3_110 & (funct7 == `INST_ZB_MINMAX);
+    wire inst_maxu = zb_op & funct3_111 & (funct7 == `INST_ZB_MINMAX);
+    wire inst_rol = zb_op & funct3_001 & (funct7 == `INST_ZB_ROT);
+    wire inst_ror = zb_op & funct3_101 & (funct7 == `INST_ZB_ROT);
+    wire inst_rori = zb_opi & funct3_101 & (funct7 == `INST_ZB_ROT);
+    wire inst_clz = zb_opi & funct3_001 & (funct7 == `INST_ZB_ROT) & (rs2 == 5'h00);
+    wire inst_ctz = zb_opi & funct3_001 & (funct7 == `INST_ZB_ROT) & (rs2 == 5'h01);
+    wire inst_cpop = zb_opi & funct3_001 & (funct7 == `INST_ZB_ROT) & (rs2 == 5'h02);
+    wire inst_sext_b = zb_opi & funct3_001 & (funct7 == `INST_ZB_ROT) & (rs2 == 5'h04);
+    wire inst_sext_h = zb_opi & funct3_001 & (funct7 == `INST_ZB_ROT) & (rs2 == 5'h05);
+    wire inst_zext_h = zb_op & funct3_100 & (funct7 == `INST_ZB_ZEXTH) & (rs2 == 5'h00);
+    wire inst_rev8 = zb_opi & funct3_101 & (funct7 == `INST_ZB_BINV) & (rs2 == 5'h18);
+    wire inst_orc_b = zb_opi & funct3_101 & (funct7 == `INST_ZB_BSET) & (rs2 == 5'h07);
+    wire inst_bclr = (zb_op | zb_opi) & funct3_001 & (funct7 == `INST_ZB_BCLR);
+    wire inst_bext = (zb_op | zb_opi) & funct3_101 & (funct7 == `INST_ZB_BCLR);
+    wire inst_bset = (zb_op | zb_opi) & funct3_001 & (funct7 == `INST_ZB_BSET);
+    wire inst_binv = (zb_op | zb_opi) & funct3_001 & (funct7 == `INST_ZB_BINV);
+    wire inst_zb_shift_i = zb_opi & (inst_rori | inst_bclr | inst_bext | inst_bset | inst_binv);
+
+    wire [`BMU_OP_WIDTH-1:0] dec_bmu_op =
+        ({`BMU_OP_WIDTH{inst_sh1add}} & `BMU_OP_SH1ADD) |
+        ({`BMU_OP_WIDTH{inst_sh2add}} & `BMU_OP_SH2ADD) |
+        ({`BMU_OP_WIDTH{inst_sh3add}} & `BMU_OP_SH3ADD) |
+        ({`BMU_OP_WIDTH{inst_andn}} & `BMU_OP_ANDN) |
+        ({`BMU_OP_WIDTH{inst_orn}} & `BMU_OP_ORN) |
+        ({`BMU_OP_WIDTH{inst_xnor}} & `BMU_OP_XNOR) |
+        ({`BMU_OP_WIDTH{inst_clz}} & `BMU_OP_CLZ) |
+        ({`BMU_OP_WIDTH{inst_ctz}} & `BMU_OP_CTZ) |
+        ({`BMU_OP_WIDTH{inst_cpop}} & `BMU_OP_CPOP) |
+        ({`BMU_OP_WIDTH{inst_min}} & `BMU_OP_MIN) |
+        ({`BMU_OP_WIDTH{inst_max}} & `BMU_OP_MAX) |
+        ({`BMU_OP_WIDTH{inst_minu}} & `BMU_OP_MINU) |
+        ({`BMU_OP_WIDTH{inst_maxu}} & `BMU_OP_MAXU) |
+        ({`BMU_OP_WIDTH{inst_sext_b}} & `BMU_OP_SEXTB) |
+        ({`BMU_OP_WIDTH{inst_sext_h}} & `BMU_OP_SEXTH) |
+        ({`BMU_OP_WIDTH{inst_zext_h}} & `BMU_OP_ZEXTH) |
+        ({`BMU_OP_WIDTH{inst_rol}} & `BMU_OP_ROL) |
+        ({`BMU_OP_WIDTH{inst_ror | inst_rori}} & `BMU_OP_ROR) |
+        ({`BMU_OP_WIDTH{inst_rev8}} & `BMU_OP_REV8) |
+        ({`BMU_OP_WIDTH{inst_orc_b}} & `BMU_OP_ORCB) |
+        ({`BMU_OP_WIDTH{inst_bclr}} & `BMU_OP_BCLR) |
+        ({`BMU_OP_WIDTH{inst_bset}} & `BMU_OP_BSET) |
+        ({`BMU_OP_WIDTH{inst_binv}} & `BMU_OP_BINV) |
+        ({`BMU_OP_WIDTH{inst_bext}} & `BMU_OP_BEXT);
+
     // 将指令分类 - 提前计算常用指令类型分组，避免重复判断
     wire inst_type_load = opcode_0000011;
     wire inst_type_store = opcode_0100011;
@@ -178,7 +247,7 @@ module idu_decode (
 
     // 立即数指令分组
     wire inst_i_type = inst_addi | inst_slti | inst_sltiu | inst_xori | inst_ori | inst_andi | inst_type_load | inst_jalr;
-    wire inst_shift_i_type = inst_slli | inst_srli | inst_srai;
+    wire inst_shift_i_type = inst_slli | inst_srli | inst_srai | inst_zb_shift_i;
     wire inst_csr_i_type = inst_csrrwi | inst_csrrsi | inst_csrrci;
 
     // 立即数控制信号优化
@@ -217,6 +286,7 @@ module idu_decode (
     assign dec_alu_info_bus[`DECINFO_ALU_AND]    = inst_and | inst_andi;
     assign dec_alu_info_bus[`DECINFO_ALU_OP2IMM] = opcode_0010011 | inst_lui | inst_auipc;
     assign dec_alu_info_bus[`DECINFO_ALU_OP1PC]  = inst_auipc;
+    assign dec_alu_info_bus[`DECINFO_ALU_BMUOP]  = dec_bmu_op;
 
     wire [`DECINFO_BJP_BUS_WIDTH-1:0] dec_bjp_info_bus;
     assign dec_bjp_info_bus[`DECINFO_GRP_BUS]    = `DECINFO_GRP_BJP;
@@ -264,6 +334,8 @@ module idu_decode (
     // 直接使用之前定义的类型信号
     assign dec_mem_info_bus[`DECINFO_MEM_OP_LOAD]  = inst_type_load;
     assign dec_mem_info_bus[`DECINFO_MEM_OP_STORE] = inst_type_store;
+    assign dec_mem_info_bus[`DECINFO_MEM_OP_AMO]   = inst_type_amo;
+    assign dec_mem_info_bus[`DECINFO_MEM_AMOOP]    = {5{inst_type_amo}} & funct5;
 
     wire [`DECINFO_SYS_BUS_WIDTH-1:0] dec_sys_info_bus;
     assign dec_sys_info_bus[`DECINFO_GRP_BUS]    = `DECINFO_GRP_SYS;
@@ -273,6 +345,7 @@ module idu_decode (
     assign dec_sys_info_bus[`DECINFO_SYS_MRET]   = inst_mret;
     assign dec_sys_info_bus[`DECINFO_SYS_DRET]   = inst_dret;
     assign dec_sys_info_bus[`DECINFO_SYS_FENCE]  = inst_fence | inst_fence_i;
+    assign dec_sys_info_bus[`DECINFO_SYS_FENCEI] = inst_fence_i;
 
     // 操作码逻辑优化
     wire op_alu = (inst_lui | inst_auipc | (opcode_0010011 & (~inst_nop)) | (opcode_0110011 & (~inst_type_muldiv)));
@@ -280,7 +353,7 @@ module idu_decode (
     wire op_muldiv = inst_type_muldiv;
     wire op_csr = insr_type_cstr & (funct3_001 | funct3_010 | funct3_011 | funct3_101 | funct3_110 | funct3_111);
     wire op_sys = inst_ebreak | inst_ecall | inst_nop | inst_wfi | inst_mret | inst_fence | inst_fence_i | inst_dret;
-    wire op_mem = inst_type_load | inst_type_store;
+    wire op_mem = inst_type_load | inst_type_store | inst_type_amo;
 
     assign dec_info_bus_o = ({`DECINFO_WIDTH{op_alu}} & {{`DECINFO_WIDTH-`DECINFO_ALU_BUS_WIDTH{1'b0}}, dec_alu_info_bus}) |
                             ({`DECINFO_WIDTH{op_bjp}} & {{`DECINFO_WIDTH-`DECINFO_BJP_BUS_WIDTH{1'b0}}, dec_bjp_info_bus}) |
@@ -299,7 +372,7 @@ module idu_decode (
     assign rs1_re_o     = access_rs1 && (rs1 != 0);
 
     // 是否需要访问rs2寄存器
-    wire access_rs2 = opcode_0110011 | inst_type_store | inst_type_branch;
+    wire access_rs2 = opcode_0110011 | inst_type_store | inst_type_branch | (inst_type_amo & ~inst_lr);
 
     assign reg2_raddr_o = access_rs2 ? rs2 : 5'h0;
     assign rs2_re_o     = access_rs2 && (rs2 != 0);
@@ -309,7 +382,7 @@ module idu_decode (
     // 2. 当rd=x0时不进行写回操作（RISC-V架构规定）
     wire rd_not_zero = (rd != 5'h0);
     wire access_rd = (inst_lui | inst_auipc | inst_jal | inst_jalr | 
-                     inst_type_load | (opcode_0010011 & (~inst_nop)) | opcode_0110011 | 
+                     inst_type_load | inst_type_amo | (opcode_0010011 & (~inst_nop)) | opcode_0110011 | 
                      op_csr) & rd_not_zero;
 
     assign reg_waddr_o = access_rd ? rd : 5'h0;
@@ -322,10 +395,17 @@ module idu_decode (
     // 增加对slli非法移位量的检测
     wire slli_illegal_shamt = opcode_0010011 & funct3_001 & funct7_0000001;
 
+    // OP与OP-IMM移位编码空间中未定义的funct7(含BITMANIP_EN为0时的位操作指令)
+    wire inst_zb = (dec_bmu_op != `BMU_OP_NONE);
+    wire op_r_illegal = opcode_0110011 & ~inst_type_muldiv & ~inst_zb &
+                        ~(inst_add | inst_sub | inst_sll | inst_slt | inst_sltu |
+                          inst_xor | inst_srl | inst_sra | inst_or | inst_and);
+    wire op_shift_i_illegal = opcode_0010011 & (funct3_001 | funct3_101) & ~inst_shift_i_type & ~inst_zb;
+
     // 增加非法指令检测输出
     assign illegal_inst_o = (
         ((dec_info_bus_o[`DECINFO_GRP_BUS] == `DECINFO_GRP_NONE) && inst_valid_i)
-        || slli_illegal_shamt
+        || slli_illegal_shamt || op_r_illegal || op_shift_i_illegal
     );
 
     // ex_info_bus_o类型编码
@@ -335,7 +415,7 @@ module idu_decode (
         inst_type_div ? `EX_INFO_DIV   :
         op_csr        ? `EX_INFO_CSR   :
         op_bjp        ? `EX_INFO_BJP   :
-        inst_type_load ? `EX_INFO_LOAD :
+        (inst_type_load | inst_type_amo) ? `EX_INFO_LOAD :
         `EX_INFO_OTHER; // 默认设置为其他类型
 
 endmodule
@@ -41,12 +41,26 @@ module idu_id_pipe (
     input wire [`DECINFO_WIDTH-1:0] dec_info_bus_i,
     input wire [31:0] dec_imm_i,
     input wire is_pred_branch_i,  // 添加预测分支指令标志输入
+    input wire [`BPU_META_WIDTH-1:0] bpu_meta_i,  // 分支预测元数据
     input wire inst_valid_i,  // 新增：指令有效输入
     input wire illegal_inst_i,  // 新增：非法指令输入
     input wire [`INST_DATA_WIDTH-1:0] inst_i,  // 新增：指令内容输入
     input wire rs1_re,  // 新增：rs1寄存器是否需要访问
     input wire rs2_re,  // 新增：rs2寄存器是否需要访问
     input wire [`EX_INFO_BUS_WIDTH-1:0] ex_info_bus_i,  // 新增
+    input wire                          fused_i,        // 融合指令标志
+    input wire                          inst_c_i,       // 压缩指令标志
+
+    // 双发射第二条指令
+    input wire                       dual_valid_i,
+    input wire                       dual_reg_we_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg1_raddr_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg2_raddr_i,
+    input wire                       dual_rs1_re_i,
+    input wire                       dual_rs2_re_i,
+    input wire [               31:0] dual_dec_imm_i,
+    input wire [ `DECINFO_WIDTH-1:0] dual_dec_info_bus_i,
 
     input wire [`CU_BUS_WIDTH-1:0] stall_flag_i,  // 流水线暂停标志
 
@@ -61,15 +75,28 @@ module idu_id_pipe (
     output wire [                  31:0] dec_imm_o,         // 立即数
     output wire [    `DECINFO_WIDTH-1:0] dec_info_bus_o,    // 译码信息总线
     output wire                          is_pred_branch_o,  // 添加预测分支指令标志输出
+    output wire [   `BPU_META_WIDTH-1:0] bpu_meta_o,        // 分支预测元数据
     output wire                          inst_valid_o,      // 新增：指令有效输出
     output wire                          illegal_inst_o,    // 新增：非法指令输出
     output wire [  `INST_DATA_WIDTH-1:0] inst_o,            // 新增：指令内容输出
     output wire                          rs1_re_o,
     output wire                          rs2_re_o,
-    output wire [`EX_INFO_BUS_WIDTH-1:0] ex_info_bus_o      // 新增
+    output wire [`EX_INFO_BUS_WIDTH-1:0] ex_info_bus_o,     // 新增
+    output wire                          fused_o,           // 融合指令标志
+    output wire                          inst_c_o,          // 压缩指令标志
+
+    output wire                          dual_valid_o,
+    output wire                          dual_reg_we_o,
+    output wire [   `REG_ADDR_WIDTH-1:0] dual_reg_waddr_o,
+    output wire [   `REG_ADDR_WIDTH-1:0] dual_reg1_raddr_o,
+    output wire [   `REG_ADDR_WIDTH-1:0] dual_reg2_raddr_o,
+    output wire                          dual_rs1_re_o,
+    output wire                          dual_rs2_re_o,
+    output wire [                  31:0] dual_dec_imm_o,
+    output wire [    `DECINFO_WIDTH-1:0] dual_dec_info_bus_o
 );
 
-    wire                        flush_en = stall_flag_i[`CU_FLUSH];
+    wire                        flush_en = stall_flag_i[`CU_FLUSH] | stall_flag_i[`CU_FLUSH_ID];
     wire                        stall_en = stall_flag_i[`CU_STALL_ID];
     wire                        reg_update_en = ~stall_en;
 
@@ -199,6 +226,15 @@ module idu_id_pipe (
     );
     assign is_pred_branch_o = is_pred_branch;
 
+    // 分支预测元数据传递，仅在预测分支时使用
+    gnrl_dfflr #(`BPU_META_WIDTH) bpu_meta_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        bpu_meta_i,
+        bpu_meta_o
+    );
+
     // 指令有效信号传递
     wire inst_valid_dnxt = flush_en ? 1'b0 : inst_valid_i;
     wire inst_valid;
@@ -271,4 +307,68 @@ module idu_id_pipe (
     );
     assign ex_info_bus_o = ex_info_bus_q;
 
+    // 融合指令标志寄存器
+    wire fused_dnxt = flush_en ? 1'b0 : fused_i;
+    wire fused;
+    gnrl_dfflr #(1) fused_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        fused_dnxt,
+        fused
+    );
+    assign fused_o = fused;
+
+    // 压缩指令标志寄存器
+    wire inst_c_dnxt = flush_en ? 1'b0 : inst_c_i;
+    wire inst_c;
+    gnrl_dfflr #(1) inst_c_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        inst_c_dnxt,
+        inst_c
+    );
+    assign inst_c_o = inst_c;
+
+    // 双发射第二条指令：有效位单独寄存，其余译码结果打包寄存，无效时整体清零
+    localparam DUAL_W = 2 + 3 * `REG_ADDR_WIDTH + 2 + 32 + `DECINFO_WIDTH;
+    wire dual_valid_dnxt = flush_en ? 1'b0 : dual_valid_i;
+    wire dual_valid;
+    gnrl_dfflr #(1) dual_valid_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        dual_valid_dnxt,
+        dual_valid
+    );
+    assign dual_valid_o = dual_valid;
+
+    wire [DUAL_W-1:0] dual_bus_dnxt = dual_valid_dnxt ? {
+        dual_reg_we_i,
+        dual_reg_waddr_i,
+        dual_reg1_raddr_i,
+        dual_reg2_raddr_i,
+        dual_rs1_re_i,
+        dual_rs2_re_i,
+        dual_dec_imm_i,
+        dual_dec_info_bus_i
+    } : {DUAL_W{1'b0}};
+    wire [DUAL_W-1:0] dual_bus;
+    gnrl_dfflr #(DUAL_W) dual_bus_ff (
+        clk,
+        rst_n,
+        reg_update_en,
+        dual_bus_dnxt,
+        dual_bus
+    );
+    assign {dual_reg_we_o,
+            dual_reg_waddr_o,
+            dual_reg1_raddr_o,
+            dual_reg2_raddr_o,
+            dual_rs1_re_o,
+            dual_rs2_re_o,
+            dual_dec_imm_o,
+            dual_dec_info_bus_o} = dual_bus;
+
 endmodule
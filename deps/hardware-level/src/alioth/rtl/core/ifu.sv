@@ -34,13 +34,33 @@ module ifu (
     input wire                        jump_flag_i,  // 跳转标志
     input wire [`INST_ADDR_WIDTH-1:0] jump_addr_i,  // 跳转地址
     input wire [   `CU_BUS_WIDTH-1:0] stall_flag_i, // 流水线暂停标志
+    input wire                        fence_i_i,    // fence.i，失效指令缓存
 
     // 输出到ID阶段的信息
     output wire [`INST_DATA_WIDTH-1:0] inst_o,             // 指令内容
     output wire [`INST_ADDR_WIDTH-1:0] inst_addr_o,        // 指令地址
     output wire                        read_resp_error_o,  // AXI读响应错误信号
     output wire                        is_pred_branch_o,   // 添加预测分支指令标志输出
+    output wire [ `BPU_META_WIDTH-1:0] bpu_meta_o,         // 分支预测元数据
     output wire                        inst_valid_o,       // 添加指令有效信号输出
+    output wire [`INST_DATA_WIDTH-1:0] inst1_o,            // 相邻的下一条指令，地址为inst_addr_o + 4
+    output wire                        inst1_valid_o,      // 第二条指令与第一条成对发射
+    output wire                        inst1_fuse_o,       // 第二条指令与第一条融合为一条内部操作
+    output wire                        inst_c_o,           // 压缩指令(已展开)，顺序下一PC为inst_addr_o + 2
+
+    // 来自EXU的分支预测更新
+    input wire                          bpu_upd_valid_i,
+    input wire [  `INST_ADDR_WIDTH-1:0] bpu_upd_pc_i,
+    input wire                          bpu_upd_cond_i,
+    input wire                          bpu_upd_jalr_i,
+    input wire                          bpu_upd_taken_i,
+    input wire [  `INST_ADDR_WIDTH-1:0] bpu_upd_target_i,
+    input wire [`BPU_BHT_IDX_WIDTH-1:0] bpu_upd_bht_idx_i,
+
+    // ITCM直连取指端口
+    output wire [`INST_ADDR_WIDTH-1:0] itcm_fetch_addr_o,
+    input  wire [`INST_DATA_WIDTH-1:0] itcm_fetch_data_i,
+    input  wire [`INST_DATA_WIDTH-1:0] itcm_fetch_data1_i,
 
     // AXI接口
     // AXI读地址通道
@@ -67,39 +87,177 @@ module ifu (
 );
     // 内部信号定义
     wire [`INST_ADDR_WIDTH-1:0] pc;  // 内部PC信号
+    wire [`INST_ADDR_WIDTH-1:0] fetch_pc;  // 发往总线的取指地址
     wire [`INST_DATA_WIDTH-1:0] inst_data;  // 从AXI读取的指令数据
     wire [`INST_ADDR_WIDTH-1:0] inst_addr;  // 从AXI读取的指令地址
+    wire [`INST_ADDR_WIDTH-1:0] pred_npc;  // 当前PC的预测下一PC
+    wire [`INST_ADDR_WIDTH-1:0] btb_pc;  // 取指级BTB查询地址
+    wire [`INST_ADDR_WIDTH-1:0] inst_pred_npc;  // 返回指令取指时的预测下一PC
     wire inst_valid;  // 指令有效信号
+    wire [`INST_DATA_WIDTH-1:0] inst1_data;  // 第二条指令数据
+    wire inst1_valid;  // 第二条指令可与第一条同拍输出
+    wire inst_c;  // 压缩指令
+
+    // 取指AXI主机返回的字流，不支持压缩指令时即为指令流
+    wire [`INST_DATA_WIDTH-1:0] word_data;
+    wire [`INST_ADDR_WIDTH-1:0] word_addr;
+    wire [`INST_ADDR_WIDTH-1:0] word_pred_npc;
+    wire word_valid;
+    wire word_take;  // 对齐模块本周期消耗该字
+    wire realign;  // 跨字32位指令的后半条未顺序取回，从该指令重新取指
+    wire [`INST_ADDR_WIDTH-1:0] realign_addr;
 
     // 分支预测相关信号
     wire branch_taken;  // 分支预测结果：是否跳转
     wire [`INST_ADDR_WIDTH-1:0] branch_addr;  // 预测的分支目标地址
     wire is_pred_branch;  // 当前指令是否为预测分支指令
     wire is_pred_branch_r;  // 预测分支信号寄存后
+    wire [`BPU_META_WIDTH-1:0] bpu_meta;  // 分支预测元数据
+    wire btb_taken;  // 取指级BTB预测跳转
+    reg btb_block;  // 重新对齐后的第一次取指不使用BTB预测，避免再次跳过后半条
+    wire [`INST_ADDR_WIDTH-1:0] btb_target;  // 取指级BTB预测目标
 
     // 合并跳转信号和地址
-    wire jump_flag = jump_flag_i | branch_taken;  // 跳转标志
-    wire [`INST_ADDR_WIDTH-1:0] jump_addr = jump_flag_i ? jump_addr_i : branch_addr;  // 跳转地址
+    wire jump_flag = jump_flag_i | branch_taken | realign;  // 跳转标志
+    wire [`INST_ADDR_WIDTH-1:0] jump_addr = jump_flag_i ? jump_addr_i :
+                                            branch_taken ? branch_addr : realign_addr;  // 跳转地址
 
     wire pc_misaligned;  // 新增：PC非对齐信号
 
     wire axi_pc_stall;
+
+    // 取指AXI主机输出，经指令缓存(可选)后接到M_AXI
+    wire [   `BUS_ID_WIDTH-1:0] fm_arid;
+    wire [`INST_ADDR_WIDTH-1:0] fm_araddr;
+    wire [                 7:0] fm_arlen;
+    wire [                 2:0] fm_arsize;
+    wire [                 1:0] fm_arburst;
+    wire                        fm_arlock;
+    wire [                 3:0] fm_arcache;
+    wire [                 2:0] fm_arprot;
+    wire [                 3:0] fm_arqos;
+    wire [                 3:0] fm_aruser;
+    wire                        fm_arvalid;
+    wire                        fm_arready;
+    wire [   `BUS_ID_WIDTH-1:0] fm_rid;
+    wire [`INST_DATA_WIDTH-1:0] fm_rdata;
+    wire [                 1:0] fm_rresp;
+    wire                        fm_rlast;
+    wire [                 3:0] fm_ruser;
+    wire                        fm_rvalid;
+    wire                        fm_rready;
+
+`ifndef SYNTHESIS
+    // 指令缓存命中/缺失计数(仅供仿真统计)，未启用时为0
+    wire [31:0] icache_hit_cnt;
+    wire [31:0] icache_miss_cnt;
+`endif
+    wire fetch_req_ready;  // 取指请求被接收
     wire stall_if = stall_flag_i[`CU_STALL_IF];  // IF阶段暂停信号
-    wire flush_flag = stall_flag_i[`CU_FLUSH];  // 冲刷信号
+    wire flush_flag = stall_flag_i[`CU_FLUSH] | stall_flag_i[`CU_FLUSH_ID];  // 冲刷信号
     wire stall_axi = stall_if | flush_flag | pc_misaligned;  // AXI暂停信号，增加pc_misaligned
-    wire stall_pc = stall_axi || axi_pc_stall;  // PC暂停信号
-    // 实例化静态分支预测单元
-    sbpu u_sbpu (
-        .clk             (clk),
-        .rst_n           (rst_n),
-        .inst_i          (inst_data),      // 指令内容
-        .inst_valid_i    (inst_valid),     // 指令有效信号
-        .pc_i            (inst_addr),      // 指令地址
-        .any_stall_i     (stall_axi),      // 流水线暂停信号
-        .branch_taken_o  (branch_taken),   // 预测是否为分支
-        .branch_addr_o   (branch_addr),    // 预测的分支地址
-        .is_pred_branch_o(is_pred_branch)  // 当前指令是否为预测分支
-    );
+    // IF暂停时按取指缓冲的空余深度继续预取，仅冲刷和非对齐时停止发请求；
+    // 流水线重定向当拍直接以跳转目标发出取指请求，不等待PC寄存器更新
+    wire fetch_stall = (flush_flag & ~jump_flag_i) | pc_misaligned;
+    wire stall_pc = fetch_stall || axi_pc_stall;  // PC暂停信号
+    generate
+        if (`BPU_DYNAMIC) begin : gen_bpu
+            // 实例化动态分支预测单元
+            bpu u_bpu (
+                .clk             (clk),
+                .rst_n           (rst_n),
+                .fetch_pc_i      (btb_pc),             // 当前取指的BTB查询地址
+                .btb_taken_o     (btb_taken),
+                .btb_target_o    (btb_target),
+                .inst_i          (inst_data),          // 指令内容
+                .inst_valid_i    (inst_valid),         // 指令有效信号
+                .pc_i            (inst_addr),          // 指令地址
+                .inst_c_i        (inst_c),             // 压缩指令
+                .pred_npc_i      (inst_pred_npc),      // 取指时预测的下一PC
+                .any_stall_i     (stall_axi),          // 流水线暂停信号
+                .branch_taken_o  (branch_taken),       // 需要重定向取指
+                .branch_addr_o   (branch_addr),        // 重定向地址
+                .is_pred_branch_o(is_pred_branch),     // 当前指令是否为预测跳转的分支
+                .bpu_meta_o      (bpu_meta),
+                .upd_valid_i     (bpu_upd_valid_i),
+                .upd_pc_i        (bpu_upd_pc_i),
+                .upd_cond_i      (bpu_upd_cond_i),
+                .upd_jalr_i      (bpu_upd_jalr_i),
+                .upd_taken_i     (bpu_upd_taken_i),
+                .upd_target_i    (bpu_upd_target_i),
+                .upd_bht_idx_i   (bpu_upd_bht_idx_i)
+            );
+        end else begin : gen_sbpu
+            // 实例化静态分支预测单元
+            sbpu u_sbpu (
+                .clk             (clk),
+                .rst_n           (rst_n),
+                .inst_i          (inst_data),      // 指令内容
+                .inst_valid_i    (inst_valid),     // 指令有效信号
+                .pc_i            (inst_addr),      // 指令地址
+                .any_stall_i     (stall_axi),      // 流水线暂停信号
+                .branch_taken_o  (branch_taken),   // 预测是否为分支
+                .branch_addr_o   (branch_addr),    // 预测的分支地址
+                .is_pred_branch_o(is_pred_branch)  // 当前指令是否为预测分支
+            );
+            assign btb_taken  = 1'b0;
+            assign btb_target = `ZeroWord;
+            assign bpu_meta   = {`BPU_META_WIDTH{1'b0}};
+        end
+    endgenerate
+
+    // 双发射配对：两条均为简单ALU指令(LUI/AUIPC/OP-IMM/OP，不含乘除)，
+    // 第二条不读第一条的rd且两者rd不同，两条同拍进入后级流水线
+    function automatic is_simple_alu(input [`INST_DATA_WIDTH-1:0] inst);
+        reg [6:0] op;
+        reg [2:0] f3;
+        reg [6:0] f7;
+        begin
+            op = inst[6:0];
+            f3 = inst[14:12];
+            f7 = inst[31:25];
+            case (op)
+                7'b0110111, 7'b0010111: is_simple_alu = 1'b1;  // LUI/AUIPC
+                7'b0010011:  // OP-IMM，移位指令需检查funct7
+                is_simple_alu = (f3 == 3'b001) ? (f7 == 7'b0000000) :
+                                (f3 == 3'b101) ? (f7 == 7'b0000000 || f7 == 7'b0100000) : 1'b1;
+                7'b0110011:  // OP，funct7为1的乘除法指令除外
+                is_simple_alu = (f7 == 7'b0000000) ||
+                                (f7 == 7'b0100000 && (f3 == 3'b000 || f3 == 3'b101));
+                default: is_simple_alu = 1'b0;
+            endcase
+        end
+    endfunction
+
+    wire [4:0] inst0_rd = inst_data[11:7];
+    wire [4:0] inst1_rs1 = inst1_data[19:15];
+    wire [4:0] inst1_rs2 = inst1_data[24:20];
+    wire inst1_rs1_re = (inst1_data[6:0] == 7'b0010011) || (inst1_data[6:0] == 7'b0110011);
+    wire inst1_rs2_re = (inst1_data[6:0] == 7'b0110011);
+    wire inst1_raw = (inst0_rd != 5'd0) && ((inst1_rs1_re && inst1_rs1 == inst0_rd) ||
+                                             (inst1_rs2_re && inst1_rs2 == inst0_rd));
+    wire inst1_waw = (inst0_rd != 5'd0) && (inst1_data[11:7] == inst0_rd);
+
+    // 指令融合：第二条指令读写的都是第一条的rd，两条合并后只产生一个结果
+    //   lui   rd, hi  + addi rd, rd, lo -> rd = hi + lo
+    //   auipc rd, hi  + addi rd, rd, lo -> rd = pc + hi + lo
+    //   slli  rd, rs, k + srli rd, rd, k -> rd = rs & (~0 >> k)
+    wire [4:0] inst1_rd = inst1_data[11:7];
+    wire inst0_lui = (inst_data[6:0] == 7'b0110111);
+    wire inst0_auipc = (inst_data[6:0] == 7'b0010111);
+    wire inst0_slli = (inst_data[6:0] == 7'b0010011) && (inst_data[14:12] == 3'b001) &&
+                      (inst_data[31:25] == 7'b0000000);
+    wire inst1_addi = (inst1_data[6:0] == 7'b0010011) && (inst1_data[14:12] == 3'b000);
+    wire inst1_srli = (inst1_data[6:0] == 7'b0010011) && (inst1_data[14:12] == 3'b101) &&
+                      (inst1_data[31:25] == 7'b0000000);
+    wire inst1_chain = (inst0_rd != 5'd0) && (inst1_rd == inst0_rd) && (inst1_rs1 == inst0_rd);
+    wire inst_fuse = (`MACRO_FUSION != 0) && (`RVC_EN == 0) && inst_valid && inst1_valid && !stall_axi &&
+                     inst1_chain &&
+                     (((inst0_lui || inst0_auipc) && inst1_addi) ||
+                      (inst0_slli && inst1_srli && (inst_data[24:20] == inst1_data[24:20])));
+
+    wire inst_pair = (`DUAL_ISSUE != 0) && (`RVC_EN == 0) && inst_valid && inst1_valid && !stall_axi &&
+                     is_simple_alu(inst_data) && is_simple_alu(inst1_data) && !inst1_raw && !inst1_waw;
 
     // 实例化IFetch模块，现不再包含ifu_pipe功能
     ifu_ifetch u_ifu_ifetch (
@@ -107,9 +265,15 @@ module ifu (
         .rst_n          (rst_n),
         .jump_flag_i    (jump_flag),      // 使用合并后的跳转标志
         .jump_addr_i    (jump_addr),      // 使用合并后的跳转地址
+        .redirect_i     (jump_flag_i),    // 流水线重定向，本拍取指地址即跳转目标
         .stall_pc_i     (stall_pc),
-        .axi_arready_i  (M_AXI_ARREADY),  // 连接AXI读地址通道准备好信号
+        .axi_arready_i  (fetch_req_ready),  // AXI读地址通道或ITCM直连端口准备好
+        .btb_taken_i    (btb_taken & ~btb_block),
+        .btb_target_i   (btb_target),
         .pc_o           (pc),             // PC输出
+        .fetch_pc_o     (fetch_pc),
+        .pred_npc_o     (pred_npc),
+        .btb_pc_o       (btb_pc),
         .pc_misaligned_o(pc_misaligned)   // 新增：连接PC非对齐信号
     );
 
@@ -120,13 +284,23 @@ module ifu (
         .inst_i          (inst_data),         // 使用从AXI读取的指令
         .inst_addr_i     (inst_addr),         // 使用从AXI读取的指令地址
         .is_pred_branch_i(is_pred_branch),    // 连接预测分支信号
+        .bpu_meta_i      (bpu_meta),
         .flush_flag_i    (flush_flag),
         .inst_valid_i    (inst_valid),        // 从AXI控制器获取的有效信号
         .stall_i         (stall_if),          // 连接IF阶段暂停信号
         .inst_o          (inst_o),            // 指令输出
         .inst_addr_o     (inst_addr_o),       // 指令地址输出
         .is_pred_branch_o(is_pred_branch_r),  // 连接预测分支信号输出
-        .inst_valid_o    (inst_valid_o)       // 连接指令有效信号输出
+        .bpu_meta_o      (bpu_meta_o),
+        .inst_valid_o    (inst_valid_o),      // 连接指令有效信号输出
+        .inst1_i         (inst1_data),
+        .inst1_valid_i   (inst_pair),
+        .inst1_fuse_i    (inst_fuse),
+        .inst1_o         (inst1_o),
+        .inst1_valid_o   (inst1_valid_o),
+        .inst1_fuse_o    (inst1_fuse_o),
+        .inst_c_i        (inst_c),
+        .inst_c_o        (inst_c_o)
     );
 
     // 将内部信号连接到输出端口
@@ -140,37 +314,183 @@ module ifu (
     ) u_ifu_axi_master (
         .clk              (clk),
         .rst_n            (rst_n),
-        .stall_axi_i      (stall_axi),
+        .stall_axi_i      (stall_axi | ~word_take),
+        .fetch_stall_i    (fetch_stall),
         .jump_flag_i      (jump_flag),          // 连接跳转标志信号
-        .pc_i             (pc),
+        .redirect_i       (jump_flag_i),
+        .pc_i             (fetch_pc),
+        .pred_npc_i       (pred_npc),
         .read_resp_error_o(read_resp_error_o),
-        .inst_data_o      (inst_data),          // 连接指令数据输出
-        .inst_addr_o      (inst_addr),          // 连接指令地址输出
-        .inst_valid_o     (inst_valid),         // 连接指令有效信号输出
+        .inst_data_o      (word_data),          // 连接指令数据输出
+        .inst_addr_o      (word_addr),          // 连接指令地址输出
+        .inst_pred_npc_o  (word_pred_npc),
+        .inst_valid_o     (word_valid),         // 连接指令有效信号输出
         .pc_stall_o       (axi_pc_stall),       // 连接PC暂停信号输出
+        .req_ready_o      (fetch_req_ready),
+        .inst1_data_o     (inst1_data),
+        .inst1_valid_o    (inst1_valid),
+        .inst1_take_i     (inst_pair || inst_fuse),
+        .itcm_addr_o      (itcm_fetch_addr_o),
+        .itcm_rdata_i     (itcm_fetch_data_i),
+        .itcm_rdata1_i    (itcm_fetch_data1_i),
 
         // AXI读地址通道
-        .M_AXI_ARID   (M_AXI_ARID),
-        .M_AXI_ARADDR (M_AXI_ARADDR),
-        .M_AXI_ARLEN  (M_AXI_ARLEN),
-        .M_AXI_ARSIZE (M_AXI_ARSIZE),
-        .M_AXI_ARBURST(M_AXI_ARBURST),
-        .M_AXI_ARLOCK (M_AXI_ARLOCK),
-        .M_AXI_ARCACHE(M_AXI_ARCACHE),
-        .M_AXI_ARPROT (M_AXI_ARPROT),
-        .M_AXI_ARQOS  (M_AXI_ARQOS),
-        .M_AXI_ARUSER (M_AXI_ARUSER),
-        .M_AXI_ARVALID(M_AXI_ARVALID),
-        .M_AXI_ARREADY(M_AXI_ARREADY),
+        .M_AXI_ARID   (fm_arid),
+        .M_AXI_ARADDR (fm_araddr),
+        .M_AXI_ARLEN  (fm_arlen),
+        .M_AXI_ARSIZE (fm_arsize),
+        .M_AXI_ARBURST(fm_arburst),
+        .M_AXI_ARLOCK (fm_arlock),
+        .M_AXI_ARCACHE(fm_arcache),
+        .M_AXI_ARPROT (fm_arprot),
+        .M_AXI_ARQOS  (fm_arqos),
+        .M_AXI_ARUSER (fm_aruser),
+        .M_AXI_ARVALID(fm_arvalid),
+        .M_AXI_ARREADY(fm_arready),
 
         // AXI读数据通道
-        .M_AXI_RID   (M_AXI_RID),
-        .M_AXI_RDATA (M_AXI_RDATA),
-        .M_AXI_RRESP (M_AXI_RRESP),
-        .M_AXI_RLAST (M_AXI_RLAST),
-        .M_AXI_RUSER (M_AXI_RUSER),
-        .M_AXI_RVALID(M_AXI_RVALID),
-        .M_AXI_RREADY(M_AXI_RREADY)
+        .M_AXI_RID   (fm_rid),
+        .M_AXI_RDATA (fm_rdata),
+        .M_AXI_RRESP (fm_rresp),
+        .M_AXI_RLAST (fm_rlast),
+        .M_AXI_RUSER (fm_ruser),
+        .M_AXI_RVALID(fm_rvalid),
+        .M_AXI_RREADY(fm_rready)
     );
 
+    generate
+        if (`RVC_EN) begin : gen_rvc_align
+            // 从字流中切分16/32位指令，压缩指令展开为32位
+            ifu_rvc_align u_ifu_rvc_align (
+                .clk            (clk),
+                .rst_n          (rst_n),
+                .jump_flag_i    (jump_flag),
+                .jump_addr_i    (jump_addr),
+                .stall_i        (stall_axi),
+                .word_i         (word_data),
+                .word_addr_i    (word_addr),
+                .word_npc_i     (word_pred_npc),
+                .word_valid_i   (word_valid),
+                .word_take_o    (word_take),
+                .inst_o         (inst_data),
+                .inst_addr_o    (inst_addr),
+                .inst_pred_npc_o(inst_pred_npc),
+                .inst_c_o       (inst_c),
+                .inst_valid_o   (inst_valid),
+                .realign_o      (realign),
+                .realign_addr_o (realign_addr)
+            );
+
+            always @(posedge clk) begin
+                if (rst_n == 1'b0) begin
+                    btb_block <= 1'b0;
+                end else if (realign) begin
+                    btb_block <= 1'b1;
+                end else if (!axi_pc_stall && fetch_req_ready) begin
+                    btb_block <= 1'b0;
+                end
+            end
+        end else begin : gen_no_rvc_align
+            assign inst_data     = word_data;
+            assign inst_addr     = word_addr;
+            assign inst_pred_npc = word_pred_npc;
+            assign inst_valid    = word_valid;
+            assign inst_c        = 1'b0;
+            assign word_take     = 1'b1;
+            assign realign       = 1'b0;
+            assign realign_addr  = `ZeroWord;
+
+            always @(posedge clk) begin
+                btb_block <= 1'b0;
+            end
+        end
+    endgenerate
+
+    generate
+        if (`ICACHE_EN) begin : gen_icache
+            icache #(
+                .WAYS            (`ICACHE_WAYS),
+                .SET_WIDTH       (`ICACHE_SET_WIDTH),
+                .LINE_WORDS      (`ICACHE_LINE_WORDS),
+                .C_AXI_ID_WIDTH  (`BUS_ID_WIDTH),
+                .C_AXI_ADDR_WIDTH(`BUS_ADDR_WIDTH),
+                .C_AXI_DATA_WIDTH(`BUS_DATA_WIDTH)
+            ) u_icache (
+                .clk         (clk),
+                .rst_n       (rst_n),
+                .invalidate_i(fence_i_i),
+
+                .S_AXI_ARID   (fm_arid),
+                .S_AXI_ARADDR (fm_araddr),
+                .S_AXI_ARLEN  (fm_arlen),
+                .S_AXI_ARSIZE (fm_arsize),
+                .S_AXI_ARBURST(fm_arburst),
+                .S_AXI_ARLOCK (fm_arlock),
+                .S_AXI_ARCACHE(fm_arcache),
+                .S_AXI_ARPROT (fm_arprot),
+                .S_AXI_ARQOS  (fm_arqos),
+                .S_AXI_ARUSER (fm_aruser),
+                .S_AXI_ARVALID(fm_arvalid),
+                .S_AXI_ARREADY(fm_arready),
+                .S_AXI_RID    (fm_rid),
+                .S_AXI_RDATA  (fm_rdata),
+                .S_AXI_RRESP  (fm_rresp),
+                .S_AXI_RLAST  (fm_rlast),
+                .S_AXI_RUSER  (fm_ruser),
+                .S_AXI_RVALID (fm_rvalid),
+                .S_AXI_RREADY (fm_rready),
+
+                .M_AXI_ARID   (M_AXI_ARID),
+                .M_AXI_ARADDR (M_AXI_ARADDR),
+                .M_AXI_ARLEN  (M_AXI_ARLEN),
+                .M_AXI_ARSIZE (M_AXI_ARSIZE),
+                .M_AXI_ARBURST(M_AXI_ARBURST),
+                .M_AXI_ARLOCK (M_AXI_ARLOCK),
+                .M_AXI_ARCACHE(M_AXI_ARCACHE),
+                .M_AXI_ARPROT (M_AXI_ARPROT),
+                .M_AXI_ARQOS  (M_AXI_ARQOS),
+                .M_AXI_ARUSER (M_AXI_ARUSER),
+                .M_AXI_ARVALID(M_AXI_ARVALID),
+                .M_AXI_ARREADY(M_AXI_ARREADY),
+                .M_AXI_RID    (M_AXI_RID),
+                .M_AXI_RDATA  (M_AXI_RDATA),
+                .M_AXI_RRESP  (M_AXI_RRESP),
+                .M_AXI_RLAST  (M_AXI_RLAST),
+                .M_AXI_RUSER  (M_AXI_RUSER),
+                .M_AXI_RVALID (M_AXI_RVALID),
+                .M_AXI_RREADY (M_AXI_RREADY)
+            );
+
+`ifndef SYNTHESIS
+            assign icache_hit_cnt  = u_icache.hit_cnt;
+            assign icache_miss_cnt = u_icache.miss_cnt;
+`endif
+        end else begin : gen_no_icache
+            assign M_AXI_ARID    = fm_arid;
+            assign M_AXI_ARADDR  = fm_araddr;
+            assign M_AXI_ARLEN   = fm_arlen;
+            assign M_AXI_ARSIZE  = fm_arsize;
+            assign M_AXI_ARBURST = fm_arburst;
+            assign M_AXI_ARLOCK  = fm_arlock;
+            assign M_AXI_ARCACHE = fm_arcache;
+            assign M_AXI_ARPROT  = fm_arprot;
+            assign M_AXI_ARQOS   = fm_arqos;
+            assign M_AXI_ARUSER  = fm_aruser;
+            assign M_AXI_ARVALID = fm_arvalid;
+            assign fm_arready    = M_AXI_ARREADY;
+            assign fm_rid        = M_AXI_RID;
+            assign fm_rdata      = M_AXI_RDATA;
+            assign fm_rresp      = M_AXI_RRESP;
+            assign fm_rlast      = M_AXI_RLAST;
+            assign fm_ruser      = M_AXI_RUSER;
+            assign fm_rvalid     = M_AXI_RVALID;
+            assign M_AXI_RREADY  = fm_rready;
+
+`ifndef SYNTHESIS
+            assign icache_hit_cnt  = 32'd0;
+            assign icache_miss_cnt = 32'd0;
+`endif
+        end
+    endgenerate
+
 endmodule
@@ -36,15 +36,30 @@ module ifu_axi_master #(
 
     // 控制信号
     input wire stall_axi_i,  // 无法接受新的指令(Flush或者Stall)
+    input wire fetch_stall_i,  // 禁止发出新的取指请求(Flush或PC非对齐)
     input wire jump_flag_i,  // 跳转标志信号
+    input wire redirect_i,  // 流水线重定向，pc_i即跳转目标，可在跳转当拍发出请求
     input wire [`INST_ADDR_WIDTH-1:0] pc_i,  // PC指针
+    input wire [`INST_ADDR_WIDTH-1:0] pred_npc_i,  // 取指时预测的下一PC，随地址FIFO保存
     output wire read_resp_error_o,  // 读响应错误信号
 
     // 新增输出
     output wire [`INST_DATA_WIDTH-1:0] inst_data_o,   // 指令数据输出
     output wire [`INST_ADDR_WIDTH-1:0] inst_addr_o,   // 指令地址输出
+    output wire [`INST_ADDR_WIDTH-1:0] inst_pred_npc_o, // 指令取指时预测的下一PC
     output wire                        inst_valid_o,  // 指令有效信号输出
     output wire                        pc_stall_o,    // PC暂停信号输出
+    output wire                        req_ready_o,   // 取指请求被接收(AXI的ARREADY或ITCM直连)
+
+    // 相邻的下一条指令，地址为inst_addr_o + 4，供双发射与指令融合使用
+    output wire [`INST_DATA_WIDTH-1:0] inst1_data_o,   // 第二条指令数据
+    output wire                        inst1_valid_o,  // 第二条指令与第一条同属一次突发且已到达
+    input  wire                        inst1_take_i,   // 第二条指令与第一条同拍被接收
+
+    // ITCM直连取指端口
+    output wire [`INST_ADDR_WIDTH-1:0] itcm_addr_o,   // 读地址，当拍有效
+    input  wire [`INST_DATA_WIDTH-1:0] itcm_rdata_i,  // 读数据，下一拍返回
+    input  wire [`INST_DATA_WIDTH-1:0] itcm_rdata1_i, // 读地址下一个字，与itcm_rdata_i同拍返回
 
     // AXI读地址通道
     output wire [  C_M_AXI_ID_WIDTH-1:0] M_AXI_ARID,
@@ -70,44 +85,72 @@ module ifu_axi_master #(
     output wire                          M_AXI_RREADY
 );
 
-    localparam ADDR_FIFO_DEPTH = 4;  // 地址FIFO深度参数化
-    localparam INST_FIFO_DEPTH = 4;  // 指令FIFO深度
+    localparam INST_FIFO_DEPTH = `IFU_FETCH_BUF_DEPTH;  // 取指缓冲深度
     // AXI参数定义
-    localparam C_M_AXI_BURST_LEN = 1;  // 突发长度为1，每次只读取一条指令
+    localparam C_M_AXI_BURST_LEN = `IFU_FETCH_BURST_LEN;  // 每次请求的INCR突发拍数
+    // 每个地址表项对应一次突发，表项数覆盖缓冲深度即可
+    localparam ADDR_FIFO_DEPTH = INST_FIFO_DEPTH / C_M_AXI_BURST_LEN;
+    localparam BEAT_W = (C_M_AXI_BURST_LEN > 1) ? $clog2(C_M_AXI_BURST_LEN) : 1;
+    localparam [`INST_ADDR_WIDTH-1:0] ITCM_BASE = `ITCM_BASE_ADDR;
+    // 双发射或指令融合时ITCM每拍读回两个字，突发所需的读拍数减半
+    localparam DUAL_EN = ((`DUAL_ISSUE != 0) || (`MACRO_FUSION != 0)) && (`RVC_EN == 0) &&
+                         (C_M_AXI_BURST_LEN >= 2);
+    localparam ITCM_WORDS = DUAL_EN ? 2 : 1;
+    localparam ITCM_BEATS = C_M_AXI_BURST_LEN / ITCM_WORDS;
+    localparam INST_PTR_W = $clog2(INST_FIFO_DEPTH);
 
     // 内部寄存器
     reg error_reg;  // 错误寄存器
     reg [C_M_AXI_ID_WIDTH-1:0] arid_reg;  // ARID寄存器
 
-    // 地址FIFO实现 - 保存待处理的地址请求
+    // 地址FIFO实现 - 保存待处理的地址请求(突发首地址)
     reg [`INST_ADDR_WIDTH-1:0] addr_fifo[0:ADDR_FIFO_DEPTH-1];  // 地址FIFO
+    reg [`INST_ADDR_WIDTH-1:0] npc_fifo[0:ADDR_FIFO_DEPTH-1];  // 突发之后预测的下一PC，与地址FIFO同步
     reg [$clog2(ADDR_FIFO_DEPTH)-1:0] addr_rd_ptr;  // 地址FIFO读指针
     reg [$clog2(ADDR_FIFO_DEPTH)-1:0] addr_wr_ptr;  // 地址FIFO写指针
     reg [$clog2(ADDR_FIFO_DEPTH):0] addr_fifo_count;  // 地址FIFO中数据数量
+    reg [BEAT_W-1:0] head_beat;  // 队首表项中下一条待输出指令的拍号
     wire addr_fifo_empty;  // 地址FIFO为空标志
     wire addr_fifo_full;  // 地址FIFO已满标志
 
-    // 指令FIFO实现 - 用于在stall期间缓存收到的指令响应
+    // 指令FIFO实现 - 缓存收到但尚未被后级接收的指令
     reg [`INST_DATA_WIDTH-1:0] inst_fifo_data[0:INST_FIFO_DEPTH-1];  // 指令数据FIFO
-    // reg [`INST_ADDR_WIDTH-1:0] inst_fifo_addr[0:INST_FIFO_DEPTH-1];  // 指令地址FIFO - 删除
     reg [$clog2(INST_FIFO_DEPTH)-1:0] inst_rd_ptr;  // 指令FIFO读指针
     reg [$clog2(INST_FIFO_DEPTH)-1:0] inst_wr_ptr;  // 指令FIFO写指针
     reg [$clog2(INST_FIFO_DEPTH):0] inst_fifo_count;  // 指令FIFO中数据数量
+    reg [$clog2(INST_FIFO_DEPTH):0] rd_pending;  // 已发出请求但尚未返回的拍数
     wire inst_fifo_empty;  // 指令FIFO为空标志
     wire inst_fifo_full;  // 指令FIFO已满标志
-    reg stall_prev;  // 前一周期的stall状态
 
     // 控制信号
+    wire ar_hsked;  // 读地址握手完成
+    wire credit_ok;  // 缓冲中有足够空间容纳新请求的全部返回数据
+    wire inst_take;  // 本周期有一条指令被后级接收
+    wire head_last;  // 队首表项的最后一拍
     wire push_addr_fifo;  // 推入数据到地址FIFO
     wire pop_addr_fifo;  // 从地址FIFO读取数据
-    wire push_inst_fifo;  // 推入数据到指令FIFO
-    wire pop_inst_fifo;  // 从指令FIFO读取数据
     wire same_cycle_resp;  // 同一周期响应
     wire [1:0] addr_fifo_op;  // 地址FIFO操作类型: {push, pop}
-    wire [1:0] inst_fifo_op;  // 指令FIFO操作类型: {push, pop}
+    wire [1:0] resp_n;  // 本周期返回的指令数
+    wire [1:0] take_n;  // 本周期被后级接收的指令数
+    wire [1:0] pop_n;  // 从指令FIFO弹出的条数
+    wire [1:0] direct_n;  // 返回数据中直接输出、不进入FIFO的条数
+    wire [1:0] push_n;  // 推入指令FIFO的条数
     wire rid_match;  // RID匹配信号
     wire read_hsked;  // 读握手完成
-    wire valid_resp;  // 有效响应信号
+    wire axi_valid_resp;  // AXI有效响应信号
+    wire valid_resp;  // 有效响应信号(AXI或ITCM)
+    wire [`INST_DATA_WIDTH-1:0] resp_data;  // 响应数据
+
+    // ITCM直连取指相关信号
+    wire itcm_hit;  // 当前取指地址位于ITCM
+    wire req_ok;  // 本周期可以发出取指请求
+    wire itcm_req;  // 发出ITCM读请求(突发首拍)
+    wire itcm_rd_en;  // 本周期读ITCM
+    reg itcm_rvalid;  // 上一周期读了ITCM，本周期数据有效
+    reg [`INST_ADDR_WIDTH-1:0] itcm_addr_r;  // 突发后续拍地址
+    reg [BEAT_W-1:0] itcm_beats_left;  // 突发剩余拍数
+    reg pend_itcm;  // 在途请求来自ITCM
 
     // FIFO状态信号
     assign addr_fifo_empty = (addr_fifo_count == 0);
@@ -120,38 +163,84 @@ module ifu_axi_master #(
     // RID匹配检查
     assign rid_match = (M_AXI_RID == arid_reg);
 
+    // 跳转当拍的请求已属于新的取指流：按清空后的缓冲状态判断能否发出，并使用翻转后的ID，
+    // 错误路径上缓冲的指令和在途的请求不再阻塞重定向取指
+    wire [$clog2(INST_FIFO_DEPTH):0] inst_cnt_eff = jump_flag_i ? 0 : inst_fifo_count;
+    wire [$clog2(INST_FIFO_DEPTH):0] rd_pend_eff = jump_flag_i ? 0 : rd_pending;
+    wire [C_M_AXI_ID_WIDTH-1:0] arid_eff = jump_flag_i ? arid_reg + 1'b1 : arid_reg;
+
     assign read_hsked = M_AXI_RVALID && M_AXI_RREADY && !M_AXI_RRESP[1];
 
-    assign valid_resp = read_hsked && rid_match;
+    assign axi_valid_resp = read_hsked && rid_match;
 
-    // PC暂停信号输出 - 当指令FIFO不为空时需要暂停PC
-    assign pc_stall_o = (M_AXI_ARVALID && !M_AXI_ARREADY) || addr_fifo_full || !inst_fifo_empty;
+    assign valid_resp = axi_valid_resp || itcm_rvalid;
 
-    // 同一周期响应检测
-    assign same_cycle_resp = M_AXI_ARVALID && M_AXI_ARREADY && valid_resp && addr_fifo_empty;
+    assign resp_data = itcm_rvalid ? itcm_rdata_i : M_AXI_RDATA;
 
-    // 推入条件：收到有效地址响应且RID匹配且不是同一周期响应且FIFO未满
-    assign push_addr_fifo = M_AXI_ARVALID && M_AXI_ARREADY && !same_cycle_resp && !addr_fifo_full;
+    assign resp_n = axi_valid_resp ? 2'd1 : itcm_rvalid ? 2'(ITCM_WORDS) : 2'd0;
 
-    // 弹出条件：不冲刷且FIFO非空或同一周期有响应
-    assign pop_addr_fifo = !stall_axi_i && (!addr_fifo_empty && (valid_resp || pop_inst_fifo));
+    // ITCM地址窗口按大小对齐，比较高位即可
+    assign itcm_hit = (`ITCM_FETCH_PORT != 0) &&
+                      (pc_i[`INST_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH] ==
+                       ITCM_BASE[`INST_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH]);
 
-    // 地址FIFO操作类型
-    assign addr_fifo_op = {push_addr_fifo, pop_addr_fifo && !same_cycle_resp};
+    // 请求按信用发出；ITCM与AXI的返回时序不同，在途请求须来自同一来源以保证顺序；
+    // 取指级内部跳转(预测纠正、重新对齐)当拍的PC仍是顺序地址，不发请求
+    assign req_ok = !fetch_stall_i && (!jump_flag_i || redirect_i) &&
+                    (jump_flag_i || (!addr_fifo_full && (itcm_beats_left == 0))) && credit_ok &&
+                    ((rd_pend_eff == 0) || (pend_itcm == itcm_hit));
+
+    assign itcm_req = req_ok && itcm_hit;
+    assign itcm_rd_en = itcm_req || (itcm_beats_left != 0);
+    assign itcm_addr_o = itcm_req ? pc_i : itcm_addr_r;
+
+    assign ar_hsked = (M_AXI_ARVALID && M_AXI_ARREADY) || itcm_req;
+
+    // 按信用发请求：缓冲中的指令加上在途的拍数不超过缓冲深度，
+    // 译码暂停时仍可继续预取，返回数据一定有位置存放
+    assign credit_ok = (inst_cnt_eff + rd_pend_eff + C_M_AXI_BURST_LEN) <= INST_FIFO_DEPTH;
+
+    // PC暂停信号输出 - 本周期不能发出取指请求时暂停PC
+    assign pc_stall_o = !(M_AXI_ARVALID || itcm_req);
+
+    // ITCM直连端口总能接收请求
+    assign req_ready_o = itcm_hit || M_AXI_ARREADY;
+
+    // 同一周期响应检测，仅单拍模式下处理；突发模式下从设备至少在下一周期返回数据
+    assign same_cycle_resp = (C_M_AXI_BURST_LEN == 1) && M_AXI_ARVALID && M_AXI_ARREADY &&
+                             axi_valid_resp && addr_fifo_empty && !jump_flag_i;
 
-    // 指令FIFO控制信号
-    // 推入条件： 收到有效响应且处于stall状态，或者指令FIFO非空，且FIFO未满
-    assign push_inst_fifo = ((valid_resp && (stall_axi_i || !inst_fifo_empty)) && !inst_fifo_full);
+    // 指令被后级接收：不暂停且有指令输出
+    assign inst_take = !stall_axi_i && (valid_resp || !inst_fifo_empty);
 
-    // 弹出条件：不处于stall状态且指令FIFO非空
-    assign pop_inst_fifo = !stall_axi_i && !inst_fifo_empty;
+    assign head_last = (head_beat == BEAT_W'(C_M_AXI_BURST_LEN - 1));
 
-    // 指令FIFO操作类型
-    assign inst_fifo_op = {push_inst_fifo, pop_inst_fifo};
+    // 后级按FIFO中的指令在前、本拍返回的指令在后的顺序接收
+    assign take_n = !inst_take ? 2'd0 : (inst1_valid_o && inst1_take_i) ? 2'd2 : 2'd1;
+    assign pop_n = (inst_fifo_count >= take_n) ? take_n : 2'(inst_fifo_count);
+    assign direct_n = take_n - pop_n;
+    // 信用保证缓冲中有足够空间容纳全部返回数据
+    assign push_n = resp_n - direct_n;
+
+    // 推入条件：读地址握手完成且不是同一周期响应
+    assign push_addr_fifo = ar_hsked && !same_cycle_resp;
+
+    // 弹出条件：队首表项的最后一拍被接收
+    assign pop_addr_fifo = (take_n != 0) && !addr_fifo_empty &&
+                           (({1'b0, head_beat} + take_n) == (BEAT_W + 1)'(C_M_AXI_BURST_LEN));
+
+    // 地址FIFO操作类型
+    assign addr_fifo_op = {push_addr_fifo, pop_addr_fifo};
+
+    function automatic [INST_PTR_W-1:0] inst_ptr_add(input [INST_PTR_W-1:0] ptr, input [1:0] n);
+        reg [INST_PTR_W:0] sum;
+        sum = ptr + n;
+        inst_ptr_add = (sum >= INST_FIFO_DEPTH) ? INST_PTR_W'(sum - INST_FIFO_DEPTH) : INST_PTR_W'(sum);
+    endfunction
 
     // I/O连接
     // 读地址通道
-    assign M_AXI_ARID = arid_reg;  // 使用ARID寄存器
+    assign M_AXI_ARID = arid_eff;  // 使用ARID寄存器，跳转当拍为翻转后的ID
     assign M_AXI_ARADDR = pc_i;  // 直接使用PC指针作为地址
     assign M_AXI_ARLEN = C_M_AXI_BURST_LEN - 1;  // 突发长度
     assign M_AXI_ARSIZE = $clog2((C_M_AXI_DATA_WIDTH / 8));  // 数据宽度
@@ -161,7 +250,7 @@ module ifu_axi_master #(
     assign M_AXI_ARPROT = 3'h0;
     assign M_AXI_ARQOS = 4'h0;
     assign M_AXI_ARUSER = 4'h0;
-    assign M_AXI_ARVALID = !stall_axi_i && !addr_fifo_full && inst_fifo_empty;
+    assign M_AXI_ARVALID = req_ok && !itcm_hit;
     assign M_AXI_RREADY = !inst_fifo_full;  // 当指令FIFO未满时才接收数据
 
     // 读响应错误检测
@@ -175,82 +264,99 @@ module ifu_axi_master #(
             addr_rd_ptr     <= 0;
             addr_wr_ptr     <= 0;
             addr_fifo_count <= 0;
+            head_beat       <= 0;
             inst_rd_ptr     <= 0;
             inst_wr_ptr     <= 0;
             inst_fifo_count <= 0;
+            rd_pending      <= 0;
+            itcm_rvalid     <= 1'b0;
+            itcm_beats_left <= 0;
+            pend_itcm       <= 1'b0;
             error_reg       <= 1'b0;
             arid_reg        <= {C_M_AXI_ID_WIDTH{1'b0}};  // 初始化ARID
-            stall_prev      <= 1'b0;
         end else begin
-            stall_prev <= stall_axi_i;
-
-            // 跳转处理：翻转ARID，清空FIFO
+            // 跳转处理：翻转ARID，清空FIFO，在途响应将因ID不匹配被丢弃；
+            // 重定向当拍发出的请求作为清空后的第一个表项
             if (jump_flag_i) begin
                 arid_reg        <= arid_reg + 1;  // 循环切换ID
                 addr_rd_ptr     <= 0;
-                addr_wr_ptr     <= 0;
-                addr_fifo_count <= 0;
+                head_beat       <= 0;
                 inst_rd_ptr     <= 0;
                 inst_wr_ptr     <= 0;
                 inst_fifo_count <= 0;
+                itcm_rvalid     <= itcm_req;
+                if (ar_hsked) begin
+                    addr_fifo[0]    <= M_AXI_ARADDR;
+                    npc_fifo[0]     <= pred_npc_i;
+                    addr_wr_ptr     <= 1;
+                    addr_fifo_count <= 1;
+                    rd_pending      <= C_M_AXI_BURST_LEN;
+                    pend_itcm       <= itcm_hit;
+                end else begin
+                    addr_wr_ptr     <= 0;
+                    addr_fifo_count <= 0;
+                    rd_pending      <= 0;
+                end
+                if (itcm_req) begin
+                    itcm_addr_r     <= pc_i + 4 * ITCM_WORDS;
+                    itcm_beats_left <= BEAT_W'(ITCM_BEATS - 1);
+                end else begin
+                    itcm_beats_left <= 0;
+                end
             end else begin
                 // 错误寄存器更新
                 if (read_resp_error) begin
                     error_reg <= 1'b1;
                 end
 
-                // 指令FIFO管理 - 使用统一的操作逻辑
-                case (inst_fifo_op)
-                    2'b10: begin  // 只推入
-                        inst_fifo_data[inst_wr_ptr] <= M_AXI_RDATA;
-                        // inst_fifo_addr[inst_wr_ptr] <= (!addr_fifo_empty) ? addr_fifo[addr_rd_ptr] :
-                        //                                (same_cycle_resp) ? M_AXI_ARADDR : 32'h0; - 删除
-                        inst_wr_ptr <= inst_wr_ptr + 1'd1;
-                        if (inst_wr_ptr == INST_FIFO_DEPTH - 1) inst_wr_ptr <= 0;
-                        inst_fifo_count <= inst_fifo_count + 1'd1;
-                    end
-                    2'b01: begin  // 只弹出
-                        if (inst_fifo_count > 0) begin
-                            // 仅当FIFO非空时才弹出
-                            inst_rd_ptr <= inst_rd_ptr + 1'd1;
-                            if (inst_rd_ptr == INST_FIFO_DEPTH - 1) inst_rd_ptr <= 0;
-                            inst_fifo_count <= inst_fifo_count - 1'd1;
-                        end
-                    end
-                    2'b11: begin  // 同时推入和弹出
-                        inst_fifo_data[inst_wr_ptr] <= M_AXI_RDATA;
-                        // inst_fifo_addr[inst_wr_ptr] <= (!addr_fifo_empty) ? addr_fifo[addr_rd_ptr] :
-                        //                                (same_cycle_resp) ? M_AXI_ARADDR : 32'h0; - 删除
-                        inst_wr_ptr <= inst_wr_ptr + 1'd1;
-                        if (inst_wr_ptr == INST_FIFO_DEPTH - 1) inst_wr_ptr <= 0;
-                        inst_rd_ptr <= inst_rd_ptr + 1'd1;
-                        if (inst_rd_ptr == INST_FIFO_DEPTH - 1) inst_rd_ptr <= 0;
-                        // inst_fifo_count保持不变
-                    end
-                    default: begin  // 2'b00: 无操作
-                        // 保持当前状态
-                    end
-                endcase
+                // ITCM读时序：读使能的下一拍数据有效，突发时逐拍递增地址
+                itcm_rvalid <= itcm_rd_en;
+                if (itcm_req) begin
+                    itcm_addr_r     <= pc_i + 4 * ITCM_WORDS;
+                    itcm_beats_left <= BEAT_W'(ITCM_BEATS - 1);
+                end else if (itcm_beats_left != 0) begin
+                    itcm_addr_r     <= itcm_addr_r + 4 * ITCM_WORDS;
+                    itcm_beats_left <= itcm_beats_left - 1'd1;
+                end
+
+                if (ar_hsked) pend_itcm <= itcm_hit;
+
+                // 在途拍数统计
+                rd_pending <= rd_pending + (ar_hsked ? C_M_AXI_BURST_LEN : 0) - resp_n;
+
+                // 指令FIFO管理：返回数据中未被直接输出的部分按顺序推入
+                if (push_n != 0) begin
+                    inst_fifo_data[inst_wr_ptr] <= (direct_n != 0) ? itcm_rdata1_i : resp_data;
+                end
+                if (push_n == 2) begin
+                    inst_fifo_data[inst_ptr_add(inst_wr_ptr, 2'd1)] <= itcm_rdata1_i;
+                end
+                inst_wr_ptr     <= inst_ptr_add(inst_wr_ptr, push_n);
+                inst_rd_ptr     <= inst_ptr_add(inst_rd_ptr, pop_n);
+                inst_fifo_count <= inst_fifo_count + push_n - pop_n;
+
+                // 队首表项内的拍号
+                if ((take_n != 0) && !addr_fifo_empty) begin
+                    head_beat <= pop_addr_fifo ? {BEAT_W{1'b0}} : head_beat + BEAT_W'(take_n);
+                end
 
                 // 处理FIFO推入和弹出
                 case (addr_fifo_op)
                     2'b10: begin  // 只推入
                         addr_fifo[addr_wr_ptr] <= M_AXI_ARADDR;  // 仅保存地址
+                        npc_fifo[addr_wr_ptr]  <= pred_npc_i;
                         addr_wr_ptr            <= addr_wr_ptr + 1'd1;  // 循环指针
                         if (addr_wr_ptr == ADDR_FIFO_DEPTH - 1) addr_wr_ptr <= 0;  // 循环回到0
                         addr_fifo_count <= addr_fifo_count + 1'd1;
                     end
                     2'b01: begin  // 只弹出
-                        if (addr_fifo_count > 0) begin
-                            // 仅当FIFO非空时才弹出
-                            addr_rd_ptr <= addr_rd_ptr + 1'd1;  // 循环指针
-                            if (addr_rd_ptr == ADDR_FIFO_DEPTH - 1)
-                                addr_rd_ptr <= 0;  // 循环回到0
-                            addr_fifo_count <= addr_fifo_count - 1'd1;
-                        end
+                        addr_rd_ptr <= addr_rd_ptr + 1'd1;  // 循环指针
+                        if (addr_rd_ptr == ADDR_FIFO_DEPTH - 1) addr_rd_ptr <= 0;  // 循环回到0
+                        addr_fifo_count <= addr_fifo_count - 1'd1;
                     end
                     2'b11: begin  // 同时推入和弹出
                         addr_fifo[addr_wr_ptr] <= M_AXI_ARADDR;  // 仅保存地址
+                        npc_fifo[addr_wr_ptr]  <= pred_npc_i;
                         addr_wr_ptr            <= addr_wr_ptr + 1'd1;
                         if (addr_wr_ptr == ADDR_FIFO_DEPTH - 1) addr_wr_ptr <= 0;  // 循环回到0
                         addr_rd_ptr <= addr_rd_ptr + 1'd1;
@@ -266,9 +372,22 @@ module ifu_axi_master #(
     end
 
     // 输出逻辑 - 当指令FIFO不空时从FIFO输出，否则直接输出
-    assign inst_data_o = !inst_fifo_empty ? inst_fifo_data[inst_rd_ptr] : M_AXI_RDATA;
-    assign inst_addr_o = (!addr_fifo_empty) ? addr_fifo[addr_rd_ptr] :
+    wire [`INST_ADDR_WIDTH-1:0] head_addr = addr_fifo[addr_rd_ptr] + {head_beat, 2'b00};
+    assign inst_data_o = !inst_fifo_empty ? inst_fifo_data[inst_rd_ptr] : resp_data;
+    assign inst_addr_o = (!addr_fifo_empty) ? head_addr :
                          (same_cycle_resp) ? M_AXI_ARADDR : 0;
+    // 突发内部的指令顺序执行，最后一拍之后才使用取指时的预测
+    assign inst_pred_npc_o = (!addr_fifo_empty) ? (head_last ? npc_fifo[addr_rd_ptr] : head_addr + 4) :
+                             (same_cycle_resp) ? pred_npc_i : 0;
     assign inst_valid_o = !inst_fifo_empty || valid_resp;
 
+    // 第二条指令：FIFO中第二项，或FIFO中只剩一项时本拍返回的第一个字，FIFO空时为本拍返回的第二个字
+    assign inst1_data_o = (inst_fifo_count >= 2) ? inst_fifo_data[inst_ptr_add(inst_rd_ptr, 2'd1)] :
+                          (inst_fifo_count == 1) ? resp_data : itcm_rdata1_i;
+    // 仅在同一突发内成对输出；第二条是突发最后一拍时，要求取指时对其预测的下一PC是顺序地址
+    wire inst1_last = (head_beat == BEAT_W'(C_M_AXI_BURST_LEN - 2));
+    wire inst1_seq = !inst1_last || (npc_fifo[addr_rd_ptr] == head_addr + 8);
+    assign inst1_valid_o = DUAL_EN && ((inst_fifo_count + resp_n) >= 2) &&
+                           !addr_fifo_empty && !head_last && inst1_seq;
+
 endmodule
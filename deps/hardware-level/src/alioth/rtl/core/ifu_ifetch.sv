@@ -32,10 +32,16 @@ module ifu_ifetch (
 
     input wire                        jump_flag_i,   // 跳转标志
     input wire [`INST_ADDR_WIDTH-1:0] jump_addr_i,   // 跳转地址
+    input wire                        redirect_i,    // 流水线重定向，本拍直接以jump_addr_i取指
     input wire                        stall_pc_i,    // PC暂停信号
     input wire                        axi_arready_i, // AXI读地址通道准备好信号
+    input wire                        btb_taken_i,   // BTB预测当前PC跳转
+    input wire [`INST_ADDR_WIDTH-1:0] btb_target_i,  // BTB预测目标地址
 
-    output wire [`INST_ADDR_WIDTH-1:0] pc_o,  // PC指针
+    output wire [`INST_ADDR_WIDTH-1:0] pc_o,        // PC指针
+    output wire [`INST_ADDR_WIDTH-1:0] fetch_pc_o,  // 取指地址，支持压缩指令时按字对齐
+    output wire [`INST_ADDR_WIDTH-1:0] pred_npc_o,  // 当前PC之后预测的下一PC
+    output wire [`INST_ADDR_WIDTH-1:0] btb_pc_o,    // BTB查询地址(本次取指的最后一条指令)
     // 新增输出：非对齐取指信号
     output wire pc_misaligned_o
 );
@@ -46,14 +52,30 @@ module ifu_ifetch (
     // 计算实际的PC暂停信号：原有暂停信号或AXI未就绪
     wire                        stall_pc_actual = stall_pc_i || !axi_arready_i;
 
+    // 每次取指请求覆盖的字节数(突发取指时为多条连续指令)
+    localparam FETCH_BYTES = `IFU_FETCH_BURST_LEN * 4;
+
+    // 本拍请求的PC：重定向时为跳转目标，否则为PC寄存器
+    wire [`INST_ADDR_WIDTH-1:0] req_pc = redirect_i ? jump_addr_i : pc_o;
+
+    // 支持压缩指令时PC可指向字的高半字，总线按整字取回，由ifu_rvc_align从该半字开始切分
+    assign fetch_pc_o = (`RVC_EN != 0) ? {req_pc[`INST_ADDR_WIDTH-1:2], 2'b00} : req_pc;
+
+    // 突发中只有最后一条指令的跳转能由BTB在取指级预测，前面的由指令返回级纠正
+    assign btb_pc_o = fetch_pc_o + (FETCH_BYTES - 4);
+
+    // 顺序取指或BTB预测的目标；重定向当拍不查BTB，避免执行级结果再经过BTB，目标处的跳转由返回级纠正
+    assign pred_npc_o = (btb_taken_i && !redirect_i) ? btb_target_i : fetch_pc_o + FETCH_BYTES;
+
     // 根据控制信号计算下一个PC值
     assign pc_nxt = (!rst_n) ? `PC_RESET_ADDR :  // 复位
+        (redirect_i && !stall_pc_actual) ? pred_npc_o :  // 跳转目标已在本拍发出请求
         (jump_flag_i == `JumpEnable) ? jump_addr_i :  // 跳转
         (stall_pc_actual) ? pc_o :  // 暂停（包括AXI未就绪的情况）
-        pc_o + 4'h4;  // 地址加4
+        pred_npc_o;  // 顺序取指或BTB预测目标
 
-    // 非对齐判断：PC最低两位不为0即为非对齐
-    assign pc_misaligned_o = |pc_o[1:0];
+    // 非对齐判断：PC最低两位不为0即为非对齐，支持压缩指令时只要求半字对齐
+    assign pc_misaligned_o = (`RVC_EN != 0) ? req_pc[0] : |req_pc[1:0];
 
     // 使用gnrl_dff模块实现PC寄存器
     gnrl_dff #(
@@ -33,19 +33,32 @@ module ifu_pipe (
     input wire [`INST_DATA_WIDTH-1:0] inst_i,      // 指令内容
     input wire [`INST_ADDR_WIDTH-1:0] inst_addr_i, // 指令地址
     input wire                        is_pred_branch_i, // 是否为预测分支指令
+    input wire [ `BPU_META_WIDTH-1:0] bpu_meta_i,       // 分支预测元数据
 
     input wire flush_flag_i,  // 流水线冲刷标志
     input wire inst_valid_i,  // 指令有效信号
     input wire stall_i,       // 保持信号，为1时触发器保持不更新
 
+    input wire [`INST_DATA_WIDTH-1:0] inst1_i,        // 相邻的下一条指令
+    input wire                        inst1_valid_i,  // 第二条指令与第一条成对发射
+    input wire                        inst1_fuse_i,   // 第二条指令与第一条融合
+    input wire                        inst_c_i,       // 压缩指令
+
     output wire [`INST_DATA_WIDTH-1:0] inst_o,      // 指令内容
     output wire [`INST_ADDR_WIDTH-1:0] inst_addr_o, // 指令地址
     output wire                        is_pred_branch_o,  // 输出到ID/EXU的预测分支标志
-    output wire                        inst_valid_o       // 输出指令有效信号
+    output wire [ `BPU_META_WIDTH-1:0] bpu_meta_o,        // 分支预测元数据
+    output wire                        inst_valid_o,      // 输出指令有效信号
+    output wire [`INST_DATA_WIDTH-1:0] inst1_o,           // 相邻的下一条指令
+    output wire                        inst1_valid_o,     // 第二条指令与第一条成对发射
+    output wire                        inst1_fuse_o,      // 第二条指令与第一条融合
+    output wire                        inst_c_o           // 压缩指令
 );
 
     // 直接使用flush_flag_i，不再寄存
     wire                        flush_en = flush_flag_i;
+    // 冲刷时即使IF暂停也要清掉错误路径上的指令，否则保留栈清空后它会被当作有效指令送入译码
+    wire                        lden = !stall_i || flush_en;
 
     // 在指令无效或冲刷信号有效时，选择填充0作为寄存器输入
     wire [`INST_DATA_WIDTH-1:0] inst_selected = (flush_en || !inst_valid_i) ? `INST_NOP : inst_i;
@@ -55,7 +68,7 @@ module ifu_pipe (
     gnrl_dfflr #(`INST_DATA_WIDTH) inst_ff (
         .clk  (clk),
         .rst_n(rst_n),
-        .lden (!stall_i),       // 当stall_i为1时不更新
+        .lden (lden),           // 当stall_i为1时不更新
         .dnxt (inst_selected),
         .qout (inst_r)
     );
@@ -70,7 +83,7 @@ module ifu_pipe (
     gnrl_dfflr #(`INST_ADDR_WIDTH) inst_addr_ff (
         .clk  (clk),
         .rst_n(rst_n),
-        .lden (!stall_i),       // 当stall_i为1时不更新
+        .lden (lden),           // 当stall_i为1时不更新
         .dnxt (addr_selected),
         .qout (inst_addr)
     );
@@ -81,21 +94,69 @@ module ifu_pipe (
     gnrl_dfflr #(1) is_pred_branch_ff (
         .clk  (clk),
         .rst_n(rst_n),
-        .lden (!stall_i),       // 当stall_i为1时不更新
+        .lden (lden),           // 当stall_i为1时不更新
         .dnxt (flush_en ? 1'b0 : is_pred_branch_i),
         .qout (is_pred_branch_r)
     );
     assign is_pred_branch_o = is_pred_branch_r;
 
+    // 寄存分支预测元数据，仅在预测分支时有意义，无需随冲刷清零
+    gnrl_dfflr #(`BPU_META_WIDTH) bpu_meta_ff (
+        .clk  (clk),
+        .rst_n(rst_n),
+        .lden (lden),           // 当stall_i为1时不更新
+        .dnxt (bpu_meta_i),
+        .qout (bpu_meta_o)
+    );
+
     // 寄存指令有效信号
     wire inst_valid_r;
     gnrl_dfflr #(1) inst_valid_ff (
         .clk  (clk),
         .rst_n(rst_n),
-        .lden (!stall_i),       // 当stall_i为1时不更新
+        .lden (lden),           // 当stall_i为1时不更新
         .dnxt (flush_en ? 1'b0 : inst_valid_i),
         .qout (inst_valid_r)
     );
     assign inst_valid_o = inst_valid_r;
 
+    // 寄存相邻的下一条指令，与第一条同步更新
+    gnrl_dfflr #(`INST_DATA_WIDTH) inst1_ff (
+        .clk  (clk),
+        .rst_n(rst_n),
+        .lden (lden),
+        .dnxt (inst1_i),
+        .qout (inst1_o)
+    );
+
+    wire inst1_valid_r;
+    gnrl_dfflr #(1) inst1_valid_ff (
+        .clk  (clk),
+        .rst_n(rst_n),
+        .lden (lden),
+        .dnxt (flush_en ? 1'b0 : inst1_valid_i),
+        .qout (inst1_valid_r)
+    );
+    assign inst1_valid_o = inst1_valid_r;
+
+    wire inst1_fuse_r;
+    gnrl_dfflr #(1) inst1_fuse_ff (
+        .clk  (clk),
+        .rst_n(rst_n),
+        .lden (lden),
+        .dnxt (flush_en ? 1'b0 : inst1_fuse_i),
+        .qout (inst1_fuse_r)
+    );
+    assign inst1_fuse_o = inst1_fuse_r;
+
+    wire inst_c_r;
+    gnrl_dfflr #(1) inst_c_ff (
+        .clk  (clk),
+        .rst_n(rst_n),
+        .lden (lden),
+        .dnxt (flush_en ? 1'b0 : inst_c_i),
+        .qout (inst_c_r)
+    );
+    assign inst_c_o = inst_c_r;
+
 endmodule
@@ -0,0 +1,126 @@
+/*         
+ The MIT License (MIT)
+
+ Copyright © 2025 Yusen Wang @yusen.w@qq.com
+                                                                         
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+                                                                         
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+                                                                         
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+`include "defines.svh"
+
+// RVC指令对齐模块
+// 取指AXI主机按32位字返回指令流，本模块按16位粒度从中切分出16/32位指令：
+//   字的低半字为压缩指令时先输出低半字，高半字存入半字缓冲，下一拍不取新字直接输出；
+//   高半字为32位指令的前半条时，与下一个字的低半字拼接后输出；
+//   跳转目标或BTB预测目标位于字中间(PC[1]为1)时，从该字的高半字开始。
+// 输出的压缩指令已展开为32位指令，并给出取指流在该指令之后实际继续的地址(供BPU校验)
+module ifu_rvc_align (
+    input wire clk,
+    input wire rst_n,
+
+    input wire                        jump_flag_i,  // 取指重定向，清空半字缓冲
+    input wire [`INST_ADDR_WIDTH-1:0] jump_addr_i,  // 重定向地址，PC[1]决定从哪个半字开始
+    input wire                        stall_i,      // 后级本周期不接收指令
+
+    // 来自取指AXI主机的字流
+    input  wire [`INST_DATA_WIDTH-1:0] word_i,        // 指令字
+    input  wire [`INST_ADDR_WIDTH-1:0] word_addr_i,   // 字地址(4字节对齐)
+    input  wire [`INST_ADDR_WIDTH-1:0] word_npc_i,    // 该字之后取指流继续的地址
+    input  wire                        word_valid_i,  // 指令字有效
+    output wire                        word_take_o,   // 本周期消耗该字
+
+    // 对齐后的指令
+    output wire [`INST_DATA_WIDTH-1:0] inst_o,           // 指令(压缩指令已展开)
+    output wire [`INST_ADDR_WIDTH-1:0] inst_addr_o,      // 指令地址
+    output wire [`INST_ADDR_WIDTH-1:0] inst_pred_npc_o,  // 取指流在该指令之后继续的地址
+    output wire                        inst_c_o,         // 压缩指令
+    output wire                        inst_valid_o,     // 指令有效
+
+    // 半字缓冲中32位指令的后半条不是顺序取回的(取指级BTB在该字之后跳转)，需从该指令重新取指
+    output wire                        realign_o,
+    output wire [`INST_ADDR_WIDTH-1:0] realign_addr_o
+);
+
+    // 半字缓冲：保存字的高半字及该字之后取指流继续的地址
+    reg                        half_valid;
+    reg [                15:0] half_data;
+    reg [`INST_ADDR_WIDTH-1:0] half_addr;
+    reg [`INST_ADDR_WIDTH-1:0] half_npc;
+    reg                        skip_lo;  // 下一个字从高半字开始
+
+    wire half_c = (half_data[1:0] != 2'b11);
+    wire half_seq = (half_npc == half_addr + 2);  // 缓冲半字所在字之后为顺序取指
+    wire lo_c = (word_i[1:0] != 2'b11);
+    wire hi_c = (word_i[17:16] != 2'b11);
+
+    // 本拍的指令来源
+    wire sel_half = half_valid && half_c;  // 缓冲中的压缩指令，不消耗新字
+    wire sel_span = half_valid && !half_c && half_seq && word_valid_i;  // 跨字的32位指令
+    wire sel_hi = !half_valid && word_valid_i && skip_lo;  // 从字的高半字开始
+    wire sel_lo = !half_valid && word_valid_i && !skip_lo;  // 从字的低半字开始
+
+    assign realign_o = half_valid && !half_c && !half_seq && !stall_i;
+    assign realign_addr_o = half_addr;
+
+    assign word_take_o = sel_span || sel_hi || sel_lo;
+
+    // 高半字为32位指令的前半条时先存入缓冲，本拍无指令输出
+    assign inst_valid_o = sel_half || sel_span || (sel_hi && hi_c) || sel_lo;
+
+    wire                        out_c = sel_half || sel_hi || (sel_lo && lo_c);
+    wire [                15:0] out_half = sel_half ? half_data : sel_hi ? word_i[31:16] : word_i[15:0];
+    wire [`INST_DATA_WIDTH-1:0] out_full = sel_span ? {word_i[15:0], half_data} : word_i;
+
+    wire [`INST_DATA_WIDTH-1:0] inst_exp;
+    ifu_rvc_expand u_ifu_rvc_expand (
+        .inst_i(out_half),
+        .inst_o(inst_exp)
+    );
+
+    assign inst_o = out_c ? inst_exp : out_full;
+    assign inst_c_o = out_c;
+    assign inst_addr_o = (sel_half || sel_span) ? half_addr : sel_hi ? word_addr_i + 2 : word_addr_i;
+    // 指令结束于字的中间时，取指流在同一字内顺序继续
+    assign inst_pred_npc_o = sel_half ? half_npc :
+                             (sel_span || (sel_lo && lo_c)) ? word_addr_i + 2 : word_npc_i;
+
+    // 消耗的字中是否还剩高半字需要缓冲
+    wire keep_hi = sel_span || (sel_hi && !hi_c) || (sel_lo && lo_c);
+
+    always @(posedge clk) begin
+        if (rst_n == 1'b0) begin
+            half_valid <= 1'b0;
+            skip_lo    <= 1'b0;
+        end else if (jump_flag_i) begin
+            half_valid <= 1'b0;
+            skip_lo    <= jump_addr_i[1];
+        end else if (!stall_i) begin
+            if (word_take_o) begin
+                half_valid <= keep_hi;
+                half_data  <= word_i[31:16];
+                half_addr  <= word_addr_i + 2;
+                half_npc   <= word_npc_i;
+                skip_lo    <= word_npc_i[1];
+            end else if (sel_half) begin
+                half_valid <= 1'b0;
+            end
+        end
+    end
+
+endmodule
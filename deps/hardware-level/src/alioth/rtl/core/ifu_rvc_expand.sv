@@ -0,0 +1,186 @@
+/*         
+ The MIT License (MIT)
+
+ Copyright © 2025 Yusen Wang @yusen.w@qq.com
+                                                                         
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+                                                                         
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+                                                                         
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+`include "defines.svh"
+
+// RVC压缩指令展开模块
+// 将16位压缩指令展开为等价的32位指令，后级译码与分支预测只需处理32位编码；
+// 保留编码及RV32中不存在的编码(浮点访存、RV64专用指令等)展开为全0，由译码级报非法指令
+module ifu_rvc_expand (
+    input  wire [15:0] inst_i,  // 16位压缩指令
+    output reg  [31:0] inst_o   // 展开后的32位指令
+);
+
+    localparam [6:0] OPC_LOAD = 7'b0000011;
+    localparam [6:0] OPC_STORE = 7'b0100011;
+    localparam [6:0] OPC_OP_IMM = 7'b0010011;
+    localparam [6:0] OPC_OP = 7'b0110011;
+    localparam [6:0] OPC_LUI = 7'b0110111;
+    localparam [6:0] OPC_BRANCH = 7'b1100011;
+    localparam [6:0] OPC_JALR = 7'b1100111;
+    localparam [6:0] OPC_JAL = 7'b1101111;
+
+    wire [       1:0] op = inst_i[1:0];
+    wire [       2:0] funct3 = inst_i[15:13];
+
+    // 完整寄存器字段与压缩寄存器字段(rd'/rs1'/rs2'对应x8-x15)
+    wire [       4:0] rd = inst_i[11:7];
+    wire [       4:0] rs2 = inst_i[6:2];
+    wire [       4:0] rs1_p = {2'b01, inst_i[9:7]};
+    wire [       4:0] rs2_p = {2'b01, inst_i[4:2]};
+
+    // 各格式立即数，按32位指令的立即数宽度展开
+    wire [      11:0] imm_ci = {{6{inst_i[12]}}, inst_i[12], inst_i[6:2]};
+    wire [      11:0] imm_addi4spn = {2'b00, inst_i[10:7], inst_i[12:11], inst_i[5], inst_i[6], 2'b00};
+    wire [      11:0] imm_addi16sp = {{2{inst_i[12]}}, inst_i[12], inst_i[4:3], inst_i[5], inst_i[2], inst_i[6], 4'b0};
+    wire [      11:0] imm_lw = {5'b0, inst_i[5], inst_i[12:10], inst_i[6], 2'b00};
+    wire [      11:0] imm_lwsp = {4'b0, inst_i[3:2], inst_i[12], inst_i[6:4], 2'b00};
+    wire [      11:0] imm_swsp = {4'b0, inst_i[8:7], inst_i[12:9], 2'b00};
+    wire [      19:0] imm_lui = {{14{inst_i[12]}}, inst_i[12], inst_i[6:2]};
+    wire [      12:0] imm_b = {{4{inst_i[12]}}, inst_i[12], inst_i[6:5], inst_i[2], inst_i[11:10], inst_i[4:3], 1'b0};
+    wire [      20:0] imm_j = {
+        {9{inst_i[12]}}, inst_i[12], inst_i[8], inst_i[10:9], inst_i[6], inst_i[7], inst_i[2], inst_i[11], inst_i[5:3], 1'b0
+    };
+
+    // RV32中移位量最高位必须为0
+    wire [       4:0] shamt = inst_i[6:2];
+    wire              shamt_ok = !inst_i[12];
+
+    function automatic [31:0] enc_i(input [11:0] imm, input [4:0] rs1, input [2:0] f3,
+                                    input [4:0] rd_, input [6:0] opc);
+        enc_i = {imm, rs1, f3, rd_, opc};
+    endfunction
+
+    function automatic [31:0] enc_s(input [11:0] imm, input [4:0] rs2_, input [4:0] rs1,
+                                    input [2:0] f3);
+        enc_s = {imm[11:5], rs2_, rs1, f3, imm[4:0], OPC_STORE};
+    endfunction
+
+    function automatic [31:0] enc_r(input [6:0] f7, input [4:0] rs2_, input [4:0] rs1,
+                                    input [2:0] f3, input [4:0] rd_);
+        enc_r = {f7, rs2_, rs1, f3, rd_, OPC_OP};
+    endfunction
+
+    function automatic [31:0] enc_b(input [12:0] imm, input [4:0] rs1, input [2:0] f3);
+        enc_b = {imm[12], imm[10:5], 5'd0, rs1, f3, imm[4:1], imm[11], OPC_BRANCH};
+    endfunction
+
+    function automatic [31:0] enc_j(input [20:0] imm, input [4:0] rd_);
+        enc_j = {imm[20], imm[10:1], imm[11], imm[19:12], rd_, OPC_JAL};
+    endfunction
+
+    always @(*) begin
+        inst_o = 32'h0;
+        case (op)
+            // 象限0: 栈指针相对加法与寄存器相对访存
+            2'b00: begin
+                case (funct3)
+                    3'b000:  // c.addi4spn -> addi rd', x2, nzuimm
+                    if (imm_addi4spn != 12'd0) inst_o = enc_i(imm_addi4spn, 5'd2, 3'b000, rs2_p, OPC_OP_IMM);
+                    3'b010:  // c.lw -> lw rd', uimm(rs1')
+                    inst_o = enc_i(imm_lw, rs1_p, 3'b010, rs2_p, OPC_LOAD);
+                    3'b110:  // c.sw -> sw rs2', uimm(rs1')
+                    inst_o = enc_s(imm_lw, rs2_p, rs1_p, 3'b010);
+                    default: ;
+                endcase
+            end
+            // 象限1: 立即数运算、控制转移与压缩寄存器运算
+            2'b01: begin
+                case (funct3)
+                    3'b000:  // c.addi/c.nop -> addi rd, rd, imm
+                    inst_o = enc_i(imm_ci, rd, 3'b000, rd, OPC_OP_IMM);
+                    3'b001:  // c.jal -> jal x1, offset
+                    inst_o = enc_j(imm_j, 5'd1);
+                    3'b010:  // c.li -> addi rd, x0, imm
+                    inst_o = enc_i(imm_ci, 5'd0, 3'b000, rd, OPC_OP_IMM);
+                    3'b011: begin
+                        if (rd == 5'd2) begin  // c.addi16sp -> addi x2, x2, nzimm
+                            if (imm_addi16sp != 12'd0)
+                                inst_o = enc_i(imm_addi16sp, 5'd2, 3'b000, 5'd2, OPC_OP_IMM);
+                        end else begin  // c.lui -> lui rd, nzimm
+                            if (imm_ci != 12'd0) inst_o = {imm_lui, rd, OPC_LUI};
+                        end
+                    end
+                    3'b100: begin
+                        case (inst_i[11:10])
+                            2'b00:  // c.srli
+                            if (shamt_ok) inst_o = enc_i({7'b0000000, shamt}, rs1_p, 3'b101, rs1_p, OPC_OP_IMM);
+                            2'b01:  // c.srai
+                            if (shamt_ok) inst_o = enc_i({7'b0100000, shamt}, rs1_p, 3'b101, rs1_p, OPC_OP_IMM);
+                            2'b10:  // c.andi
+                            inst_o = enc_i(imm_ci, rs1_p, 3'b111, rs1_p, OPC_OP_IMM);
+                            default: begin
+                                // c.sub/c.xor/c.or/c.and，inst[12]为1的是RV64的c.subw/c.addw
+                                if (!inst_i[12]) begin
+                                    case (inst_i[6:5])
+                                        2'b00: inst_o = enc_r(7'b0100000, rs2_p, rs1_p, 3'b000, rs1_p);
+                                        2'b01: inst_o = enc_r(7'b0000000, rs2_p, rs1_p, 3'b100, rs1_p);
+                                        2'b10: inst_o = enc_r(7'b0000000, rs2_p, rs1_p, 3'b110, rs1_p);
+                                        default: inst_o = enc_r(7'b0000000, rs2_p, rs1_p, 3'b111, rs1_p);
+                                    endcase
+                                end
+                            end
+                        endcase
+                    end
+                    3'b101:  // c.j -> jal x0, offset
+                    inst_o = enc_j(imm_j, 5'd0);
+                    3'b110:  // c.beqz -> beq rs1', x0, offset
+                    inst_o = enc_b(imm_b, rs1_p, 3'b000);
+                    default:  // c.bnez -> bne rs1', x0, offset
+                    inst_o = enc_b(imm_b, rs1_p, 3'b001);
+                endcase
+            end
+            // 象限2: 移位、栈指针相对访存与寄存器跳转/传送
+            2'b10: begin
+                case (funct3)
+                    3'b000:  // c.slli -> slli rd, rd, shamt
+                    if (shamt_ok) inst_o = enc_i({7'b0000000, shamt}, rd, 3'b001, rd, OPC_OP_IMM);
+                    3'b010:  // c.lwsp -> lw rd, uimm(x2)，rd为0保留
+                    if (rd != 5'd0) inst_o = enc_i(imm_lwsp, 5'd2, 3'b010, rd, OPC_LOAD);
+                    3'b100: begin
+                        if (!inst_i[12]) begin
+                            if (rs2 == 5'd0) begin  // c.jr -> jalr x0, 0(rs1)，rs1为0保留
+                                if (rd != 5'd0) inst_o = enc_i(12'd0, rd, 3'b000, 5'd0, OPC_JALR);
+                            end else begin  // c.mv -> add rd, x0, rs2
+                                inst_o = enc_r(7'b0000000, rs2, 5'd0, 3'b000, rd);
+                            end
+                        end else begin
+                            if (rs2 == 5'd0) begin
+                                if (rd == 5'd0) inst_o = `INST_EBREAK;  // c.ebreak
+                                else inst_o = enc_i(12'd0, rd, 3'b000, 5'd1, OPC_JALR);  // c.jalr
+                            end else begin  // c.add -> add rd, rd, rs2
+                                inst_o = enc_r(7'b0000000, rs2, rd, 3'b000, rd);
+                            end
+                        end
+                    end
+                    3'b110:  // c.swsp -> sw rs2, uimm(x2)
+                    inst_o = enc_s(imm_swsp, rs2, 5'd2, 3'b010);
+                    default: ;
+                endcase
+            end
+            default: ;
+        endcase
+    end
+
+endmodule
@@ -41,13 +41,23 @@ module inst_reserve_stack #(
     input wire [`INST_DATA_WIDTH-1:0] inst_i,            // 指令内容
     input wire [`INST_ADDR_WIDTH-1:0] inst_addr_i,       // 指令地址
     input wire                        is_pred_branch_i,  // 预测分支指令标志
+    input wire [ `BPU_META_WIDTH-1:0] bpu_meta_i,        // 分支预测元数据
     input wire                        inst_valid_i,      // 指令有效
+    input wire [`INST_DATA_WIDTH-1:0] inst1_i,           // 相邻的下一条指令
+    input wire                        inst1_valid_i,     // 第二条指令与第一条成对发射
+    input wire                        inst1_fuse_i,      // 第二条指令与第一条融合
+    input wire                        inst_c_i,          // 压缩指令
 
     // 输出信号组
     output wire [`INST_DATA_WIDTH-1:0] inst_o,
     output wire [`INST_ADDR_WIDTH-1:0] inst_addr_o,
     output wire                        is_pred_branch_o,
-    output wire                        inst_valid_o
+    output wire [ `BPU_META_WIDTH-1:0] bpu_meta_o,
+    output wire                        inst_valid_o,
+    output wire [`INST_DATA_WIDTH-1:0] inst1_o,
+    output wire                        inst1_valid_o,
+    output wire                        inst1_fuse_o,
+    output wire                        inst_c_o
 );
 
     // FIFO状态信号
@@ -71,7 +81,12 @@ module inst_reserve_stack #(
         logic [`INST_DATA_WIDTH-1:0] inst;
         logic [`INST_ADDR_WIDTH-1:0] inst_addr;
         logic                        is_pred_branch;
+        logic [`BPU_META_WIDTH-1:0]  bpu_meta;
         logic                        inst_valid;
+        logic [`INST_DATA_WIDTH-1:0] inst1;
+        logic                        inst1_valid;
+        logic                        inst1_fuse;
+        logic                        inst_c;
     } fifo_data_t;
 
     // FIFO存储器
@@ -82,7 +97,12 @@ module inst_reserve_stack #(
     assign input_data.inst           = inst_i;
     assign input_data.inst_addr      = inst_addr_i;
     assign input_data.is_pred_branch = is_pred_branch_i;
+    assign input_data.bpu_meta       = bpu_meta_i;
     assign input_data.inst_valid     = inst_valid_i;
+    assign input_data.inst1          = inst1_i;
+    assign input_data.inst1_valid    = inst1_valid_i;
+    assign input_data.inst1_fuse     = inst1_fuse_i;
+    assign input_data.inst_c         = inst_c_i;
 
     // FIFO输出数据
     fifo_data_t output_data;
@@ -94,7 +114,12 @@ module inst_reserve_stack #(
     assign inst_o           = output_data.inst;
     assign inst_addr_o      = output_data.inst_addr;
     assign is_pred_branch_o = output_data.is_pred_branch;
+    assign bpu_meta_o       = output_data.bpu_meta;
     assign inst_valid_o     = output_data.inst_valid;
+    assign inst1_o          = output_data.inst1;
+    assign inst1_valid_o    = output_data.inst1_valid;
+    assign inst1_fuse_o     = output_data.inst1_fuse;
+    assign inst_c_o         = output_data.inst_c;
 
     // FIFO满状态输出
     assign fifo_full_o      = fifo_full;
@@ -26,10 +26,13 @@
 
 /*
  乘法模块
- 3级流水线实现，支持有符号和无符号32位整数乘法指令（MUL/MULH/MULHSU/MULHU）
+ 1~3级流水线实现(由`MUL_STAGES配置)，支持有符号和无符号32位整数乘法指令（MUL/MULH/MULHSU/MULHU）
  第一级：符号处理和操作数准备
  第二级：分块乘法计算
  第三级：结果累加和输出选择
+ 级数小于3时，前级寄存器被旁路为组合逻辑，结果始终在最后一级寄存输出
+ MUL与MULH[S][U]融合：操作数与上一条乘法相同且符号类型兼容时，不再重复计算，
+ 直接从上一条乘法已得到的64位乘积中取出所需的高/低32位
  支持流水线暂停控制，兼容RISC-V乘法扩展指令
 */
 module mul (
@@ -52,17 +55,18 @@ module mul (
     output reg [`COMMIT_ID_WIDTH-1:0] commit_id_o     // 提交ID输出
 );
 
+    localparam int STAGES = `MUL_STAGES;
+
     // 流水线暂停控制信号
     wire                       pipeline_enable = ctrl_ready_i;
 
     // 第一级流水线寄存器
     reg  [                3:0] op_s1;
-    reg  [`REG_DATA_WIDTH-1:0] abs_multiplicand_s1;
-    reg  [`REG_DATA_WIDTH-1:0] abs_multiplier_s1;
     reg                        result_sign_s1;
     reg [15:0] a_low_s1, a_high_s1;
     reg [15:0] b_low_s1, b_high_s1;
     reg valid_s1;
+    reg fuse_s1;
     reg [ `REG_ADDR_WIDTH-1:0] reg_waddr_s1;
     reg [`COMMIT_ID_WIDTH-1:0] commit_id_s1;
 
@@ -71,6 +75,7 @@ module mul (
     reg result_sign_s2;
     reg [31:0] mul_blk_s2[0:3];
     reg valid_s2;
+    reg fuse_s2;
     reg [ `REG_ADDR_WIDTH-1:0] reg_waddr_s2;
     reg [`COMMIT_ID_WIDTH-1:0] commit_id_s2;
 
@@ -85,74 +90,134 @@ module mul (
     wire [`REG_DATA_WIDTH-1:0] mcand_tmp  = both_unsigned ? multiplicand_i : (mcand_is_neg ? -multiplicand_i : multiplicand_i);
     wire [`REG_DATA_WIDTH-1:0] mplier_tmp = both_unsigned ? multiplier_i   : (mplier_is_neg ? -multiplier_i : multiplier_i);
 
-    // 第一级流水线：符号处理和操作数准备
-    always @(posedge clk) begin
-        if (!rst_n) begin
-            op_s1                                      <= 4'h0;
-            abs_multiplicand_s1                        <= `ZeroWord;
-            abs_multiplier_s1                          <= `ZeroWord;
-            result_sign_s1                             <= 1'b0;
-            {a_low_s1, a_high_s1, b_low_s1, b_high_s1} <= 0;
-            valid_s1                                   <= 1'b0;
-            reg_waddr_s1                               <= {`REG_ADDR_WIDTH{1'b0}};
-            commit_id_s1                               <= {`COMMIT_ID_WIDTH{1'b0}};
-        end else if (pipeline_enable) begin
-            op_s1 <= op_i;
-
-            // 操作数绝对值计算
-            abs_multiplicand_s1 <= mcand_tmp;
-            abs_multiplier_s1 <= mplier_tmp;
+    // 结果符号计算（仅有符号乘法需要）
+    wire result_sign_nxt = both_unsigned ? 1'b0 : ((mcand_is_neg ^ mplier_is_neg) && (mcand_signed || mplier_signed));
 
-            // 结果符号计算（仅有符号乘法需要）
-            result_sign_s1 <= both_unsigned ? 1'b0 : ((mcand_is_neg ^ mplier_is_neg) && (mcand_signed || mplier_signed));
+    // ==================== MUL/MULH融合检测 ====================
+    // 记录上一条实际计算的乘法的操作数及符号类型，其64位乘积在输出级保存；
+    // 低32位与符号类型无关，MUL总可复用；高32位要求符号类型相同(MUL与MULH同为有符号×有符号)
+    reg [`REG_DATA_WIDTH-1:0] last_multiplicand;
+    reg [`REG_DATA_WIDTH-1:0] last_multiplier;
+    reg [1:0] last_sign_type;
+    reg last_valid;
+    reg [2*`REG_DATA_WIDTH-1:0] last_product;
 
-            // 拆分为16位块
-            a_low_s1 <= mcand_tmp[15:0];
-            a_high_s1 <= mcand_tmp[31:16];
-            b_low_s1 <= mplier_tmp[15:0];
-            b_high_s1 <= mplier_tmp[31:16];
+    wire fuse_hit = last_valid && (multiplicand_i == last_multiplicand) && (multiplier_i == last_multiplier) &&
+                    ((op_i == 4'b0001) || ({mcand_signed, mplier_signed} == last_sign_type));
 
-            valid_s1 <= valid_in;
-            reg_waddr_s1 <= reg_waddr_i;
-            commit_id_s1 <= commit_id_i;
-        end
-    end
-
-    // 第二级流水线：分块乘法计算
     always @(posedge clk) begin
         if (!rst_n) begin
-            op_s2          <= 4'h0;
-            result_sign_s2 <= 1'b0;
-            mul_blk_s2[0]  <= 32'b0;
-            mul_blk_s2[1]  <= 32'b0;
-            mul_blk_s2[2]  <= 32'b0;
-            mul_blk_s2[3]  <= 32'b0;
-            valid_s2       <= 1'b0;
-            reg_waddr_s2   <= {`REG_ADDR_WIDTH{1'b0}};
-            commit_id_s2   <= {`COMMIT_ID_WIDTH{1'b0}};
-        end else if (pipeline_enable) begin
-            op_s2          <= op_s1;
-            result_sign_s2 <= result_sign_s1;
-
-            // 一次性计算4个分块乘法结果
-            mul_blk_s2[0]  <= a_low_s1 * b_low_s1;
-            mul_blk_s2[1]  <= a_high_s1 * b_low_s1;
-            mul_blk_s2[2]  <= a_low_s1 * b_high_s1;
-            mul_blk_s2[3]  <= a_high_s1 * b_high_s1;
-
-            valid_s2       <= valid_s1;
-            reg_waddr_s2   <= reg_waddr_s1;
-            commit_id_s2   <= commit_id_s1;
+            last_multiplicand <= `ZeroWord;
+            last_multiplier   <= `ZeroWord;
+            last_sign_type    <= 2'b0;
+            last_valid        <= 1'b0;
+        end else if (pipeline_enable && valid_in && !fuse_hit) begin
+            last_multiplicand <= multiplicand_i;
+            last_multiplier   <= multiplier_i;
+            last_sign_type    <= {mcand_signed, mplier_signed};
+            last_valid        <= 1'b1;
         end
     end
 
+    // 第一级流水线：符号处理和操作数准备
+    generate
+        if (STAGES >= 3) begin : gen_s1_reg
+            always @(posedge clk) begin
+                if (!rst_n) begin
+                    op_s1                                      <= 4'h0;
+                    result_sign_s1                             <= 1'b0;
+                    {a_low_s1, a_high_s1, b_low_s1, b_high_s1} <= 0;
+                    valid_s1                                   <= 1'b0;
+                    fuse_s1                                    <= 1'b0;
+                    reg_waddr_s1                               <= {`REG_ADDR_WIDTH{1'b0}};
+                    commit_id_s1                               <= {`COMMIT_ID_WIDTH{1'b0}};
+                end else if (pipeline_enable) begin
+                    op_s1          <= op_i;
+                    result_sign_s1 <= result_sign_nxt;
+                    // 拆分为16位块
+                    a_low_s1       <= mcand_tmp[15:0];
+                    a_high_s1      <= mcand_tmp[31:16];
+                    b_low_s1       <= mplier_tmp[15:0];
+                    b_high_s1      <= mplier_tmp[31:16];
+                    valid_s1       <= valid_in;
+                    fuse_s1        <= valid_in && fuse_hit;
+                    reg_waddr_s1   <= reg_waddr_i;
+                    commit_id_s1   <= commit_id_i;
+                end
+            end
+        end else begin : gen_s1_comb
+            always_comb begin
+                op_s1          = op_i;
+                result_sign_s1 = result_sign_nxt;
+                a_low_s1       = mcand_tmp[15:0];
+                a_high_s1      = mcand_tmp[31:16];
+                b_low_s1       = mplier_tmp[15:0];
+                b_high_s1      = mplier_tmp[31:16];
+                valid_s1       = valid_in;
+                fuse_s1        = valid_in && fuse_hit;
+                reg_waddr_s1   = reg_waddr_i;
+                commit_id_s1   = commit_id_i;
+            end
+        end
+    endgenerate
+
+    // 第二级流水线：分块乘法计算，融合指令不更新分块乘积
+    generate
+        if (STAGES >= 2) begin : gen_s2_reg
+            always @(posedge clk) begin
+                if (!rst_n) begin
+                    op_s2          <= 4'h0;
+                    result_sign_s2 <= 1'b0;
+                    mul_blk_s2[0]  <= 32'b0;
+                    mul_blk_s2[1]  <= 32'b0;
+                    mul_blk_s2[2]  <= 32'b0;
+                    mul_blk_s2[3]  <= 32'b0;
+                    valid_s2       <= 1'b0;
+                    fuse_s2        <= 1'b0;
+                    reg_waddr_s2   <= {`REG_ADDR_WIDTH{1'b0}};
+                    commit_id_s2   <= {`COMMIT_ID_WIDTH{1'b0}};
+                end else if (pipeline_enable) begin
+                    op_s2          <= op_s1;
+                    result_sign_s2 <= result_sign_s1;
+
+                    // 一次性计算4个分块乘法结果
+                    if (!fuse_s1) begin
+                        mul_blk_s2[0] <= a_low_s1 * b_low_s1;
+                        mul_blk_s2[1] <= a_high_s1 * b_low_s1;
+                        mul_blk_s2[2] <= a_low_s1 * b_high_s1;
+                        mul_blk_s2[3] <= a_high_s1 * b_high_s1;
+                    end
+
+                    valid_s2       <= valid_s1;
+                    fuse_s2        <= fuse_s1;
+                    reg_waddr_s2   <= reg_waddr_s1;
+                    commit_id_s2   <= commit_id_s1;
+                end
+            end
+        end else begin : gen_s2_comb
+            always_comb begin
+                op_s2          = op_s1;
+                result_sign_s2 = result_sign_s1;
+                mul_blk_s2[0]  = a_low_s1 * b_low_s1;
+                mul_blk_s2[1]  = a_high_s1 * b_low_s1;
+                mul_blk_s2[2]  = a_low_s1 * b_high_s1;
+                mul_blk_s2[3]  = a_high_s1 * b_high_s1;
+                valid_s2       = valid_s1;
+                fuse_s2        = fuse_s1;
+                reg_waddr_s2   = reg_waddr_s1;
+                commit_id_s2   = commit_id_s1;
+            end
+        end
+    endgenerate
+
     // 第三级流水线：结果累加和输出选择
     always @(posedge clk) begin
         if (!rst_n) begin
-            result_o <= `ZeroWord;
-            valid_o  <= 1'b0;
-            reg_waddr_o <= {`REG_ADDR_WIDTH{1'b0}};
-            commit_id_o <= {`COMMIT_ID_WIDTH{1'b0}};
+            result_o     <= `ZeroWord;
+            valid_o      <= 1'b0;
+            reg_waddr_o  <= {`REG_ADDR_WIDTH{1'b0}};
+            commit_id_o  <= {`COMMIT_ID_WIDTH{1'b0}};
+            last_product <= {(2 * `REG_DATA_WIDTH){1'b0}};
         end else if (pipeline_enable) begin
             logic [2*`REG_DATA_WIDTH-1:0] final_result;
 
@@ -167,6 +232,13 @@ module mul (
                 final_result = result_sign_s2 ? -final_result : final_result;
             end
 
+            // 融合指令直接使用上一条乘法的乘积，否则保存本次乘积供后续融合
+            if (fuse_s2) begin
+                final_result = last_product;
+            end else if (valid_s2) begin
+                last_product <= final_result;
+            end
+
             // 指令类型选择输出高/低32位
             case (op_s2)
                 4'b0001: result_o <= final_result[`REG_DATA_WIDTH-1:0];  // MUL，低32位
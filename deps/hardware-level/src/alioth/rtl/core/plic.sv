@@ -18,7 +18,11 @@ module plic (
     input wire [`PLIC_NUM_SOURCES-1:0] irq_sources,
 
     // 输出最高优先级中断号和中断有效信号
-    output reg irq_valid  // 有效中断输出
+    output reg irq_valid,  // 有效中断输出
+
+    // 当前最高优先级中断的处理函数地址与参数，供快速中断直接跳转
+    output wire [31:0] irq_vec_o,
+    output wire [31:0] irq_arg_o
 );
 
     parameter PLIC_INT_VECTABLE_ADDR = `PLIC_INT_VECTABLE_ADDR;  // 中断向量表地址
@@ -116,6 +120,9 @@ module plic (
         end
     end
 
+    assign irq_vec_o = mvec;
+    assign irq_arg_o = marg;
+
     // 写操作
     always @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
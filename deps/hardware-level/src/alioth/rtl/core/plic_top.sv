@@ -28,7 +28,9 @@ module plic_top #(
     input  wire                                S_AXI_RREADY,
     // 外部中断源输入
     input  wire [       `PLIC_NUM_SOURCES-1:0] irq_sources,
-    output wire                                irq_valid       // 有效中断输出
+    output wire                                irq_valid,      // 有效中断输出
+    output wire [                        31:0] irq_vec_o,      // 最高优先级中断的处理函数地址
+    output wire [                        31:0] irq_arg_o       // 最高优先级中断的处理函数参数
 );
 
     reg  [C_S_AXI_ADDR_WIDTH-1 : 0] axi_awaddr;
@@ -212,7 +214,9 @@ module plic_top #(
         .raddr      (plic_raddr),
         .rdata      (plic_rdata),
         .irq_sources(irq_sources),
-        .irq_valid  (irq_valid)
+        .irq_valid  (irq_valid),
+        .irq_vec_o  (irq_vec_o),
+        .irq_arg_o  (irq_arg_o)
     );
 
 endmodule
@@ -66,17 +66,36 @@ module wbu (
     input wire [ `REG_DATA_WIDTH-1:0] lsu_reg_wdata_i,
     input wire                        lsu_reg_we_i,
     input wire [ `REG_ADDR_WIDTH-1:0] lsu_reg_waddr_i,
-    input wire [`COMMIT_ID_WIDTH-1:0] lsu_commit_id_i,  // LSU指令ID，修改为3位
+    input wire [`COMMIT_ID_WIDTH-1:0] lsu_commit_id_i,  // LSU指令ID
+
+    // 来自EXU的双发射第二条ALU指令数据，独占GPR第三写端口
+    input wire [`REG_DATA_WIDTH-1:0] dual_reg_wdata_i,
+    input wire                       dual_reg_we_i,
+    input wire [`REG_ADDR_WIDTH-1:0] dual_reg_waddr_i,
 
     // 长指令完成信号（对接hazard_detection）
     output wire                        commit_valid_o,  // 指令完成有效信号
     output wire [`COMMIT_ID_WIDTH-1:0] commit_id_o,     // 完成指令ID
 
+    // LSU独立写端口的完成信号，与上一组同拍有效
+    output wire                        commit2_valid_o,
+    output wire [`COMMIT_ID_WIDTH-1:0] commit2_id_o,
+
     // 寄存器写回接口
     output wire [`REG_DATA_WIDTH-1:0] reg_wdata_o,
     output wire                       reg_we_o,
     output wire [`REG_ADDR_WIDTH-1:0] reg_waddr_o,
 
+    // LSU独立寄存器写回接口
+    output wire [`REG_DATA_WIDTH-1:0] reg2_wdata_o,
+    output wire                       reg2_we_o,
+    output wire [`REG_ADDR_WIDTH-1:0] reg2_waddr_o,
+
+    // 双发射第二条指令寄存器写回接口
+    output wire [`REG_DATA_WIDTH-1:0] reg3_wdata_o,
+    output wire                       reg3_we_o,
+    output wire [`REG_ADDR_WIDTH-1:0] reg3_waddr_o,
+
     // CSR寄存器写回接口
     output wire [`REG_DATA_WIDTH-1:0] csr_wdata_o,
     output wire                       csr_we_o,
@@ -84,7 +103,7 @@ module wbu (
 );
 
     // === 使用FIFO模块实例化各种缓冲区 ===
-    localparam FIFO_DEPTH = 2;
+    localparam FIFO_DEPTH = `WBU_FIFO_DEPTH;
 
     // MUL FIFO
     wire [`REG_DATA_WIDTH-1:0] mul_fifo_wdata;
@@ -184,7 +203,10 @@ module wbu (
 
     // === 冲突判断 ===
     // 优先级: lsu > FIFO输出(mul > div > csr > alu) > 普通输入(mul > div > csr > alu)
-    wire lsu_active = lsu_reg_we_i;
+    // LSU独立写端口打开时lsu不参与仲裁
+    localparam LSU_PORT_EN = (`WBU_LSU_PORT != 0);
+    wire lsu_port_we = LSU_PORT_EN && lsu_reg_we_i;
+    wire lsu_active = !LSU_PORT_EN && lsu_reg_we_i;
     wire mul_active = mul_reg_we_i;
     wire div_active = div_reg_we_i;
     wire csr_reg_active = csr_reg_we_i;
@@ -308,6 +330,75 @@ module wbu (
     assign reg_wdata_o   = reg_wdata_ff;
     assign reg_waddr_o   = reg_waddr_ff;
 
+    // LSU独立写端口同样打一拍输出，并单独给出完成信号
+    reg [`REG_DATA_WIDTH-1:0]  reg2_wdata_ff;
+    reg [`REG_ADDR_WIDTH-1:0]  reg2_waddr_ff;
+    reg [`COMMIT_ID_WIDTH-1:0] commit2_id_ff;
+    reg                        reg2_we_ff;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            reg2_wdata_ff <= '0;
+            reg2_waddr_ff <= '0;
+            commit2_id_ff <= '0;
+            reg2_we_ff    <= 1'b0;
+        end else begin
+            reg2_wdata_ff <= lsu_reg_wdata_i;
+            reg2_waddr_ff <= lsu_reg_waddr_i;
+            commit2_id_ff <= lsu_commit_id_i;
+            reg2_we_ff    <= lsu_port_we;
+        end
+    end
+
+    assign reg2_we_o       = reg2_we_ff;
+    assign reg2_wdata_o    = reg2_wdata_ff;
+    assign reg2_waddr_o    = reg2_waddr_ff;
+    assign commit2_valid_o = reg2_we_ff;
+    assign commit2_id_o    = commit2_id_ff;
+
+    // 双发射第二条指令不占用记分板，结果同样打一拍写入GPR第三写端口
+    reg [`REG_DATA_WIDTH-1:0] reg3_wdata_ff;
+    reg [`REG_ADDR_WIDTH-1:0] reg3_waddr_ff;
+    reg                       reg3_we_ff;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            reg3_wdata_ff <= '0;
+            reg3_waddr_ff <= '0;
+            reg3_we_ff    <= 1'b0;
+        end else begin
+            reg3_wdata_ff <= dual_reg_wdata_i;
+            reg3_waddr_ff <= dual_reg_waddr_i;
+            reg3_we_ff    <= dual_reg_we_i;
+        end
+    end
+
+    assign reg3_we_o    = reg3_we_ff;
+    assign reg3_wdata_o = reg3_wdata_ff;
+    assign reg3_waddr_o = reg3_waddr_ff;
+
+`ifndef SYNTHESIS
+    // 各通道仲裁失败、结果进入FIFO暂存的次数(仅供仿真统计)
+    reg [31:0] alu_lost_cnt;
+    reg [31:0] mul_lost_cnt;
+    reg [31:0] div_lost_cnt;
+    reg [31:0] csr_lost_cnt;
+
+    always_ff @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            alu_lost_cnt <= 32'b0;
+            mul_lost_cnt <= 32'b0;
+            div_lost_cnt <= 32'b0;
+            csr_lost_cnt <= 32'b0;
+        end else begin
+            if (alu_fifo_push) alu_lost_cnt <= alu_lost_cnt + 1'b1;
+            if (mul_fifo_push) mul_lost_cnt <= mul_lost_cnt + 1'b1;
+            if (div_fifo_push) div_lost_cnt <= div_lost_cnt + 1'b1;
+            if (csr_fifo_push) csr_lost_cnt <= csr_lost_cnt + 1'b1;
+        end
+    end
+`endif
+
     // CSR寄存器写回信号打一拍输出
     assign csr_we_o      = csr_we_ff;
     assign csr_wdata_o   = csr_wdata_ff;
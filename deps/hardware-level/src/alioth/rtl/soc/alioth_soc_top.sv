@@ -238,12 +238,73 @@ module alioth_soc_top (
     wire                        DMEM_AXI_RVALID;
     wire                        DMEM_AXI_RREADY;
 
+    // XMEM(外部存储器) AXI接口信号定义
+    wire [   `BUS_ID_WIDTH-1:0] XMEM_AXI_AWID;
+    wire [                31:0] XMEM_AXI_AWADDR;
+    wire [                 7:0] XMEM_AXI_AWLEN;
+    wire [                 2:0] XMEM_AXI_AWSIZE;
+    wire [                 1:0] XMEM_AXI_AWBURST;
+    wire                        XMEM_AXI_AWLOCK;
+    wire [                 3:0] XMEM_AXI_AWCACHE;
+    wire [                 2:0] XMEM_AXI_AWPROT;
+    wire                        XMEM_AXI_AWVALID;
+    wire                        XMEM_AXI_AWREADY;
+    wire [                31:0] XMEM_AXI_WDATA;
+    wire [                 3:0] XMEM_AXI_WSTRB;
+    wire                        XMEM_AXI_WLAST;
+    wire                        XMEM_AXI_WVALID;
+    wire                        XMEM_AXI_WREADY;
+    wire [   `BUS_ID_WIDTH-1:0] XMEM_AXI_BID;
+    wire [                 1:0] XMEM_AXI_BRESP;
+    wire                        XMEM_AXI_BVALID;
+    wire                        XMEM_AXI_BREADY;
+    wire [   `BUS_ID_WIDTH-1:0] XMEM_AXI_ARID;
+    wire [                31:0] XMEM_AXI_ARADDR;
+    wire [                 7:0] XMEM_AXI_ARLEN;
+    wire [                 2:0] XMEM_AXI_ARSIZE;
+    wire [                 1:0] XMEM_AXI_ARBURST;
+    wire                        XMEM_AXI_ARLOCK;
+    wire [                 3:0] XMEM_AXI_ARCACHE;
+    wire [                 2:0] XMEM_AXI_ARPROT;
+    wire                        XMEM_AXI_ARVALID;
+    wire                        XMEM_AXI_ARREADY;
+    wire [   `BUS_ID_WIDTH-1:0] XMEM_AXI_RID;
+    wire [                31:0] XMEM_AXI_RDATA;
+    wire [                 1:0] XMEM_AXI_RRESP;
+    wire                        XMEM_AXI_RLAST;
+    wire                        XMEM_AXI_RVALID;
+    wire                        XMEM_AXI_RREADY;
+
+    // ITCM直连取指端口
+    wire [`INST_ADDR_WIDTH-1:0] itcm_fetch_addr;
+    wire [`INST_DATA_WIDTH-1:0] itcm_fetch_data;
+    wire [`INST_DATA_WIDTH-1:0] itcm_fetch_data1;  // 下一个字，双发射或指令融合时每拍取回两条指令
+
+    // DTCM直连访存端口
+    wire [ `BUS_ADDR_WIDTH-1:0] dtcm_raddr;
+    wire [ `BUS_DATA_WIDTH-1:0] dtcm_rdata;
+    wire                        dtcm_we;
+    wire [                 3:0] dtcm_wmask;
+    wire [ `BUS_ADDR_WIDTH-1:0] dtcm_waddr;
+    wire [ `BUS_DATA_WIDTH-1:0] dtcm_wdata;
+
     // alioth处理器核模块例化
     cpu_top u_cpu_top (
         .clk        (clk),
         .rst_n      (rst_n),
         .irq_sources(irq_vec), // 中断向量输入
 
+        .itcm_fetch_addr_o(itcm_fetch_addr),
+        .itcm_fetch_data_i(itcm_fetch_data),
+        .itcm_fetch_data1_i(itcm_fetch_data1),
+
+        .dtcm_raddr_o(dtcm_raddr),
+        .dtcm_rdata_i(dtcm_rdata),
+        .dtcm_we_o   (dtcm_we),
+        .dtcm_wmask_o(dtcm_wmask),
+        .dtcm_waddr_o(dtcm_waddr),
+        .dtcm_wdata_o(dtcm_wdata),
+
         // M0 AXI接口 - IFU指令获取
         .M0_AXI_ARID   (M0_AXI_ARID),
         .M0_AXI_ARADDR (M0_AXI_ARADDR),
@@ -635,6 +696,43 @@ module alioth_soc_top (
         .DMEM_AXI_RVALID (DMEM_AXI_RVALID),
         .DMEM_AXI_RREADY (DMEM_AXI_RREADY),
 
+        // XMEM AXI接口
+        .XMEM_AXI_AWID   (XMEM_AXI_AWID),
+        .XMEM_AXI_AWADDR (XMEM_AXI_AWADDR),
+        .XMEM_AXI_AWLEN  (XMEM_AXI_AWLEN),
+        .XMEM_AXI_AWSIZE (XMEM_AXI_AWSIZE),
+        .XMEM_AXI_AWBURST(XMEM_AXI_AWBURST),
+        .XMEM_AXI_AWLOCK (XMEM_AXI_AWLOCK),
+        .XMEM_AXI_AWCACHE(XMEM_AXI_AWCACHE),
+        .XMEM_AXI_AWPROT (XMEM_AXI_AWPROT),
+        .XMEM_AXI_AWVALID(XMEM_AXI_AWVALID),
+        .XMEM_AXI_AWREADY(XMEM_AXI_AWREADY),
+        .XMEM_AXI_WDATA  (XMEM_AXI_WDATA),
+        .XMEM_AXI_WSTRB  (XMEM_AXI_WSTRB),
+        .XMEM_AXI_WLAST  (XMEM_AXI_WLAST),
+        .XMEM_AXI_WVALID (XMEM_AXI_WVALID),
+        .XMEM_AXI_WREADY (XMEM_AXI_WREADY),
+        .XMEM_AXI_BID    (XMEM_AXI_BID),
+        .XMEM_AXI_BRESP  (XMEM_AXI_BRESP),
+        .XMEM_AXI_BVALID (XMEM_AXI_BVALID),
+        .XMEM_AXI_BREADY (XMEM_AXI_BREADY),
+        .XMEM_AXI_ARID   (XMEM_AXI_ARID),
+        .XMEM_AXI_ARADDR (XMEM_AXI_ARADDR),
+        .XMEM_AXI_ARLEN  (XMEM_AXI_ARLEN),
+        .XMEM_AXI_ARSIZE (XMEM_AXI_ARSIZE),
+        .XMEM_AXI_ARBURST(XMEM_AXI_ARBURST),
+        .XMEM_AXI_ARLOCK (XMEM_AXI_ARLOCK),
+        .XMEM_AXI_ARCACHE(XMEM_AXI_ARCACHE),
+        .XMEM_AXI_ARPROT (XMEM_AXI_ARPROT),
+        .XMEM_AXI_ARVALID(XMEM_AXI_ARVALID),
+        .XMEM_AXI_ARREADY(XMEM_AXI_ARREADY),
+        .XMEM_AXI_RID    (XMEM_AXI_RID),
+        .XMEM_AXI_RDATA  (XMEM_AXI_RDATA),
+        .XMEM_AXI_RRESP  (XMEM_AXI_RRESP),
+        .XMEM_AXI_RLAST  (XMEM_AXI_RLAST),
+        .XMEM_AXI_RVALID (XMEM_AXI_RVALID),
+        .XMEM_AXI_RREADY (XMEM_AXI_RREADY),
+
         // APB AXI-Lite 接口
         .OM0_AXI_ACLK   (S_AXI_ACLK),
         .OM0_AXI_ARESETN(S_AXI_ARESETN),
@@ -788,7 +886,14 @@ module alioth_soc_top (
         .S_AXI_RRESP  (IMEM_AXI_RRESP),
         .S_AXI_RLAST  (IMEM_AXI_RLAST),
         .S_AXI_RVALID (IMEM_AXI_RVALID),
-        .S_AXI_RREADY (IMEM_AXI_RREADY)
+        .S_AXI_RREADY (IMEM_AXI_RREADY),
+        .tcm_raddr_i  (itcm_fetch_addr[`ITCM_ADDR_WIDTH-1:0]),
+        .tcm_rdata_o  (itcm_fetch_data),
+        .tcm_rdata_next_o(itcm_fetch_data1),
+        .tcm_we_i     (1'b0),
+        .tcm_wmask_i  ('0),
+        .tcm_waddr_i  ('0),
+        .tcm_wdata_i  ('0)
     );
 
     // DMEM (数据存储器) 实例化
@@ -837,7 +942,85 @@ module alioth_soc_top (
         .S_AXI_RRESP  (DMEM_AXI_RRESP),
         .S_AXI_RLAST  (DMEM_AXI_RLAST),
         .S_AXI_RVALID (DMEM_AXI_RVALID),
-        .S_AXI_RREADY (DMEM_AXI_RREADY)
+        .S_AXI_RREADY (DMEM_AXI_RREADY),
+        .tcm_raddr_i  (dtcm_raddr[`DTCM_ADDR_WIDTH-1:0]),
+        .tcm_rdata_o  (dtcm_rdata),
+        .tcm_rdata_next_o(),
+        .tcm_we_i     (dtcm_we),
+        .tcm_wmask_i  (dtcm_wmask),
+        .tcm_waddr_i  (dtcm_waddr[`DTCM_ADDR_WIDTH-1:0]),
+        .tcm_wdata_i  (dtcm_wdata)
+    );
+
+`ifdef ENABLE_XMEM
+    // XMEM (外部存储器) 实例化，用于从AXI互联之后的存储区执行代码
+    gnrl_ram_pseudo_dual_axi #(
+        .ADDR_WIDTH        (`XMEM_ADDR_WIDTH),
+        .DATA_WIDTH        (`BUS_DATA_WIDTH),
+        .INIT_MEM          (0),
+        .INIT_FILE         (""),
+        .C_S_AXI_ID_WIDTH  (`BUS_ID_WIDTH),
+        .C_S_AXI_DATA_WIDTH(`BUS_DATA_WIDTH),
+        .C_S_AXI_ADDR_WIDTH(`XMEM_ADDR_WIDTH)
+    ) u_xmem (
+        .S_AXI_ACLK   (clk),
+        .S_AXI_ARESETN(rst_n),
+        .S_AXI_AWID   (XMEM_AXI_AWID),
+        .S_AXI_AWADDR (XMEM_AXI_AWADDR[`XMEM_ADDR_WIDTH-1:0]),
+        .S_AXI_AWLEN  (XMEM_AXI_AWLEN),
+        .S_AXI_AWSIZE (XMEM_AXI_AWSIZE),
+        .S_AXI_AWBURST(XMEM_AXI_AWBURST),
+        .S_AXI_AWLOCK (XMEM_AXI_AWLOCK),
+        .S_AXI_AWCACHE(XMEM_AXI_AWCACHE),
+        .S_AXI_AWPROT (XMEM_AXI_AWPROT),
+        .S_AXI_AWVALID(XMEM_AXI_AWVALID),
+        .S_AXI_AWREADY(XMEM_AXI_AWREADY),
+        .S_AXI_WDATA  (XMEM_AXI_WDATA),
+        .S_AXI_WSTRB  (XMEM_AXI_WSTRB),
+        .S_AXI_WLAST  (XMEM_AXI_WLAST),
+        .S_AXI_WVALID (XMEM_AXI_WVALID),
+        .S_AXI_WREADY (XMEM_AXI_WREADY),
+        .S_AXI_BID    (XMEM_AXI_BID),
+        .S_AXI_BRESP  (XMEM_AXI_BRESP),
+        .S_AXI_BVALID (XMEM_AXI_BVALID),
+        .S_AXI_BREADY (XMEM_AXI_BREADY),
+        .S_AXI_ARID   (XMEM_AXI_ARID),
+        .S_AXI_ARADDR (XMEM_AXI_ARADDR[`XMEM_ADDR_WIDTH-1:0]),
+        .S_AXI_ARLEN  (XMEM_AXI_ARLEN),
+        .S_AXI_ARSIZE (XMEM_AXI_ARSIZE),
+        .S_AXI_ARBURST(XMEM_AXI_ARBURST),
+        .S_AXI_ARLOCK (XMEM_AXI_ARLOCK),
+        .S_AXI_ARCACHE(XMEM_AXI_ARCACHE),
+        .S_AXI_ARPROT (XMEM_AXI_ARPROT),
+        .S_AXI_ARVALID(XMEM_AXI_ARVALID),
+        .S_AXI_ARREADY(XMEM_AXI_ARREADY),
+        .S_AXI_RID    (XMEM_AXI_RID),
+        .S_AXI_RDATA  (XMEM_AXI_RDATA),
+        .S_AXI_RRESP  (XMEM_AXI_RRESP),
+        .S_AXI_RLAST  (XMEM_AXI_RLAST),
+        .S_AXI_RVALID (XMEM_AXI_RVALID),
+        .S_AXI_RREADY (XMEM_AXI_RREADY),
+        .tcm_raddr_i  ('0),
+        .tcm_rdata_o  (),
+        .tcm_rdata_next_o(),
+        .tcm_we_i     (1'b0),
+        .tcm_wmask_i  ('0),
+        .tcm_waddr_i  ('0),
+        .tcm_wdata_i  ('0)
     );
+`else
+    // 未例化XMEM时从机端口保持不应答
+    assign XMEM_AXI_AWREADY = 1'b0;
+    assign XMEM_AXI_WREADY  = 1'b0;
+    assign XMEM_AXI_BID     = '0;
+    assign XMEM_AXI_BRESP   = 2'b00;
+    assign XMEM_AXI_BVALID  = 1'b0;
+    assign XMEM_AXI_ARREADY = 1'b0;
+    assign XMEM_AXI_RID     = '0;
+    assign XMEM_AXI_RDATA   = '0;
+    assign XMEM_AXI_RRESP   = 2'b00;
+    assign XMEM_AXI_RLAST   = 1'b0;
+    assign XMEM_AXI_RVALID  = 1'b0;
+`endif
 
 endmodule
@@ -304,11 +304,57 @@ module axi_crossbar #(
     input  wire [                 1:0] DM_AXI_RRESP,
     input  wire                        DM_AXI_RLAST,
     input  wire                        DM_AXI_RVALID,
-    output wire                        DM_AXI_RREADY
+    output wire                        DM_AXI_RREADY,
+
+    // XMEM AXI接口 (外部存储器)
+    // 写地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] XMEM_AXI_AWID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] XMEM_AXI_AWADDR,
+    output wire [                 7:0] XMEM_AXI_AWLEN,
+    output wire [                 2:0] XMEM_AXI_AWSIZE,
+    output wire [                 1:0] XMEM_AXI_AWBURST,
+    output wire                        XMEM_AXI_AWLOCK,
+    output wire [                 3:0] XMEM_AXI_AWCACHE,
+    output wire [                 2:0] XMEM_AXI_AWPROT,
+    output wire                        XMEM_AXI_AWVALID,
+    input  wire                        XMEM_AXI_AWREADY,
+
+    // 写数据通道
+    output wire [    C_AXI_DATA_WIDTH-1:0] XMEM_AXI_WDATA,
+    output wire [(C_AXI_DATA_WIDTH/8)-1:0] XMEM_AXI_WSTRB,
+    output wire                            XMEM_AXI_WLAST,
+    output wire                            XMEM_AXI_WVALID,
+    input  wire                            XMEM_AXI_WREADY,
+
+    // 写响应通道
+    input  wire [C_AXI_ID_WIDTH-1:0] XMEM_AXI_BID,
+    input  wire [               1:0] XMEM_AXI_BRESP,
+    input  wire                      XMEM_AXI_BVALID,
+    output wire                      XMEM_AXI_BREADY,
+
+    // 读地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] XMEM_AXI_ARID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] XMEM_AXI_ARADDR,
+    output wire [                 7:0] XMEM_AXI_ARLEN,
+    output wire [                 2:0] XMEM_AXI_ARSIZE,
+    output wire [                 1:0] XMEM_AXI_ARBURST,
+    output wire                        XMEM_AXI_ARLOCK,
+    output wire [                 3:0] XMEM_AXI_ARCACHE,
+    output wire [                 2:0] XMEM_AXI_ARPROT,
+    output wire                        XMEM_AXI_ARVALID,
+    input  wire                        XMEM_AXI_ARREADY,
+
+    // 读数据通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] XMEM_AXI_RID,
+    input  wire [C_AXI_DATA_WIDTH-1:0] XMEM_AXI_RDATA,
+    input  wire [                 1:0] XMEM_AXI_RRESP,
+    input  wire                        XMEM_AXI_RLAST,
+    input  wire                        XMEM_AXI_RVALID,
+    output wire                        XMEM_AXI_RREADY
 );
 
     // ==================== 参数定义和数组索引映射 ====================
-    localparam int NumSlaves = 6;
+    localparam int NumSlaves = 7;
 
     // 从机索引定义 - 用于数组索引
     localparam int ItcmIdx = 0;  // 指令存储器
@@ -317,6 +363,7 @@ module axi_crossbar #(
     localparam int ClintIdx = 3;  // 核心级中断控制器
     localparam int PlicIdx = 4;  // 平台级中断控制器
     localparam int DmIdx = 5;  // 调试模块
+    localparam int XmemIdx = 6;  // 外部存储器
 
     // 基地址数组 - 按索引顺序对应各外设
     localparam logic [C_AXI_ADDR_WIDTH-1:0] BaseAddr[NumSlaves] = '{
@@ -325,11 +372,12 @@ module axi_crossbar #(
         `APB_BASE_ADDR,  // [2] APB
         `CLINT_BASE_ADDR,  // [3] CLINT
         `PLIC_BASE_ADDR,  // [4] PLIC
-        `DM_BASE_ADDR  // [5] DM
+        `DM_BASE_ADDR,  // [5] DM
+        `XMEM_BASE_ADDR  // [6] XMEM
     };
 
     // ==================== 地址解码逻辑 ====================
-    // 读地址解码数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 读地址解码数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] addr_decode_r;
     assign addr_decode_r[ItcmIdx]  = (S_AXI_ARADDR[C_AXI_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH] ==
                                       BaseAddr[ItcmIdx][C_AXI_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH]);
@@ -343,8 +391,10 @@ module axi_crossbar #(
                                       BaseAddr[PlicIdx][C_AXI_ADDR_WIDTH-1:`PLIC_AXI_ADDR_WIDTH]);
     assign addr_decode_r[DmIdx]    = (S_AXI_ARADDR[C_AXI_ADDR_WIDTH-1:`DM_ADDR_WIDTH] ==
                                       BaseAddr[DmIdx][C_AXI_ADDR_WIDTH-1:`DM_ADDR_WIDTH]);
+    assign addr_decode_r[XmemIdx]  = (S_AXI_ARADDR[C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH] ==
+                                      BaseAddr[XmemIdx][C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH]);
 
-    // 写地址解码数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 写地址解码数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] addr_decode_w;
     assign addr_decode_w[ItcmIdx]  = (S_AXI_AWADDR[C_AXI_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH] ==
                                       BaseAddr[ItcmIdx][C_AXI_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH]);
@@ -358,26 +408,28 @@ module axi_crossbar #(
                                       BaseAddr[PlicIdx][C_AXI_ADDR_WIDTH-1:`PLIC_AXI_ADDR_WIDTH]);
     assign addr_decode_w[DmIdx]    = (S_AXI_AWADDR[C_AXI_ADDR_WIDTH-1:`DM_ADDR_WIDTH] ==
                                       BaseAddr[DmIdx][C_AXI_ADDR_WIDTH-1:`DM_ADDR_WIDTH]);
+    assign addr_decode_w[XmemIdx]  = (S_AXI_AWADDR[C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH] ==
+                                      BaseAddr[XmemIdx][C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH]);
 
     // ==================== 仲裁和选择信号数组 ====================
-    // AR通道授权信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // AR通道授权信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] ar_grant;
 
-    // AW通道授权信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // AW通道授权信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] aw_grant;
 
-    // 各通道选择信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 各通道选择信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] select_r;  // 读数据通道选择
     wire [NumSlaves-1:0] select_w;  // 写数据通道选择
     wire [NumSlaves-1:0] select_b;  // 写响应通道选择
 
     // ==================== outstanding计数器和事务信号数组 ====================
-    // Outstanding计数器输出数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // Outstanding计数器输出数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [3:0] r_outstanding_cnt[NumSlaves];  // R通道outstanding计数器
     wire [3:0] w_outstanding_cnt[NumSlaves];  // W通道outstanding计数器
     wire [3:0] b_outstanding_cnt[NumSlaves];  // B通道outstanding计数器
 
-    // 激活状态信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 激活状态信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] has_active_r;  // R通道激活状态
     wire [NumSlaves-1:0] has_active_w;  // W通道激活状态
     wire [NumSlaves-1:0] has_active_b;  // B通道激活状态
@@ -385,83 +437,89 @@ module axi_crossbar #(
     wire [NumSlaves-1:0] has_active_w_nxt;  // W通道下一周期激活状态
     wire [NumSlaves-1:0] has_active_b_nxt;  // B通道下一周期激活状态
 
-    // 事务信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 事务信号数组 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     wire [NumSlaves-1:0] ar_trans;  // AR通道事务
     wire [NumSlaves-1:0] r_trans;  // R通道事务
     wire [NumSlaves-1:0] aw_trans;  // AW通道事务
     wire [NumSlaves-1:0] w_trans;  // W通道事务
     wire [NumSlaves-1:0] b_trans;  // B通道事务
 
-    // AR通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // AR通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign ar_trans[ItcmIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[ItcmIdx];
     assign ar_trans[DtcmIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[DtcmIdx];
     assign ar_trans[ApbIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[ApbIdx];
     assign ar_trans[ClintIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[ClintIdx];
     assign ar_trans[PlicIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[PlicIdx];
     assign ar_trans[DmIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[DmIdx];
+    assign ar_trans[XmemIdx] = S_AXI_ARVALID && S_AXI_ARREADY && addr_decode_r[XmemIdx];
 
-    // R通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // R通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign r_trans[ItcmIdx] = S_AXI_RVALID && S_AXI_RREADY && S_AXI_RLAST && select_r[ItcmIdx];
     assign r_trans[DtcmIdx] = S_AXI_RVALID && S_AXI_RREADY && S_AXI_RLAST && select_r[DtcmIdx];
     assign r_trans[ApbIdx] = S_AXI_RVALID && S_AXI_RREADY && select_r[ApbIdx];  // AXI-Lite无RLAST
     assign r_trans[ClintIdx] = S_AXI_RVALID && S_AXI_RREADY && select_r[ClintIdx]; // AXI-Lite无RLAST
     assign r_trans[PlicIdx]  = S_AXI_RVALID && S_AXI_RREADY && select_r[PlicIdx]; // AXI-Lite无RLAST
     assign r_trans[DmIdx] = S_AXI_RVALID && S_AXI_RREADY && S_AXI_RLAST && select_r[DmIdx];
+    assign r_trans[XmemIdx] = S_AXI_RVALID && S_AXI_RREADY && S_AXI_RLAST && select_r[XmemIdx];
 
-    // AW通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // AW通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign aw_trans[ItcmIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[ItcmIdx];
     assign aw_trans[DtcmIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[DtcmIdx];
     assign aw_trans[ApbIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[ApbIdx];
     assign aw_trans[ClintIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[ClintIdx];
     assign aw_trans[PlicIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[PlicIdx];
     assign aw_trans[DmIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[DmIdx];
+    assign aw_trans[XmemIdx] = S_AXI_AWVALID && S_AXI_AWREADY && addr_decode_w[XmemIdx];
 
-    // W通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // W通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign w_trans[ItcmIdx] = S_AXI_WVALID && IMEM_AXI_WREADY && select_w[ItcmIdx];
     assign w_trans[DtcmIdx] = S_AXI_WVALID && DMEM_AXI_WREADY && select_w[DtcmIdx];
     assign w_trans[ApbIdx] = S_AXI_WVALID && OM0_AXI_WREADY && select_w[ApbIdx];
     assign w_trans[ClintIdx] = S_AXI_WVALID && OM1_AXI_WREADY && select_w[ClintIdx];
     assign w_trans[PlicIdx] = S_AXI_WVALID && OM2_AXI_WREADY && select_w[PlicIdx];
     assign w_trans[DmIdx] = S_AXI_WVALID && DM_AXI_WREADY && select_w[DmIdx];
+    assign w_trans[XmemIdx] = S_AXI_WVALID && XMEM_AXI_WREADY && select_w[XmemIdx];
 
-    // B通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // B通道事务信号赋值 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign b_trans[ItcmIdx] = IMEM_AXI_BVALID && S_AXI_BREADY && select_b[ItcmIdx];
     assign b_trans[DtcmIdx] = DMEM_AXI_BVALID && S_AXI_BREADY && select_b[DtcmIdx];
     assign b_trans[ApbIdx] = OM0_AXI_BVALID && S_AXI_BREADY && select_b[ApbIdx];
     assign b_trans[ClintIdx] = OM1_AXI_BVALID && S_AXI_BREADY && select_b[ClintIdx];
     assign b_trans[PlicIdx] = OM2_AXI_BVALID && S_AXI_BREADY && select_b[PlicIdx];
     assign b_trans[DmIdx] = DM_AXI_BVALID && S_AXI_BREADY && select_b[DmIdx];
+    assign b_trans[XmemIdx] = XMEM_AXI_BVALID && S_AXI_BREADY && select_b[XmemIdx];
 
     // ==================== 优先级跟踪寄存器 ====================
-    // bit 0: ITCM, bit 1: DTCM, bit 2: APB, bit 3: CLINT, bit 4: PLIC, bit 5: DM
-    reg  [5:0] slave_sel_r;  // 读通道优先级
-    reg  [5:0] slave_sel_w;  // 写数据通道优先级
-    reg  [5:0] slave_sel_b;  // 写响应通道优先级
+    // bit 0: ITCM, bit 1: DTCM, bit 2: APB, bit 3: CLINT, bit 4: PLIC, bit 5: DM, bit 6: XMEM
+    reg  [6:0] slave_sel_r;  // 读通道优先级
+    reg  [6:0] slave_sel_w;  // 写数据通道优先级
+    reg  [6:0] slave_sel_b;  // 写响应通道优先级
 
-    // 拼接变量用于case判断 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 拼接变量用于case判断 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     // 当前周期激活状态
-    wire [5:0] active_r = has_active_r;  // 读通道激活状态
-    wire [5:0] active_w = has_active_w;  // 写通道激活状态
-    wire [5:0] active_b = has_active_b;  // 写响应通道激活状态
+    wire [6:0] active_r = has_active_r;  // 读通道激活状态
+    wire [6:0] active_w = has_active_w;  // 写通道激活状态
+    wire [6:0] active_b = has_active_b;  // 写响应通道激活状态
 
     // 下一周期激活状态
-    wire [5:0] active_r_nxt = has_active_r_nxt;  // 读通道下一周期激活状态
-    wire [5:0] active_w_nxt = has_active_w_nxt;  // 写通道下一周期激活状态
-    wire [5:0] active_b_nxt = has_active_b_nxt;  // 写响应通道下一周期激活状态
+    wire [6:0] active_r_nxt = has_active_r_nxt;  // 读通道下一周期激活状态
+    wire [6:0] active_w_nxt = has_active_w_nxt;  // 写通道下一周期激活状态
+    wire [6:0] active_b_nxt = has_active_b_nxt;  // 写响应通道下一周期激活状态
 
     // 读通道优先权切换逻辑 - case实现
     always @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
-            slave_sel_r <= 6'b000001;
+            slave_sel_r <= 7'b0000001;
         end else begin
             case (active_r_nxt)
-                6'b000000: slave_sel_r <= 6'b000000;
-                6'b000001: slave_sel_r <= 6'b000001;
-                6'b000010: slave_sel_r <= 6'b000010;
-                6'b000100: slave_sel_r <= 6'b000100;
-                6'b001000: slave_sel_r <= 6'b001000;
-                6'b010000: slave_sel_r <= 6'b010000;
-                6'b100000: slave_sel_r <= 6'b100000;
+                7'b0000000: slave_sel_r <= 7'b0000000;
+                7'b0000001: slave_sel_r <= 7'b0000001;
+                7'b0000010: slave_sel_r <= 7'b0000010;
+                7'b0000100: slave_sel_r <= 7'b0000100;
+                7'b0001000: slave_sel_r <= 7'b0001000;
+                7'b0010000: slave_sel_r <= 7'b0010000;
+                7'b0100000: slave_sel_r <= 7'b0100000;
+                7'b1000000: slave_sel_r <= 7'b1000000;
                 default:   slave_sel_r <= slave_sel_r;  // 多个同时有效时保持
             endcase
         end
@@ -470,16 +528,17 @@ module axi_crossbar #(
     // 写响应通道优先权切换逻辑 - 使用b通道nxt信号
     always @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
-            slave_sel_b <= 6'b000001;
+            slave_sel_b <= 7'b0000001;
         end else begin
             case (active_b_nxt)
-                6'b000000: slave_sel_b <= 6'b000000;
-                6'b000001: slave_sel_b <= 6'b000001;
-                6'b000010: slave_sel_b <= 6'b000010;
-                6'b000100: slave_sel_b <= 6'b000100;
-                6'b001000: slave_sel_b <= 6'b001000;
-                6'b010000: slave_sel_b <= 6'b010000;
-                6'b100000: slave_sel_b <= 6'b100000;
+                7'b0000000: slave_sel_b <= 7'b0000000;
+                7'b0000001: slave_sel_b <= 7'b0000001;
+                7'b0000010: slave_sel_b <= 7'b0000010;
+                7'b0000100: slave_sel_b <= 7'b0000100;
+                7'b0001000: slave_sel_b <= 7'b0001000;
+                7'b0010000: slave_sel_b <= 7'b0010000;
+                7'b0100000: slave_sel_b <= 7'b0100000;
+                7'b1000000: slave_sel_b <= 7'b1000000;
                 default:   slave_sel_b <= slave_sel_b;
             endcase
         end
@@ -488,23 +547,24 @@ module axi_crossbar #(
     // 写数据通道优先权切换逻辑 - 使用w通道nxt信号
     always @(posedge clk or negedge rst_n) begin
         if (!rst_n) begin
-            slave_sel_w <= 6'b000001;
+            slave_sel_w <= 7'b0000001;
         end else begin
             case (active_w_nxt)
-                6'b000000: slave_sel_w <= 6'b000000;
-                6'b000001: slave_sel_w <= 6'b000001;
-                6'b000010: slave_sel_w <= 6'b000010;
-                6'b000100: slave_sel_w <= 6'b000100;
-                6'b001000: slave_sel_w <= 6'b001000;
-                6'b010000: slave_sel_w <= 6'b010000;
-                6'b100000: slave_sel_w <= 6'b100000;
+                7'b0000000: slave_sel_w <= 7'b0000000;
+                7'b0000001: slave_sel_w <= 7'b0000001;
+                7'b0000010: slave_sel_w <= 7'b0000010;
+                7'b0000100: slave_sel_w <= 7'b0000100;
+                7'b0001000: slave_sel_w <= 7'b0001000;
+                7'b0010000: slave_sel_w <= 7'b0010000;
+                7'b0100000: slave_sel_w <= 7'b0100000;
+                7'b1000000: slave_sel_w <= 7'b1000000;
                 default:   slave_sel_w <= slave_sel_w;
             endcase
         end
     end
 
     // ==================== 事务计数器模块实例化 ====================
-    // 使用generate生成所有bus_trans_cnt实例 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 使用generate生成所有bus_trans_cnt实例 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
 
     // R通道计数器generate
     genvar i;
@@ -556,7 +616,7 @@ module axi_crossbar #(
     endgenerate
 
     // ==================== 仲裁和选择逻辑 ====================
-    // 使用generate生成仲裁逻辑 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 使用generate生成仲裁逻辑 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
 
     // AR通道授权逻辑 - 固定优先级仲裁
     generate
@@ -663,6 +723,32 @@ module axi_crossbar #(
     assign DM_AXI_BREADY = S_AXI_BREADY && select_b[DmIdx];
     assign DM_AXI_RREADY = S_AXI_RREADY && select_r[DmIdx];
 
+    // XMEM
+    assign XMEM_AXI_ARID = S_AXI_ARID;
+    assign XMEM_AXI_ARADDR = S_AXI_ARADDR;
+    assign XMEM_AXI_ARLEN = S_AXI_ARLEN;
+    assign XMEM_AXI_ARSIZE = S_AXI_ARSIZE;
+    assign XMEM_AXI_ARBURST = S_AXI_ARBURST;
+    assign XMEM_AXI_ARLOCK = S_AXI_ARLOCK;
+    assign XMEM_AXI_ARCACHE = S_AXI_ARCACHE;
+    assign XMEM_AXI_ARPROT = S_AXI_ARPROT;
+    assign XMEM_AXI_ARVALID = ar_grant[XmemIdx];
+    assign XMEM_AXI_AWID = S_AXI_AWID;
+    assign XMEM_AXI_AWADDR = S_AXI_AWADDR;
+    assign XMEM_AXI_AWLEN = S_AXI_AWLEN;
+    assign XMEM_AXI_AWSIZE = S_AXI_AWSIZE;
+    assign XMEM_AXI_AWBURST = S_AXI_AWBURST;
+    assign XMEM_AXI_AWLOCK = S_AXI_AWLOCK;
+    assign XMEM_AXI_AWCACHE = S_AXI_AWCACHE;
+    assign XMEM_AXI_AWPROT = S_AXI_AWPROT;
+    assign XMEM_AXI_AWVALID = aw_grant[XmemIdx];
+    assign XMEM_AXI_WDATA = S_AXI_WDATA;
+    assign XMEM_AXI_WSTRB = S_AXI_WSTRB;
+    assign XMEM_AXI_WLAST = S_AXI_WLAST;
+    assign XMEM_AXI_WVALID = S_AXI_WVALID && select_w[XmemIdx];
+    assign XMEM_AXI_BREADY = S_AXI_BREADY && select_b[XmemIdx];
+    assign XMEM_AXI_RREADY = S_AXI_RREADY && select_r[XmemIdx];
+
     // APB/CLINT/PLIC (AXI-Lite)
     assign OM0_AXI_ACLK = clk;
     assign OM0_AXI_ARESETN = rst_n;
@@ -709,47 +795,54 @@ module axi_crossbar #(
     assign OM2_AXI_RREADY = S_AXI_RREADY && select_r[PlicIdx];
 
     // ==================== 输入端口连接 ====================
-    // Ready信号 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // Ready信号 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign S_AXI_ARREADY = (addr_decode_r[ItcmIdx] && IMEM_AXI_ARREADY) ||
                            (addr_decode_r[DtcmIdx] && DMEM_AXI_ARREADY) ||
                            (addr_decode_r[ApbIdx] && OM0_AXI_ARREADY) ||
                            (addr_decode_r[ClintIdx] && OM1_AXI_ARREADY) ||
                            (addr_decode_r[PlicIdx] && OM2_AXI_ARREADY) ||
-                           (addr_decode_r[DmIdx] && DM_AXI_ARREADY);
+                           (addr_decode_r[DmIdx] && DM_AXI_ARREADY) ||
+                           (addr_decode_r[XmemIdx] && XMEM_AXI_ARREADY);
 
     assign S_AXI_AWREADY = (addr_decode_w[ItcmIdx] && IMEM_AXI_AWREADY) ||
                            (addr_decode_w[DtcmIdx] && DMEM_AXI_AWREADY) ||
                            (addr_decode_w[ApbIdx] && OM0_AXI_AWREADY) ||
                            (addr_decode_w[ClintIdx] && OM1_AXI_AWREADY) ||
                            (addr_decode_w[PlicIdx] && OM2_AXI_AWREADY) ||
-                           (addr_decode_w[DmIdx] && DM_AXI_AWREADY);
+                           (addr_decode_w[DmIdx] && DM_AXI_AWREADY) ||
+                           (addr_decode_w[XmemIdx] && XMEM_AXI_AWREADY);
 
     assign S_AXI_WREADY = (select_w[ItcmIdx] && IMEM_AXI_WREADY) ||
                           (select_w[DtcmIdx] && DMEM_AXI_WREADY) ||
                           (select_w[ApbIdx] && OM0_AXI_WREADY) ||
                           (select_w[ClintIdx] && OM1_AXI_WREADY) ||
                           (select_w[PlicIdx] && OM2_AXI_WREADY) ||
-                          (select_w[DmIdx] && DM_AXI_WREADY);
+                          (select_w[DmIdx] && DM_AXI_WREADY) ||
+                          (select_w[XmemIdx] && XMEM_AXI_WREADY);
 
-    // 读数据通道 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 读数据通道 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign S_AXI_RID = select_r[ItcmIdx] ? IMEM_AXI_RID :
                        select_r[DtcmIdx] ? DMEM_AXI_RID :
-                       select_r[DmIdx]   ? DM_AXI_RID : '0; // AXI-Lite no ID
+                       select_r[DmIdx]   ? DM_AXI_RID :
+                       select_r[XmemIdx] ? XMEM_AXI_RID : '0; // AXI-Lite no ID
     assign S_AXI_RDATA = select_r[ItcmIdx] ? IMEM_AXI_RDATA :
                          select_r[DtcmIdx] ? DMEM_AXI_RDATA :
                          select_r[ApbIdx]  ? OM0_AXI_RDATA :
                          select_r[ClintIdx]? OM1_AXI_RDATA :
                          select_r[PlicIdx] ? OM2_AXI_RDATA :
-                         select_r[DmIdx]   ? DM_AXI_RDATA : '0;
+                         select_r[DmIdx]   ? DM_AXI_RDATA :
+                         select_r[XmemIdx] ? XMEM_AXI_RDATA : '0;
     assign S_AXI_RRESP = select_r[ItcmIdx] ? IMEM_AXI_RRESP :
                          select_r[DtcmIdx] ? DMEM_AXI_RRESP :
                          select_r[ApbIdx]  ? OM0_AXI_RRESP :
                          select_r[ClintIdx]? OM1_AXI_RRESP :
                          select_r[PlicIdx] ? OM2_AXI_RRESP :
-                         select_r[DmIdx]   ? DM_AXI_RRESP : '0;
+                         select_r[DmIdx]   ? DM_AXI_RRESP :
+                         select_r[XmemIdx] ? XMEM_AXI_RRESP : '0;
     assign S_AXI_RLAST = select_r[ItcmIdx] ? IMEM_AXI_RLAST :
                          select_r[DtcmIdx] ? DMEM_AXI_RLAST :
                          select_r[DmIdx]   ? DM_AXI_RLAST :
+                         select_r[XmemIdx] ? XMEM_AXI_RLAST :
                          (select_r[ApbIdx] || select_r[ClintIdx] ||
                           select_r[PlicIdx]); // AXI-Lite is always last
     assign S_AXI_RUSER = 4'b0;  // AXI-Lite不使用RUSER信号，设为0
@@ -758,22 +851,26 @@ module axi_crossbar #(
                           (select_r[ApbIdx] && OM0_AXI_RVALID) ||
                           (select_r[ClintIdx] && OM1_AXI_RVALID) ||
                           (select_r[PlicIdx] && OM2_AXI_RVALID) ||
-                          (select_r[DmIdx] && DM_AXI_RVALID);
+                          (select_r[DmIdx] && DM_AXI_RVALID) ||
+                          (select_r[XmemIdx] && XMEM_AXI_RVALID);
 
-    // 写响应通道 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM
+    // 写响应通道 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
     assign S_AXI_BID = select_b[ItcmIdx] ? IMEM_AXI_BID :
                        select_b[DtcmIdx] ? DMEM_AXI_BID :
-                       select_b[DmIdx]   ? DM_AXI_BID : '0; // AXI-Lite no ID
+                       select_b[DmIdx]   ? DM_AXI_BID :
+                       select_b[XmemIdx] ? XMEM_AXI_BID : '0; // AXI-Lite no ID
     assign S_AXI_BRESP = select_b[ItcmIdx] ? IMEM_AXI_BRESP :
                          select_b[DtcmIdx] ? DMEM_AXI_BRESP :
                          select_b[ApbIdx]  ? OM0_AXI_BRESP :
                          select_b[ClintIdx]? OM1_AXI_BRESP :
                          select_b[PlicIdx] ? OM2_AXI_BRESP :
-                         select_b[DmIdx]   ? DM_AXI_BRESP : '0;
+                         select_b[DmIdx]   ? DM_AXI_BRESP :
+                         select_b[XmemIdx] ? XMEM_AXI_BRESP : '0;
     assign S_AXI_BVALID = (select_b[ItcmIdx] && IMEM_AXI_BVALID) ||
                           (select_b[DtcmIdx] && DMEM_AXI_BVALID) ||
                           (select_b[ApbIdx] && OM0_AXI_BVALID) ||
                           (select_b[ClintIdx] && OM1_AXI_BVALID) ||
                           (select_b[PlicIdx] && OM2_AXI_BVALID) ||
-                          (select_b[DmIdx] && DM_AXI_BVALID);
+                          (select_b[DmIdx] && DM_AXI_BVALID) ||
+                          (select_b[XmemIdx] && XMEM_AXI_BVALID);
 endmodule
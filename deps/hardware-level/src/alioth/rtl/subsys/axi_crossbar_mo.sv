@@ -0,0 +1,902 @@
+/*
+ The MIT License (MIT)
+
+ Copyright © 2025 Yusen Wang @yusen.w@qq.com
+                                                                         
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+                                                                         
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+                                                                         
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+`include "defines.svh"
+
+// AXI 2对多 多在途Crossbar (AXI_MULTI_OUTSTANDING为1时由axi_interconnect例化)
+// M0(取指，只读)与M1(访存，读写)各自直连，每个从机独立仲裁读地址通道，
+// 每个主机可有多个在途事务，响应按事务顺序FIFO路由回发出者
+module axi_crossbar_mo #(
+    parameter int IMEM_ADDR_WIDTH = 16,  // IMEM地址宽度
+    parameter int DMEM_ADDR_WIDTH = 16,  // DMEM地址宽度
+    parameter int DATA_WIDTH      = 32,  // RAM数据宽度
+
+    // AXI接口参数
+    parameter int C_AXI_ID_WIDTH   = 2,   // AXI ID宽度
+    parameter int C_AXI_DATA_WIDTH = 32,  // AXI数据宽度
+    parameter int C_AXI_ADDR_WIDTH = 32,  // AXI地址宽度
+
+    // APB AXI-Lite接口参数
+    parameter int C_OM0_AXI_ADDR_WIDTH = 32,  // APB AXI-Lite 地址宽度
+    parameter int C_OM0_AXI_DATA_WIDTH = 32,  // APB AXI-Lite 数据宽度
+    // CLINT AXI-Lite接口参数
+    parameter int C_OM1_AXI_ADDR_WIDTH = 32,  // CLINT AXI-Lite 地址宽度
+    parameter int C_OM1_AXI_DATA_WIDTH = 32,  // CLINT AXI-Lite 数据宽度
+    // PLIC AXI-Lite接口参数
+    parameter int C_OM2_AXI_ADDR_WIDTH = 32,  // PLIC AXI-Lite 地址宽度
+    parameter int C_OM2_AXI_DATA_WIDTH = 32   // PLIC AXI-Lite 数据宽度
+) (
+    // 全局信号
+    input wire clk,   // 时钟信号
+    input wire rst_n, // 复位信号（低有效）
+
+    // Master 0 接口 - 只读（指令获取）
+    // AXI读地址通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] M0_AXI_ARID,
+    input  wire [C_AXI_ADDR_WIDTH-1:0] M0_AXI_ARADDR,
+    input  wire [                 7:0] M0_AXI_ARLEN,
+    input  wire [                 2:0] M0_AXI_ARSIZE,
+    input  wire [                 1:0] M0_AXI_ARBURST,
+    input  wire                        M0_AXI_ARLOCK,
+    input  wire [                 3:0] M0_AXI_ARCACHE,
+    input  wire [                 2:0] M0_AXI_ARPROT,
+    input  wire [                 3:0] M0_AXI_ARQOS,
+    input  wire [                 3:0] M0_AXI_ARUSER,
+    input  wire                        M0_AXI_ARVALID,
+    output wire                        M0_AXI_ARREADY,
+
+    // AXI读数据通道
+    output wire [  C_AXI_ID_WIDTH-1:0] M0_AXI_RID,
+    output wire [C_AXI_DATA_WIDTH-1:0] M0_AXI_RDATA,
+    output wire [                 1:0] M0_AXI_RRESP,
+    output wire                        M0_AXI_RLAST,
+    output wire [                 3:0] M0_AXI_RUSER,
+    output wire                        M0_AXI_RVALID,
+    input  wire                        M0_AXI_RREADY,
+
+    // Master 1 接口 - 完整读写通道（数据访问）
+    // AXI写地址通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] M1_AXI_AWID,
+    input  wire [C_AXI_ADDR_WIDTH-1:0] M1_AXI_AWADDR,
+    input  wire [                 7:0] M1_AXI_AWLEN,
+    input  wire [                 2:0] M1_AXI_AWSIZE,
+    input  wire [                 1:0] M1_AXI_AWBURST,
+    input  wire                        M1_AXI_AWLOCK,
+    input  wire [                 3:0] M1_AXI_AWCACHE,
+    input  wire [                 2:0] M1_AXI_AWPROT,
+    input  wire [                 3:0] M1_AXI_AWQOS,
+    input  wire [                 3:0] M1_AXI_AWUSER,
+    input  wire                        M1_AXI_AWVALID,
+    output wire                        M1_AXI_AWREADY,
+
+    // AXI写数据通道
+    input  wire [    C_AXI_DATA_WIDTH-1:0] M1_AXI_WDATA,
+    input  wire [(C_AXI_DATA_WIDTH/8)-1:0] M1_AXI_WSTRB,
+    input  wire                            M1_AXI_WLAST,
+    input  wire                            M1_AXI_WVALID,
+    output wire                            M1_AXI_WREADY,
+
+    // AXI写响应通道
+    output wire [C_AXI_ID_WIDTH-1:0] M1_AXI_BID,
+    output wire [               1:0] M1_AXI_BRESP,
+    output wire                      M1_AXI_BVALID,
+    input  wire                      M1_AXI_BREADY,
+
+    // AXI读地址通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] M1_AXI_ARID,
+    input  wire [C_AXI_ADDR_WIDTH-1:0] M1_AXI_ARADDR,
+    input  wire [                 7:0] M1_AXI_ARLEN,
+    input  wire [                 2:0] M1_AXI_ARSIZE,
+    input  wire [                 1:0] M1_AXI_ARBURST,
+    input  wire                        M1_AXI_ARLOCK,
+    input  wire [                 3:0] M1_AXI_ARCACHE,
+    input  wire [                 2:0] M1_AXI_ARPROT,
+    input  wire [                 3:0] M1_AXI_ARQOS,
+    input  wire [                 3:0] M1_AXI_ARUSER,
+    input  wire                        M1_AXI_ARVALID,
+    output wire                        M1_AXI_ARREADY,
+
+    // AXI读数据通道
+    output wire [  C_AXI_ID_WIDTH-1:0] M1_AXI_RID,
+    output wire [C_AXI_DATA_WIDTH-1:0] M1_AXI_RDATA,
+    output wire [                 1:0] M1_AXI_RRESP,
+    output wire                        M1_AXI_RLAST,
+    output wire [                 3:0] M1_AXI_RUSER,
+    output wire                        M1_AXI_RVALID,
+    input  wire                        M1_AXI_RREADY,
+
+    // APB AXI-lite 接口
+    output wire                                  OM0_AXI_ACLK,
+    output wire                                  OM0_AXI_ARESETN,
+    output wire [    C_OM0_AXI_ADDR_WIDTH-1 : 0] OM0_AXI_AWADDR,
+    output wire [                         2 : 0] OM0_AXI_AWPROT,
+    output wire                                  OM0_AXI_AWVALID,
+    input  wire                                  OM0_AXI_AWREADY,
+    output wire [    C_OM0_AXI_DATA_WIDTH-1 : 0] OM0_AXI_WDATA,
+    output wire [(C_OM0_AXI_DATA_WIDTH/8)-1 : 0] OM0_AXI_WSTRB,
+    output wire                                  OM0_AXI_WVALID,
+    input  wire                                  OM0_AXI_WREADY,
+    input  wire [                         1 : 0] OM0_AXI_BRESP,
+    input  wire                                  OM0_AXI_BVALID,
+    output wire                                  OM0_AXI_BREADY,
+    output wire [    C_OM0_AXI_ADDR_WIDTH-1 : 0] OM0_AXI_ARADDR,
+    output wire [                         2 : 0] OM0_AXI_ARPROT,
+    output wire                                  OM0_AXI_ARVALID,
+    input  wire                                  OM0_AXI_ARREADY,
+    input  wire [    C_OM0_AXI_DATA_WIDTH-1 : 0] OM0_AXI_RDATA,
+    input  wire [                         1 : 0] OM0_AXI_RRESP,
+    input  wire                                  OM0_AXI_RVALID,
+    output wire                                  OM0_AXI_RREADY,
+    // CLINT AXI-lite 接口
+    output wire                                  OM1_AXI_ACLK,
+    output wire                                  OM1_AXI_ARESETN,
+    output wire [    C_OM1_AXI_ADDR_WIDTH-1 : 0] OM1_AXI_AWADDR,
+    output wire [                         2 : 0] OM1_AXI_AWPROT,
+    output wire                                  OM1_AXI_AWVALID,
+    input  wire                                  OM1_AXI_AWREADY,
+    output wire [    C_OM1_AXI_DATA_WIDTH-1 : 0] OM1_AXI_WDATA,
+    output wire [(C_OM1_AXI_DATA_WIDTH/8)-1 : 0] OM1_AXI_WSTRB,
+    output wire                                  OM1_AXI_WVALID,
+    input  wire                                  OM1_AXI_WREADY,
+    input  wire [                         1 : 0] OM1_AXI_BRESP,
+    input  wire                                  OM1_AXI_BVALID,
+    output wire                                  OM1_AXI_BREADY,
+    output wire [    C_OM1_AXI_ADDR_WIDTH-1 : 0] OM1_AXI_ARADDR,
+    output wire [                         2 : 0] OM1_AXI_ARPROT,
+    output wire                                  OM1_AXI_ARVALID,
+    input  wire                                  OM1_AXI_ARREADY,
+    input  wire [    C_OM1_AXI_DATA_WIDTH-1 : 0] OM1_AXI_RDATA,
+    input  wire [                         1 : 0] OM1_AXI_RRESP,
+    input  wire                                  OM1_AXI_RVALID,
+    output wire                                  OM1_AXI_RREADY,
+
+    // PLIC AXI-lite 接口
+    output wire                                  OM2_AXI_ACLK,
+    output wire                                  OM2_AXI_ARESETN,
+    output wire [    C_OM2_AXI_ADDR_WIDTH-1 : 0] OM2_AXI_AWADDR,
+    output wire [                         2 : 0] OM2_AXI_AWPROT,
+    output wire                                  OM2_AXI_AWVALID,
+    input  wire                                  OM2_AXI_AWREADY,
+    output wire [    C_OM2_AXI_DATA_WIDTH-1 : 0] OM2_AXI_WDATA,
+    output wire [(C_OM2_AXI_DATA_WIDTH/8)-1 : 0] OM2_AXI_WSTRB,
+    output wire                                  OM2_AXI_WVALID,
+    input  wire                                  OM2_AXI_WREADY,
+    input  wire [                         1 : 0] OM2_AXI_BRESP,
+    input  wire                                  OM2_AXI_BVALID,
+    output wire                                  OM2_AXI_BREADY,
+    output wire [    C_OM2_AXI_ADDR_WIDTH-1 : 0] OM2_AXI_ARADDR,
+    output wire [                         2 : 0] OM2_AXI_ARPROT,
+    output wire                                  OM2_AXI_ARVALID,
+    input  wire                                  OM2_AXI_ARREADY,
+    input  wire [    C_OM2_AXI_DATA_WIDTH-1 : 0] OM2_AXI_RDATA,
+    input  wire [                         1 : 0] OM2_AXI_RRESP,
+    input  wire                                  OM2_AXI_RVALID,
+    output wire                                  OM2_AXI_RREADY,
+
+    // IMEM AXI接口 (指令存储器)
+    // 写地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] IMEM_AXI_AWID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] IMEM_AXI_AWADDR,
+    output wire [                 7:0] IMEM_AXI_AWLEN,
+    output wire [                 2:0] IMEM_AXI_AWSIZE,
+    output wire [                 1:0] IMEM_AXI_AWBURST,
+    output wire                        IMEM_AXI_AWLOCK,
+    output wire [                 3:0] IMEM_AXI_AWCACHE,
+    output wire [                 2:0] IMEM_AXI_AWPROT,
+    output wire                        IMEM_AXI_AWVALID,
+    input  wire                        IMEM_AXI_AWREADY,
+
+    // 写数据通道
+    output wire [    C_AXI_DATA_WIDTH-1:0] IMEM_AXI_WDATA,
+    output wire [(C_AXI_DATA_WIDTH/8)-1:0] IMEM_AXI_WSTRB,
+    output wire                            IMEM_AXI_WLAST,
+    output wire                            IMEM_AXI_WVALID,
+    input  wire                            IMEM_AXI_WREADY,
+
+    // 写响应通道
+    input  wire [C_AXI_ID_WIDTH-1:0] IMEM_AXI_BID,
+    input  wire [               1:0] IMEM_AXI_BRESP,
+    input  wire                      IMEM_AXI_BVALID,
+    output wire                      IMEM_AXI_BREADY,
+
+    // 读地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] IMEM_AXI_ARID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] IMEM_AXI_ARADDR,
+    output wire [                 7:0] IMEM_AXI_ARLEN,
+    output wire [                 2:0] IMEM_AXI_ARSIZE,
+    output wire [                 1:0] IMEM_AXI_ARBURST,
+    output wire                        IMEM_AXI_ARLOCK,
+    output wire [                 3:0] IMEM_AXI_ARCACHE,
+    output wire [                 2:0] IMEM_AXI_ARPROT,
+    output wire                        IMEM_AXI_ARVALID,
+    input  wire                        IMEM_AXI_ARREADY,
+
+    // 读数据通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] IMEM_AXI_RID,
+    input  wire [C_AXI_DATA_WIDTH-1:0] IMEM_AXI_RDATA,
+    input  wire [                 1:0] IMEM_AXI_RRESP,
+    input  wire                        IMEM_AXI_RLAST,
+    input  wire                        IMEM_AXI_RVALID,
+    output wire                        IMEM_AXI_RREADY,
+
+    // DMEM AXI接口 (数据存储器)
+    // 写地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] DMEM_AXI_AWID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] DMEM_AXI_AWADDR,
+    output wire [                 7:0] DMEM_AXI_AWLEN,
+    output wire [                 2:0] DMEM_AXI_AWSIZE,
+    output wire [                 1:0] DMEM_AXI_AWBURST,
+    output wire                        DMEM_AXI_AWLOCK,
+    output wire [                 3:0] DMEM_AXI_AWCACHE,
+    output wire [                 2:0] DMEM_AXI_AWPROT,
+    output wire                        DMEM_AXI_AWVALID,
+    input  wire                        DMEM_AXI_AWREADY,
+
+    // 写数据通道
+    output wire [    C_AXI_DATA_WIDTH-1:0] DMEM_AXI_WDATA,
+    output wire [(C_AXI_DATA_WIDTH/8)-1:0] DMEM_AXI_WSTRB,
+    output wire                            DMEM_AXI_WLAST,
+    output wire                            DMEM_AXI_WVALID,
+    input  wire                            DMEM_AXI_WREADY,
+
+    // 写响应通道
+    input  wire [C_AXI_ID_WIDTH-1:0] DMEM_AXI_BID,
+    input  wire [               1:0] DMEM_AXI_BRESP,
+    input  wire                      DMEM_AXI_BVALID,
+    output wire                      DMEM_AXI_BREADY,
+
+    // 读地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] DMEM_AXI_ARID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] DMEM_AXI_ARADDR,
+    output wire [                 7:0] DMEM_AXI_ARLEN,
+    output wire [                 2:0] DMEM_AXI_ARSIZE,
+    output wire [                 1:0] DMEM_AXI_ARBURST,
+    output wire                        DMEM_AXI_ARLOCK,
+    output wire [                 3:0] DMEM_AXI_ARCACHE,
+    output wire [                 2:0] DMEM_AXI_ARPROT,
+    output wire                        DMEM_AXI_ARVALID,
+    input  wire                        DMEM_AXI_ARREADY,
+
+    // 读数据通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] DMEM_AXI_RID,
+    input  wire [C_AXI_DATA_WIDTH-1:0] DMEM_AXI_RDATA,
+    input  wire [                 1:0] DMEM_AXI_RRESP,
+    input  wire                        DMEM_AXI_RLAST,
+    input  wire                        DMEM_AXI_RVALID,
+    output wire                        DMEM_AXI_RREADY,
+
+    // DM AXI接口 (Debug Module)
+    // 写地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] DM_AXI_AWID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] DM_AXI_AWADDR,
+    output wire [                 7:0] DM_AXI_AWLEN,
+    output wire [                 2:0] DM_AXI_AWSIZE,
+    output wire [                 1:0] DM_AXI_AWBURST,
+    output wire                        DM_AXI_AWLOCK,
+    output wire [                 3:0] DM_AXI_AWCACHE,
+    output wire [                 2:0] DM_AXI_AWPROT,
+    output wire                        DM_AXI_AWVALID,
+    input  wire                        DM_AXI_AWREADY,
+
+    // 写数据通道
+    output wire [    C_AXI_DATA_WIDTH-1:0] DM_AXI_WDATA,
+    output wire [(C_AXI_DATA_WIDTH/8)-1:0] DM_AXI_WSTRB,
+    output wire                            DM_AXI_WLAST,
+    output wire                            DM_AXI_WVALID,
+    input  wire                            DM_AXI_WREADY,
+
+    // 写响应通道
+    input  wire [C_AXI_ID_WIDTH-1:0] DM_AXI_BID,
+    input  wire [               1:0] DM_AXI_BRESP,
+    input  wire                      DM_AXI_BVALID,
+    output wire                      DM_AXI_BREADY,
+
+    // 读地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] DM_AXI_ARID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] DM_AXI_ARADDR,
+    output wire [                 7:0] DM_AXI_ARLEN,
+    output wire [                 2:0] DM_AXI_ARSIZE,
+    output wire [                 1:0] DM_AXI_ARBURST,
+    output wire                        DM_AXI_ARLOCK,
+    output wire [                 3:0] DM_AXI_ARCACHE,
+    output wire [                 2:0] DM_AXI_ARPROT,
+    output wire                        DM_AXI_ARVALID,
+    input  wire                        DM_AXI_ARREADY,
+
+    // 读数据通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] DM_AXI_RID,
+    input  wire [C_AXI_DATA_WIDTH-1:0] DM_AXI_RDATA,
+    input  wire [                 1:0] DM_AXI_RRESP,
+    input  wire                        DM_AXI_RLAST,
+    input  wire                        DM_AXI_RVALID,
+    output wire                        DM_AXI_RREADY,
+
+    // XMEM AXI接口 (外部存储器)
+    // 写地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] XMEM_AXI_AWID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] XMEM_AXI_AWADDR,
+    output wire [                 7:0] XMEM_AXI_AWLEN,
+    output wire [                 2:0] XMEM_AXI_AWSIZE,
+    output wire [                 1:0] XMEM_AXI_AWBURST,
+    output wire                        XMEM_AXI_AWLOCK,
+    output wire [                 3:0] XMEM_AXI_AWCACHE,
+    output wire [                 2:0] XMEM_AXI_AWPROT,
+    output wire                        XMEM_AXI_AWVALID,
+    input  wire                        XMEM_AXI_AWREADY,
+
+    // 写数据通道
+    output wire [    C_AXI_DATA_WIDTH-1:0] XMEM_AXI_WDATA,
+    output wire [(C_AXI_DATA_WIDTH/8)-1:0] XMEM_AXI_WSTRB,
+    output wire                            XMEM_AXI_WLAST,
+    output wire                            XMEM_AXI_WVALID,
+    input  wire                            XMEM_AXI_WREADY,
+
+    // 写响应通道
+    input  wire [C_AXI_ID_WIDTH-1:0] XMEM_AXI_BID,
+    input  wire [               1:0] XMEM_AXI_BRESP,
+    input  wire                      XMEM_AXI_BVALID,
+    output wire                      XMEM_AXI_BREADY,
+
+    // 读地址通道
+    output wire [  C_AXI_ID_WIDTH-1:0] XMEM_AXI_ARID,
+    output wire [C_AXI_ADDR_WIDTH-1:0] XMEM_AXI_ARADDR,
+    output wire [                 7:0] XMEM_AXI_ARLEN,
+    output wire [                 2:0] XMEM_AXI_ARSIZE,
+    output wire [                 1:0] XMEM_AXI_ARBURST,
+    output wire                        XMEM_AXI_ARLOCK,
+    output wire [                 3:0] XMEM_AXI_ARCACHE,
+    output wire [                 2:0] XMEM_AXI_ARPROT,
+    output wire                        XMEM_AXI_ARVALID,
+    input  wire                        XMEM_AXI_ARREADY,
+
+    // 读数据通道
+    input  wire [  C_AXI_ID_WIDTH-1:0] XMEM_AXI_RID,
+    input  wire [C_AXI_DATA_WIDTH-1:0] XMEM_AXI_RDATA,
+    input  wire [                 1:0] XMEM_AXI_RRESP,
+    input  wire                        XMEM_AXI_RLAST,
+    input  wire                        XMEM_AXI_RVALID,
+    output wire                        XMEM_AXI_RREADY
+);
+
+    // ==================== 参数定义和数组索引映射 ====================
+    localparam int NumSlaves = 7;
+
+    // 从机索引定义 - 用于数组索引
+    localparam int ItcmIdx = 0;  // 指令存储器
+    localparam int DtcmIdx = 1;  // 数据存储器
+    localparam int ApbIdx = 2;  // APB桥
+    localparam int ClintIdx = 3;  // 核心级中断控制器
+    localparam int PlicIdx = 4;  // 平台级中断控制器
+    localparam int DmIdx = 5;  // 调试模块
+    localparam int XmemIdx = 6;  // 外部存储器
+
+    localparam int SlvIdxWidth = 3;  // 从机编号位宽
+    localparam int OstDepth = `AXI_OUTSTANDING_DEPTH;  // 顺序FIFO深度，即每个主机/从机的最大在途事务数
+
+    // 基地址数组 - 按索引顺序对应各外设
+    localparam logic [C_AXI_ADDR_WIDTH-1:0] BaseAddr[NumSlaves] = '{
+        `ITCM_BASE_ADDR,  // [0] ITCM
+        `DTCM_BASE_ADDR,  // [1] DTCM
+        `APB_BASE_ADDR,  // [2] APB
+        `CLINT_BASE_ADDR,  // [3] CLINT
+        `PLIC_BASE_ADDR,  // [4] PLIC
+        `DM_BASE_ADDR,  // [5] DM
+        `XMEM_BASE_ADDR  // [6] XMEM
+    };
+
+    // ==================== 地址解码逻辑 ====================
+    // 解码结果为独热码 - [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
+    function automatic [NumSlaves-1:0] addr_decode(input [C_AXI_ADDR_WIDTH-1:0] addr);
+        addr_decode[ItcmIdx]  = (addr[C_AXI_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH] ==
+                                 BaseAddr[ItcmIdx][C_AXI_ADDR_WIDTH-1:`ITCM_ADDR_WIDTH]);
+        addr_decode[DtcmIdx]  = (addr[C_AXI_ADDR_WIDTH-1:`DTCM_ADDR_WIDTH] ==
+                                 BaseAddr[DtcmIdx][C_AXI_ADDR_WIDTH-1:`DTCM_ADDR_WIDTH]);
+        addr_decode[ApbIdx]   = (addr[C_AXI_ADDR_WIDTH-1:`APB_ADDR_WIDTH] ==
+                                 BaseAddr[ApbIdx][C_AXI_ADDR_WIDTH-1:`APB_ADDR_WIDTH]);
+        addr_decode[ClintIdx] = (addr[C_AXI_ADDR_WIDTH-1:`CLINT_AXI_ADDR_WIDTH] ==
+                                 BaseAddr[ClintIdx][C_AXI_ADDR_WIDTH-1:`CLINT_AXI_ADDR_WIDTH]);
+        addr_decode[PlicIdx]  = (addr[C_AXI_ADDR_WIDTH-1:`PLIC_AXI_ADDR_WIDTH] ==
+                                 BaseAddr[PlicIdx][C_AXI_ADDR_WIDTH-1:`PLIC_AXI_ADDR_WIDTH]);
+        addr_decode[DmIdx]    = (addr[C_AXI_ADDR_WIDTH-1:`DM_ADDR_WIDTH] ==
+                                 BaseAddr[DmIdx][C_AXI_ADDR_WIDTH-1:`DM_ADDR_WIDTH]);
+        addr_decode[XmemIdx]  = (addr[C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH] ==
+                                 BaseAddr[XmemIdx][C_AXI_ADDR_WIDTH-1:`XMEM_ADDR_WIDTH]);
+    endfunction
+
+    // 独热码转从机编号，写入顺序FIFO
+    function automatic [SlvIdxWidth-1:0] slave_index(input [NumSlaves-1:0] sel);
+        slave_index = '0;
+        for (int k = 0; k < NumSlaves; k = k + 1) begin
+            if (sel[k]) slave_index = k[SlvIdxWidth-1:0];
+        end
+    endfunction
+
+    wire [NumSlaves-1:0] m0_decode_r = addr_decode(M0_AXI_ARADDR);  // M0读地址解码
+    wire [NumSlaves-1:0] m1_decode_r = addr_decode(M1_AXI_ARADDR);  // M1读地址解码
+    wire [NumSlaves-1:0] m1_decode_w = addr_decode(M1_AXI_AWADDR);  // M1写地址解码
+
+    // ==================== 从机侧信号数组 ====================
+    // [0]:ITCM [1]:DTCM [2]:APB [3]:CLINT [4]:PLIC [5]:DM [6]:XMEM
+    wire [NumSlaves-1:0] slv_arready = {XMEM_AXI_ARREADY, DM_AXI_ARREADY, OM2_AXI_ARREADY,
+                                        OM1_AXI_ARREADY, OM0_AXI_ARREADY, DMEM_AXI_ARREADY,
+                                        IMEM_AXI_ARREADY};
+    wire [NumSlaves-1:0] slv_rvalid  = {XMEM_AXI_RVALID, DM_AXI_RVALID, OM2_AXI_RVALID,
+                                        OM1_AXI_RVALID, OM0_AXI_RVALID, DMEM_AXI_RVALID,
+                                        IMEM_AXI_RVALID};
+    // AXI-Lite每次传输都是最后一拍
+    wire [NumSlaves-1:0] slv_rlast   = {XMEM_AXI_RLAST, DM_AXI_RLAST, 1'b1, 1'b1, 1'b1,
+                                        DMEM_AXI_RLAST, IMEM_AXI_RLAST};
+    wire [NumSlaves-1:0] slv_awready = {XMEM_AXI_AWREADY, DM_AXI_AWREADY, OM2_AXI_AWREADY,
+                                        OM1_AXI_AWREADY, OM0_AXI_AWREADY, DMEM_AXI_AWREADY,
+                                        IMEM_AXI_AWREADY};
+    wire [NumSlaves-1:0] slv_wready  = {XMEM_AXI_WREADY, DM_AXI_WREADY, OM2_AXI_WREADY,
+                                        OM1_AXI_WREADY, OM0_AXI_WREADY, DMEM_AXI_WREADY,
+                                        IMEM_AXI_WREADY};
+    wire [NumSlaves-1:0] slv_bvalid  = {XMEM_AXI_BVALID, DM_AXI_BVALID, OM2_AXI_BVALID,
+                                        OM1_AXI_BVALID, OM0_AXI_BVALID, DMEM_AXI_BVALID,
+                                        IMEM_AXI_BVALID};
+
+    // AXI-Lite不回传ID
+    wire [  C_AXI_ID_WIDTH-1:0] slv_rid  [NumSlaves];
+    wire [C_AXI_DATA_WIDTH-1:0] slv_rdata[NumSlaves];
+    wire [                 1:0] slv_rresp[NumSlaves];
+    wire [  C_AXI_ID_WIDTH-1:0] slv_bid  [NumSlaves];
+    wire [                 1:0] slv_bresp[NumSlaves];
+
+    assign slv_rid[ItcmIdx]    = IMEM_AXI_RID;
+    assign slv_rid[DtcmIdx]    = DMEM_AXI_RID;
+    assign slv_rid[ApbIdx]     = '0;
+    assign slv_rid[ClintIdx]   = '0;
+    assign slv_rid[PlicIdx]    = '0;
+    assign slv_rid[DmIdx]      = DM_AXI_RID;
+    assign slv_rid[XmemIdx]    = XMEM_AXI_RID;
+
+    assign slv_rdata[ItcmIdx]  = IMEM_AXI_RDATA;
+    assign slv_rdata[DtcmIdx]  = DMEM_AXI_RDATA;
+    assign slv_rdata[ApbIdx]   = OM0_AXI_RDATA;
+    assign slv_rdata[ClintIdx] = OM1_AXI_RDATA;
+    assign slv_rdata[PlicIdx]  = OM2_AXI_RDATA;
+    assign slv_rdata[DmIdx]    = DM_AXI_RDATA;
+    assign slv_rdata[XmemIdx]  = XMEM_AXI_RDATA;
+
+    assign slv_rresp[ItcmIdx]  = IMEM_AXI_RRESP;
+    assign slv_rresp[DtcmIdx]  = DMEM_AXI_RRESP;
+    assign slv_rresp[ApbIdx]   = OM0_AXI_RRESP;
+    assign slv_rresp[ClintIdx] = OM1_AXI_RRESP;
+    assign slv_rresp[PlicIdx]  = OM2_AXI_RRESP;
+    assign slv_rresp[DmIdx]    = DM_AXI_RRESP;
+    assign slv_rresp[XmemIdx]  = XMEM_AXI_RRESP;
+
+    assign slv_bid[ItcmIdx]    = IMEM_AXI_BID;
+    assign slv_bid[DtcmIdx]    = DMEM_AXI_BID;
+    assign slv_bid[ApbIdx]     = '0;
+    assign slv_bid[ClintIdx]   = '0;
+    assign slv_bid[PlicIdx]    = '0;
+    assign slv_bid[DmIdx]      = DM_AXI_BID;
+    assign slv_bid[XmemIdx]    = XMEM_AXI_BID;
+
+    assign slv_bresp[ItcmIdx]  = IMEM_AXI_BRESP;
+    assign slv_bresp[DtcmIdx]  = DMEM_AXI_BRESP;
+    assign slv_bresp[ApbIdx]   = OM0_AXI_BRESP;
+    assign slv_bresp[ClintIdx] = OM1_AXI_BRESP;
+    assign slv_bresp[PlicIdx]  = OM2_AXI_BRESP;
+    assign slv_bresp[DmIdx]    = DM_AXI_BRESP;
+    assign slv_bresp[XmemIdx]  = XMEM_AXI_BRESP;
+
+    // 由本模块驱动的从机侧握手信号
+    wire [NumSlaves-1:0] slv_arvalid;
+    wire [NumSlaves-1:0] slv_rready;
+    wire [NumSlaves-1:0] slv_awvalid;
+    wire [NumSlaves-1:0] slv_wvalid;
+    wire [NumSlaves-1:0] slv_bready;
+
+    wire [NumSlaves-1:0] slv_ar_hs = slv_arvalid & slv_arready;
+    wire [NumSlaves-1:0] slv_r_hs = slv_rvalid & slv_rready;
+    wire [NumSlaves-1:0] slv_r_done = slv_r_hs & slv_rlast;
+    wire [NumSlaves-1:0] slv_w_hs = slv_wvalid & slv_wready;
+
+    // ==================== 读地址通道 - 按从机独立仲裁 ====================
+    // 每个从机各自在M0/M1之间仲裁，两主机访问不同从机时同拍各自发出；
+    // 顺序FIFO未满即可继续发出，同一从机的连续请求不必等待前一次响应返回
+    wire [SlvIdxWidth-1:0] m0_rq_head;  // M0最老在途读事务所在从机
+    wire                   m0_rq_empty;
+    wire                   m0_rq_full;
+    wire [SlvIdxWidth-1:0] m1_rq_head;  // M1最老在途读事务所在从机
+    wire                   m1_rq_empty;
+    wire                   m1_rq_full;
+    wire [  NumSlaves-1:0] sq_head;  // 各从机最老在途读事务所属主机(1: M1)
+    wire [  NumSlaves-1:0] sq_empty;
+    wire [  NumSlaves-1:0] sq_full;
+
+    wire [NumSlaves-1:0] m0_ar_req = {NumSlaves{M0_AXI_ARVALID && !m0_rq_full}} & m0_decode_r & ~sq_full;
+    wire [NumSlaves-1:0] m1_ar_req = {NumSlaves{M1_AXI_ARVALID && !m1_rq_full}} & m1_decode_r & ~sq_full;
+
+    reg  [NumSlaves-1:0] ar_prio_m0;  // 轮询优先级，1表示下次冲突时M0优先，复位后M1优先
+    reg  [NumSlaves-1:0] ar_lock;  // 上拍已授权但从机未接收，保持授权避免地址在握手前被另一主机替换
+    reg  [NumSlaves-1:0] ar_lock_m1;  // 被保持的授权属于M1
+    wire [NumSlaves-1:0] ar_gnt_m0;
+    wire [NumSlaves-1:0] ar_gnt_m1;
+
+    genvar i;
+    generate
+        for (i = 0; i < NumSlaves; i = i + 1) begin : gen_ar_arb
+            assign ar_gnt_m1[i] = ar_lock[i] ? (ar_lock_m1[i] && m1_ar_req[i]) :
+                                  (m1_ar_req[i] && (!m0_ar_req[i] || !ar_prio_m0[i]));
+            assign ar_gnt_m0[i] = ar_lock[i] ? (!ar_lock_m1[i] && m0_ar_req[i]) :
+                                  (m0_ar_req[i] && !ar_gnt_m1[i]);
+            assign slv_arvalid[i] = ar_gnt_m0[i] || ar_gnt_m1[i];
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            ar_prio_m0 <= {NumSlaves{1'b0}};
+            ar_lock    <= {NumSlaves{1'b0}};
+            ar_lock_m1 <= {NumSlaves{1'b0}};
+        end else begin
+            ar_lock    <= slv_arvalid & ~slv_arready;
+            ar_lock_m1 <= ar_gnt_m1;
+            for (int k = 0; k < NumSlaves; k = k + 1) begin
+                if (slv_ar_hs[k]) ar_prio_m0[k] <= ar_gnt_m1[k];
+            end
+        end
+    end
+
+    assign M0_AXI_ARREADY = |(ar_gnt_m0 & slv_arready);
+    assign M1_AXI_ARREADY = |(ar_gnt_m1 & slv_arready);
+
+    wire m0_ar_hs = M0_AXI_ARVALID && M0_AXI_ARREADY;
+    wire m1_ar_hs = M1_AXI_ARVALID && M1_AXI_ARREADY;
+    wire m0_r_done = M0_AXI_RVALID && M0_AXI_RREADY && M0_AXI_RLAST;
+    wire m1_r_done = M1_AXI_RVALID && M1_AXI_RREADY && M1_AXI_RLAST;
+
+    // 主机侧顺序FIFO：记录每个主机读事务依次发往的从机
+    axi_order_fifo #(
+        .DATA_WIDTH(SlvIdxWidth),
+        .DEPTH     (OstDepth)
+    ) u_m0_rd_order (
+        .clk    (clk),
+        .rst_n  (rst_n),
+        .push_i (m0_ar_hs),
+        .data_i (slave_index(m0_decode_r)),
+        .pop_i  (m0_r_done),
+        .head_o (m0_rq_head),
+        .empty_o(m0_rq_empty),
+        .full_o (m0_rq_full)
+    );
+
+    axi_order_fifo #(
+        .DATA_WIDTH(SlvIdxWidth),
+        .DEPTH     (OstDepth)
+    ) u_m1_rd_order (
+        .clk    (clk),
+        .rst_n  (rst_n),
+        .push_i (m1_ar_hs),
+        .data_i (slave_index(m1_decode_r)),
+        .pop_i  (m1_r_done),
+        .head_o (m1_rq_head),
+        .empty_o(m1_rq_empty),
+        .full_o (m1_rq_full)
+    );
+
+    // 从机侧顺序FIFO：记录每个从机依次接收的读事务来自哪个主机
+    generate
+        for (i = 0; i < NumSlaves; i = i + 1) begin : gen_slv_rd_order
+            axi_order_fifo #(
+                .DATA_WIDTH(1),
+                .DEPTH     (OstDepth)
+            ) u_slv_rd_order (
+                .clk    (clk),
+                .rst_n  (rst_n),
+                .push_i (slv_ar_hs[i]),
+                .data_i (ar_gnt_m1[i]),
+                .pop_i  (slv_r_done[i]),
+                .head_o (sq_head[i]),
+                .empty_o(sq_empty[i]),
+                .full_o (sq_full[i])
+            );
+        end
+    endgenerate
+
+    // ==================== 读数据通道 - 按发出顺序路由 ====================
+    // 从机的读数据仅在其同时是该主机最老事务所在从机、且该从机最老事务属于该主机时返回，
+    // 保证每个主机按发出顺序收到响应(AXI-Lite外设不回传ID，主机也不依赖ID区分)；
+    // 两主机的最老事务位于不同从机时同拍各自返回
+    wire [NumSlaves-1:0] r_sel_m0;
+    wire [NumSlaves-1:0] r_sel_m1;
+
+    generate
+        for (i = 0; i < NumSlaves; i = i + 1) begin : gen_r_route
+            assign r_sel_m0[i] = !m0_rq_empty && (m0_rq_head == SlvIdxWidth'(i)) &&
+                                 !sq_empty[i] && !sq_head[i];
+            assign r_sel_m1[i] = !m1_rq_empty && (m1_rq_head == SlvIdxWidth'(i)) &&
+                                 !sq_empty[i] && sq_head[i];
+            assign slv_rready[i] = (r_sel_m0[i] && M0_AXI_RREADY) ||
+                                   (r_sel_m1[i] && M1_AXI_RREADY);
+        end
+    endgenerate
+
+    reg [  C_AXI_ID_WIDTH-1:0] m0_rid;
+    reg [C_AXI_DATA_WIDTH-1:0] m0_rdata;
+    reg [                 1:0] m0_rresp;
+    reg [  C_AXI_ID_WIDTH-1:0] m1_rid;
+    reg [C_AXI_DATA_WIDTH-1:0] m1_rdata;
+    reg [                 1:0] m1_rresp;
+
+    always @(*) begin
+        m0_rid   = '0;
+        m0_rdata = '0;
+        m0_rresp = '0;
+        m1_rid   = '0;
+        m1_rdata = '0;
+        m1_rresp = '0;
+        for (int k = 0; k < NumSlaves; k = k + 1) begin
+            if (r_sel_m0[k]) begin
+                m0_rid   = slv_rid[k];
+                m0_rdata = slv_rdata[k];
+                m0_rresp = slv_rresp[k];
+            end
+            if (r_sel_m1[k]) begin
+                m1_rid   = slv_rid[k];
+                m1_rdata = slv_rdata[k];
+                m1_rresp = slv_rresp[k];
+            end
+        end
+    end
+
+    assign M0_AXI_RID    = m0_rid;
+    assign M0_AXI_RDATA  = m0_rdata;
+    assign M0_AXI_RRESP  = m0_rresp;
+    assign M0_AXI_RLAST  = |(r_sel_m0 & slv_rlast);
+    assign M0_AXI_RUSER  = 4'b0;  // AXI-Lite不使用RUSER信号，设为0
+    assign M0_AXI_RVALID = |(r_sel_m0 & slv_rvalid);
+
+    assign M1_AXI_RID    = m1_rid;
+    assign M1_AXI_RDATA  = m1_rdata;
+    assign M1_AXI_RRESP  = m1_rresp;
+    assign M1_AXI_RLAST  = |(r_sel_m1 & slv_rlast);
+    assign M1_AXI_RUSER  = 4'b0;
+    assign M1_AXI_RVALID = |(r_sel_m1 & slv_rvalid);
+
+    // ==================== 写通道 - 只有M1有写操作 ====================
+    wire [SlvIdxWidth-1:0] wq_head;  // 最老的尚未发送写数据的写事务所在从机
+    wire                   wq_empty;
+    wire                   wq_full;
+    wire [SlvIdxWidth-1:0] bq_head;  // 最老的等待写响应的写事务所在从机
+    wire                   bq_empty;
+    wire                   bq_full;
+    reg                    w_ahead;  // 写数据先于写地址完成，对应写地址握手时不再入队
+
+    assign slv_awvalid = {NumSlaves{M1_AXI_AWVALID && !wq_full && !bq_full}} & m1_decode_w;
+    assign M1_AXI_AWREADY = |(slv_awvalid & slv_awready);
+
+    wire m1_aw_hs = M1_AXI_AWVALID && M1_AXI_AWREADY;
+    wire m1_w_done = M1_AXI_WVALID && M1_AXI_WREADY && M1_AXI_WLAST;
+    wire m1_b_hs = M1_AXI_BVALID && M1_AXI_BREADY;
+
+    // 写数据路由：有已握手但未发送数据的写地址时发往其中最老者，
+    // 否则走快速通路直接发往当前写地址解码的从机，与写地址同拍或先于写地址发出
+    wire [NumSlaves-1:0] w_sel = wq_empty ?
+                                 ({NumSlaves{M1_AXI_AWVALID && !w_ahead}} & m1_decode_w) :
+                                 (NumSlaves'(1) << wq_head);
+
+    assign slv_wvalid = {NumSlaves{M1_AXI_WVALID}} & w_sel;
+    assign M1_AXI_WREADY = |(w_sel & slv_wready);
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            w_ahead <= 1'b0;
+        end else if (m1_aw_hs) begin
+            w_ahead <= 1'b0;
+        end else if (wq_empty && m1_w_done) begin
+            w_ahead <= 1'b1;
+        end
+    end
+
+    axi_order_fifo #(
+        .DATA_WIDTH(SlvIdxWidth),
+        .DEPTH     (OstDepth)
+    ) u_w_order (
+        .clk    (clk),
+        .rst_n  (rst_n),
+        .push_i (m1_aw_hs && !w_ahead && !(wq_empty && m1_w_done)),
+        .data_i (slave_index(m1_decode_w)),
+        .pop_i  (m1_w_done && !wq_empty),
+        .head_o (wq_head),
+        .empty_o(wq_empty),
+        .full_o (wq_full)
+    );
+
+    // 写响应按写地址握手顺序从对应从机返回
+    axi_order_fifo #(
+        .DATA_WIDTH(SlvIdxWidth),
+        .DEPTH     (OstDepth)
+    ) u_b_order (
+        .clk    (clk),
+        .rst_n  (rst_n),
+        .push_i (m1_aw_hs),
+        .data_i (slave_index(m1_decode_w)),
+        .pop_i  (m1_b_hs),
+        .head_o (bq_head),
+        .empty_o(bq_empty),
+        .full_o (bq_full)
+    );
+
+    wire [NumSlaves-1:0] b_sel = {NumSlaves{!bq_empty}} & (NumSlaves'(1) << bq_head);
+
+    assign slv_bready    = {NumSlaves{M1_AXI_BREADY}} & b_sel;
+    assign M1_AXI_BVALID = |(b_sel & slv_bvalid);
+    assign M1_AXI_BID    = slv_bid[bq_head];
+    assign M1_AXI_BRESP  = slv_bresp[bq_head];
+
+    // ==================== 输出端口连接 ====================
+    // IMEM
+    assign IMEM_AXI_ARID = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARID : M0_AXI_ARID;
+    assign IMEM_AXI_ARADDR = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign IMEM_AXI_ARLEN = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARLEN : M0_AXI_ARLEN;
+    assign IMEM_AXI_ARSIZE = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARSIZE : M0_AXI_ARSIZE;
+    assign IMEM_AXI_ARBURST = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARBURST : M0_AXI_ARBURST;
+    assign IMEM_AXI_ARLOCK = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARLOCK : M0_AXI_ARLOCK;
+    assign IMEM_AXI_ARCACHE = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARCACHE : M0_AXI_ARCACHE;
+    assign IMEM_AXI_ARPROT = ar_gnt_m1[ItcmIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign IMEM_AXI_ARVALID = slv_arvalid[ItcmIdx];
+    assign IMEM_AXI_AWID = M1_AXI_AWID;
+    assign IMEM_AXI_AWADDR = M1_AXI_AWADDR;
+    assign IMEM_AXI_AWLEN = M1_AXI_AWLEN;
+    assign IMEM_AXI_AWSIZE = M1_AXI_AWSIZE;
+    assign IMEM_AXI_AWBURST = M1_AXI_AWBURST;
+    assign IMEM_AXI_AWLOCK = M1_AXI_AWLOCK;
+    assign IMEM_AXI_AWCACHE = M1_AXI_AWCACHE;
+    assign IMEM_AXI_AWPROT = M1_AXI_AWPROT;
+    assign IMEM_AXI_AWVALID = slv_awvalid[ItcmIdx];
+    assign IMEM_AXI_WDATA = M1_AXI_WDATA;
+    assign IMEM_AXI_WSTRB = M1_AXI_WSTRB;
+    assign IMEM_AXI_WLAST = M1_AXI_WLAST;
+    assign IMEM_AXI_WVALID = slv_wvalid[ItcmIdx];
+    assign IMEM_AXI_BREADY = slv_bready[ItcmIdx];
+    assign IMEM_AXI_RREADY = slv_rready[ItcmIdx];
+
+    // DMEM
+    assign DMEM_AXI_ARID = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARID : M0_AXI_ARID;
+    assign DMEM_AXI_ARADDR = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign DMEM_AXI_ARLEN = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARLEN : M0_AXI_ARLEN;
+    assign DMEM_AXI_ARSIZE = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARSIZE : M0_AXI_ARSIZE;
+    assign DMEM_AXI_ARBURST = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARBURST : M0_AXI_ARBURST;
+    assign DMEM_AXI_ARLOCK = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARLOCK : M0_AXI_ARLOCK;
+    assign DMEM_AXI_ARCACHE = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARCACHE : M0_AXI_ARCACHE;
+    assign DMEM_AXI_ARPROT = ar_gnt_m1[DtcmIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign DMEM_AXI_ARVALID = slv_arvalid[DtcmIdx];
+    assign DMEM_AXI_AWID = M1_AXI_AWID;
+    assign DMEM_AXI_AWADDR = M1_AXI_AWADDR;
+    assign DMEM_AXI_AWLEN = M1_AXI_AWLEN;
+    assign DMEM_AXI_AWSIZE = M1_AXI_AWSIZE;
+    assign DMEM_AXI_AWBURST = M1_AXI_AWBURST;
+    assign DMEM_AXI_AWLOCK = M1_AXI_AWLOCK;
+    assign DMEM_AXI_AWCACHE = M1_AXI_AWCACHE;
+    assign DMEM_AXI_AWPROT = M1_AXI_AWPROT;
+    assign DMEM_AXI_AWVALID = slv_awvalid[DtcmIdx];
+    assign DMEM_AXI_WDATA = M1_AXI_WDATA;
+    assign DMEM_AXI_WSTRB = M1_AXI_WSTRB;
+    assign DMEM_AXI_WLAST = M1_AXI_WLAST;
+    assign DMEM_AXI_WVALID = slv_wvalid[DtcmIdx];
+    assign DMEM_AXI_BREADY = slv_bready[DtcmIdx];
+    assign DMEM_AXI_RREADY = slv_rready[DtcmIdx];
+
+    // DM
+    assign DM_AXI_ARID = ar_gnt_m1[DmIdx] ? M1_AXI_ARID : M0_AXI_ARID;
+    assign DM_AXI_ARADDR = ar_gnt_m1[DmIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign DM_AXI_ARLEN = ar_gnt_m1[DmIdx] ? M1_AXI_ARLEN : M0_AXI_ARLEN;
+    assign DM_AXI_ARSIZE = ar_gnt_m1[DmIdx] ? M1_AXI_ARSIZE : M0_AXI_ARSIZE;
+    assign DM_AXI_ARBURST = ar_gnt_m1[DmIdx] ? M1_AXI_ARBURST : M0_AXI_ARBURST;
+    assign DM_AXI_ARLOCK = ar_gnt_m1[DmIdx] ? M1_AXI_ARLOCK : M0_AXI_ARLOCK;
+    assign DM_AXI_ARCACHE = ar_gnt_m1[DmIdx] ? M1_AXI_ARCACHE : M0_AXI_ARCACHE;
+    assign DM_AXI_ARPROT = ar_gnt_m1[DmIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign DM_AXI_ARVALID = slv_arvalid[DmIdx];
+    assign DM_AXI_AWID = M1_AXI_AWID;
+    assign DM_AXI_AWADDR = M1_AXI_AWADDR;
+    assign DM_AXI_AWLEN = M1_AXI_AWLEN;
+    assign DM_AXI_AWSIZE = M1_AXI_AWSIZE;
+    assign DM_AXI_AWBURST = M1_AXI_AWBURST;
+    assign DM_AXI_AWLOCK = M1_AXI_AWLOCK;
+    assign DM_AXI_AWCACHE = M1_AXI_AWCACHE;
+    assign DM_AXI_AWPROT = M1_AXI_AWPROT;
+    assign DM_AXI_AWVALID = slv_awvalid[DmIdx];
+    assign DM_AXI_WDATA = M1_AXI_WDATA;
+    assign DM_AXI_WSTRB = M1_AXI_WSTRB;
+    assign DM_AXI_WLAST = M1_AXI_WLAST;
+    assign DM_AXI_WVALID = slv_wvalid[DmIdx];
+    assign DM_AXI_BREADY = slv_bready[DmIdx];
+    assign DM_AXI_RREADY = slv_rready[DmIdx];
+
+    // XMEM
+    assign XMEM_AXI_ARID = ar_gnt_m1[XmemIdx] ? M1_AXI_ARID : M0_AXI_ARID;
+    assign XMEM_AXI_ARADDR = ar_gnt_m1[XmemIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign XMEM_AXI_ARLEN = ar_gnt_m1[XmemIdx] ? M1_AXI_ARLEN : M0_AXI_ARLEN;
+    assign XMEM_AXI_ARSIZE = ar_gnt_m1[XmemIdx] ? M1_AXI_ARSIZE : M0_AXI_ARSIZE;
+    assign XMEM_AXI_ARBURST = ar_gnt_m1[XmemIdx] ? M1_AXI_ARBURST : M0_AXI_ARBURST;
+    assign XMEM_AXI_ARLOCK = ar_gnt_m1[XmemIdx] ? M1_AXI_ARLOCK : M0_AXI_ARLOCK;
+    assign XMEM_AXI_ARCACHE = ar_gnt_m1[XmemIdx] ? M1_AXI_ARCACHE : M0_AXI_ARCACHE;
+    assign XMEM_AXI_ARPROT = ar_gnt_m1[XmemIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign XMEM_AXI_ARVALID = slv_arvalid[XmemIdx];
+    assign XMEM_AXI_AWID = M1_AXI_AWID;
+    assign XMEM_AXI_AWADDR = M1_AXI_AWADDR;
+    assign XMEM_AXI_AWLEN = M1_AXI_AWLEN;
+    assign XMEM_AXI_AWSIZE = M1_AXI_AWSIZE;
+    assign XMEM_AXI_AWBURST = M1_AXI_AWBURST;
+    assign XMEM_AXI_AWLOCK = M1_AXI_AWLOCK;
+    assign XMEM_AXI_AWCACHE = M1_AXI_AWCACHE;
+    assign XMEM_AXI_AWPROT = M1_AXI_AWPROT;
+    assign XMEM_AXI_AWVALID = slv_awvalid[XmemIdx];
+    assign XMEM_AXI_WDATA = M1_AXI_WDATA;
+    assign XMEM_AXI_WSTRB = M1_AXI_WSTRB;
+    assign XMEM_AXI_WLAST = M1_AXI_WLAST;
+    assign XMEM_AXI_WVALID = slv_wvalid[XmemIdx];
+    assign XMEM_AXI_BREADY = slv_bready[XmemIdx];
+    assign XMEM_AXI_RREADY = slv_rready[XmemIdx];
+
+    // APB/CLINT/PLIC (AXI-Lite)
+    assign OM0_AXI_ACLK = clk;
+    assign OM0_AXI_ARESETN = rst_n;
+    assign OM1_AXI_ACLK = clk;
+    assign OM1_AXI_ARESETN = rst_n;
+    assign OM2_AXI_ACLK = clk;
+    assign OM2_AXI_ARESETN = rst_n;
+
+    assign OM0_AXI_ARADDR = ar_gnt_m1[ApbIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign OM0_AXI_ARPROT = ar_gnt_m1[ApbIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign OM0_AXI_ARVALID = slv_arvalid[ApbIdx];
+    assign OM1_AXI_ARADDR = ar_gnt_m1[ClintIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign OM1_AXI_ARPROT = ar_gnt_m1[ClintIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign OM1_AXI_ARVALID = slv_arvalid[ClintIdx];
+    assign OM2_AXI_ARADDR = ar_gnt_m1[PlicIdx] ? M1_AXI_ARADDR : M0_AXI_ARADDR;
+    assign OM2_AXI_ARPROT = ar_gnt_m1[PlicIdx] ? M1_AXI_ARPROT : M0_AXI_ARPROT;
+    assign OM2_AXI_ARVALID = slv_arvalid[PlicIdx];
+
+    assign OM0_AXI_AWADDR = M1_AXI_AWADDR;
+    assign OM0_AXI_AWPROT = M1_AXI_AWPROT;
+    assign OM0_AXI_AWVALID = slv_awvalid[ApbIdx];
+    assign OM1_AXI_AWADDR = M1_AXI_AWADDR;
+    assign OM1_AXI_AWPROT = M1_AXI_AWPROT;
+    assign OM1_AXI_AWVALID = slv_awvalid[ClintIdx];
+    assign OM2_AXI_AWADDR = M1_AXI_AWADDR;
+    assign OM2_AXI_AWPROT = M1_AXI_AWPROT;
+    assign OM2_AXI_AWVALID = slv_awvalid[PlicIdx];
+
+    assign OM0_AXI_WDATA = M1_AXI_WDATA;
+    assign OM0_AXI_WSTRB = M1_AXI_WSTRB;
+    assign OM0_AXI_WVALID = slv_wvalid[ApbIdx];
+    assign OM1_AXI_WDATA = M1_AXI_WDATA;
+    assign OM1_AXI_WSTRB = M1_AXI_WSTRB;
+    assign OM1_AXI_WVALID = slv_wvalid[ClintIdx];
+    assign OM2_AXI_WDATA = M1_AXI_WDATA;
+    assign OM2_AXI_WSTRB = M1_AXI_WSTRB;
+    assign OM2_AXI_WVALID = slv_wvalid[PlicIdx];
+
+    assign OM0_AXI_BREADY = slv_bready[ApbIdx];
+    assign OM1_AXI_BREADY = slv_bready[ClintIdx];
+    assign OM2_AXI_BREADY = slv_bready[PlicIdx];
+    assign OM0_AXI_RREADY = slv_rready[ApbIdx];
+    assign OM1_AXI_RREADY = slv_rready[ClintIdx];
+    assign OM2_AXI_RREADY = slv_rready[PlicIdx];
+endmodule
@@ -0,0 +1,76 @@
+/*
+ The MIT License (MIT)
+
+ Copyright © 2025 Yusen Wang @yusen.w@qq.com
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ */
+
+`include "defines.svh"
+
+// 事务顺序FIFO - 地址握手时压入事务去向(从机或主机编号)，最后一拍响应握手时弹出，
+// 队首即为当前应被返回响应的事务，用于互联按发出顺序路由R/W/B通道
+module axi_order_fifo #(
+    parameter int DATA_WIDTH = 3,  // 表项位宽
+    parameter int DEPTH      = 4   // 深度(2的幂，至少为2)
+) (
+    input wire clk,
+    input wire rst_n,
+
+    input wire                  push_i,  // 压入
+    input wire [DATA_WIDTH-1:0] data_i,  // 压入数据
+    input wire                  pop_i,   // 弹出队首
+
+    output wire [DATA_WIDTH-1:0] head_o,   // 队首数据
+    output wire                  empty_o,  // 空
+    output wire                  full_o    // 满
+);
+
+    localparam int PtrWidth = $clog2(DEPTH);
+
+    reg [DATA_WIDTH-1:0] fifo_data[DEPTH];
+    reg [  PtrWidth-1:0] wr_ptr;
+    reg [  PtrWidth-1:0] rd_ptr;
+    reg [    PtrWidth:0] count;
+
+    wire do_push = push_i && !full_o;
+    wire do_pop  = pop_i && !empty_o;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            wr_ptr <= {PtrWidth{1'b0}};
+            rd_ptr <= {PtrWidth{1'b0}};
+            count  <= {(PtrWidth + 1) {1'b0}};
+        end else begin
+            if (do_push) begin
+                fifo_data[wr_ptr] <= data_i;
+                wr_ptr            <= wr_ptr + 1'b1;
+            end
+            if (do_pop) begin
+                rd_ptr <= rd_ptr + 1'b1;
+            end
+            count <= count + do_push - do_pop;
+        end
+    end
+
+    assign head_o  = fifo_data[rd_ptr];
+    assign empty_o = (count == 0);
+    assign full_o  = (count == DEPTH);
+
+endmodule
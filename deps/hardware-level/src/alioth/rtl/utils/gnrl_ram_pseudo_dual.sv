@@ -42,7 +42,12 @@ module gnrl_ram_pseudo_dual #(
 
     // 读端口
     input  wire [ADDR_WIDTH-1:0] raddr_i,   // read addr
-    output reg  [DATA_WIDTH-1:0] data_o     // read data
+    output reg  [DATA_WIDTH-1:0] data_o,    // read data
+
+    // 第二读端口(ITCM取指/DTCM访存直连)，不使用时综合会被优化掉
+    input  wire [ADDR_WIDTH-1:0] raddr2_i,  // read addr
+    output reg  [DATA_WIDTH-1:0] data2_o,   // read data
+    output reg  [DATA_WIDTH-1:0] data2_next_o  // raddr2_i的下一个字(双发射/指令融合取指)，不使用时综合会被优化掉
 );
 
     // 字节地址到字地址转换的偏移量（每个字4字节，需要右移2位）
@@ -52,6 +57,7 @@ module gnrl_ram_pseudo_dual #(
     localparam DEPTH = (1 << (ADDR_WIDTH - ADDR_OFFSET));
 
     // 使用计算出的深度定义存储器
+    // 仿真宿主经tb_top的DPI开放数组直接以内存块方式读写(见tb_verilator/alioth_sim.h)
     (* ram_style = "block" *) reg [DATA_WIDTH-1:0] mem_r[0:DEPTH-1];
 
     initial begin
@@ -65,6 +71,8 @@ module gnrl_ram_pseudo_dual #(
     wire [ADDR_WIDTH-ADDR_OFFSET-1:0] wword_addr;
     assign rword_addr = raddr_i[ADDR_WIDTH-1:ADDR_OFFSET];
     assign wword_addr = waddr_i[ADDR_WIDTH-1:ADDR_OFFSET];
+    wire [ADDR_WIDTH-ADDR_OFFSET-1:0] rword_addr2 = raddr2_i[ADDR_WIDTH-1:ADDR_OFFSET];
+    wire [ADDR_WIDTH-ADDR_OFFSET-1:0] rword_addr2_next = rword_addr2 + 1'b1;
 
     // 写入逻辑
     always @(posedge clk) begin
@@ -86,4 +94,20 @@ module gnrl_ram_pseudo_dual #(
         end
     end
 
+    always @(posedge clk) begin
+        if (!rst_n) begin
+            data2_o <= {DATA_WIDTH{1'b0}};
+        end else begin
+            data2_o <= mem_r[rword_addr2];
+        end
+    end
+
+    always @(posedge clk) begin
+        if (!rst_n) begin
+            data2_next_o <= {DATA_WIDTH{1'b0}};
+        end else begin
+            data2_next_o <= mem_r[rword_addr2_next];
+        end
+    end
+
 endmodule
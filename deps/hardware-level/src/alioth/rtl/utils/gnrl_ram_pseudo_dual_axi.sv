@@ -83,7 +83,18 @@ module gnrl_ram_pseudo_dual_axi #(
     output wire [                   1:0] S_AXI_RRESP,
     output wire                          S_AXI_RLAST,
     output wire                          S_AXI_RVALID,
-    input  wire                          S_AXI_RREADY
+    input  wire                          S_AXI_RREADY,
+
+    // 直连读端口(ITCM取指/DTCM访存)，地址当拍给出，数据下一拍有效
+    input  wire [ADDR_WIDTH-1:0] tcm_raddr_i,
+    output wire [DATA_WIDTH-1:0] tcm_rdata_o,
+    output wire [DATA_WIDTH-1:0] tcm_rdata_next_o,  // tcm_raddr_i的下一个字，与tcm_rdata_o同拍有效
+
+    // 直连写端口(DTCM访存)，优先于AXI写通道，写入当拍AXI写数据通道暂停
+    input  wire                  tcm_we_i,
+    input  wire [           3:0] tcm_wmask_i,
+    input  wire [ADDR_WIDTH-1:0] tcm_waddr_i,
+    input  wire [DATA_WIDTH-1:0] tcm_wdata_i
 );
 
     // ADDR_LSB用于字节寻址转换为字寻址
@@ -365,8 +376,8 @@ module gnrl_ram_pseudo_dual_axi #(
     // 当写地址FIFO未满时才接受新的写请求
     assign S_AXI_AWREADY = !(wfifo_full || bfifo_full);
 
-    // S_AXI_WREADY始终为1
-    assign S_AXI_WREADY = 1'b1;
+    // 直连写端口占用RAM写口时暂停AXI写数据通道
+    assign S_AXI_WREADY = !tcm_we_i;
 
     // AXI写地址通道处理
     always @(posedge S_AXI_ACLK) begin
@@ -510,13 +521,14 @@ module gnrl_ram_pseudo_dual_axi #(
     assign S_AXI_BID = (bfifo_count > 0) ? bfifo_id[bfifo_rd_ptr] : bvalid_id;
     assign S_AXI_BRESP = (bfifo_count > 0) ? bfifo_resp[bfifo_rd_ptr] : bvalid_resp;
 
-    // 写逻辑连接
-    assign ram_waddr = (wr_fifo_count > 0) ? 
+    // 写逻辑连接 - 直连写端口优先
+    wire [ADDR_WIDTH-1:0] axi_ram_waddr = (wr_fifo_count > 0) ? 
                        wr_fifo_addr[wfifo_rd_ptr][ADDR_WIDTH-1:0] : 
                        S_AXI_AWADDR[ADDR_WIDTH-1:0];
-    assign ram_wdata = S_AXI_WDATA;
-    assign ram_we_mask = S_AXI_WSTRB;
-    assign ram_we = (S_AXI_WVALID && S_AXI_WREADY) ? 1'b1 : 1'b0;
+    assign ram_waddr = tcm_we_i ? tcm_waddr_i : axi_ram_waddr;
+    assign ram_wdata = tcm_we_i ? tcm_wdata_i : S_AXI_WDATA;
+    assign ram_we_mask = tcm_we_i ? tcm_wmask_i : S_AXI_WSTRB;
+    assign ram_we = tcm_we_i || (S_AXI_WVALID && S_AXI_WREADY);
 
     // 读逻辑连接 - 修改为直接使用输入地址、burst地址或FIFO中的地址
     // 当有新的地址有效时，直接使用输入地址；
@@ -553,7 +565,10 @@ module gnrl_ram_pseudo_dual_axi #(
         .waddr_i  (ram_waddr),
         .data_i   (ram_wdata),
         .raddr_i  (ram_raddr),
-        .data_o   (ram_rdata)
+        .data_o   (ram_rdata),
+        .raddr2_i (tcm_raddr_i),
+        .data2_o  (tcm_rdata_o),
+        .data2_next_o(tcm_rdata_next_o)
     );
 
 endmodule
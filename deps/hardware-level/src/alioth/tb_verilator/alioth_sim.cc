@@ -0,0 +1,407 @@
+#include "alioth_sim.h"
+
+#include "Vtb_top.h"
+#include "Vtb_top__Dpi.h"
+#include "svdpi.h"
+#include "verilated.h"
+#include "verilated_vcd_c.h"
+#if VM_COVERAGE
+#include "verilated_cov.h"
+#endif
+
+#include <fcntl.h>
+#include <gelf.h>
+#include <libelf.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// tb_top模块在Verilator中的DPI作用域名
+static const char *TB_SCOPE = "TOP.tb_top";
+
+// tb_mem_bind调用期间待填充的ITCM/DTCM/XMEM视图，按ALIOTHSIM_ITCM/DTCM/XMEM编号索引
+static TcmSpan **g_bind = nullptr;
+
+// tb_top在tb_mem_bind中回调，传入各存储阵列的开放数组句柄
+void aliothsim_mem_bind(int region, const svOpenArrayHandle mem) {
+    if (!g_bind || region < ALIOTHSIM_ITCM || region > ALIOTHSIM_XMEM) return;
+    TcmSpan *span = g_bind[region];
+    // Verilator中32位以内的数组元素按uint32_t连续存放，元素宽度不符时置空由调用方报错
+    size_t nwords = static_cast<size_t>(svSize(mem, 1));
+    if (static_cast<size_t>(svSizeOfArray(mem)) != nwords * sizeof(uint32_t)) return;
+    span->words = static_cast<uint32_t *>(svGetArrayPtr(mem));
+    span->nwords = nwords;
+}
+
+AliothSim::AliothSim(int argc, const char **argv, bool host_load)
+    : ctx_(new VerilatedContext), top_(nullptr), tfp_(nullptr), trace_en_(false), wfi_ff_(false), tick_(0),
+      cycles_(0), itcm_{}, dtcm_{}, xmem_{}, dumped_(false), ok_(true), cov_file_("coverage.dat") {
+    std::vector<const char *> args;
+    args.push_back("aliothsim");
+    for (int i = 0; i < argc; i++) {
+        args.push_back(argv[i]);
+        if (strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--trace") == 0) trace_en_ = true;
+        if (strncmp(argv[i], "+coverage_file=", 15) == 0) cov_file_ = argv[i] + 15;
+        if (strcmp(argv[i], "+wfi_fastforward") == 0) wfi_ff_ = true;
+    }
+    if (host_load) args.push_back("+host_load");
+    ctx_->commandArgs(static_cast<int>(args.size()), args.data());
+
+    top_ = new Vtb_top{ctx_};
+
+    if (trace_en_) {
+        ctx_->traceEverOn(true);
+        tfp_ = new VerilatedVcdC;
+        top_->trace(tfp_, 99);  // Trace 99 levels of hierarchy
+        tfp_->open("tb_top.vcd");
+    }
+
+    top_->clk = 0;
+    top_->rst_n = 0;
+    // 首次求值执行initial块，之后宿主写入的存储器内容不会被覆盖
+    top_->eval();
+    if (trace_en_ && top_->dump_en) tfp_->dump(tick_);
+    tick_++;
+
+    set_scope();
+    int ib, is, db, ds;
+    tb_mem_layout(&ib, &is, &db, &ds);
+    int xb, xs;
+    tb_xmem_layout(&xb, &xs);
+
+    // 存储阵列经tb_mem_bind导出的开放数组句柄取得，不依赖Verilator内部的层次化成员名
+    itcm_.base = static_cast<uint32_t>(ib);
+    dtcm_.base = static_cast<uint32_t>(db);
+    xmem_.base = static_cast<uint32_t>(xb);
+    TcmSpan *bind[] = {&itcm_, &dtcm_, &xmem_};
+    g_bind = bind;
+    tb_mem_bind();
+    g_bind = nullptr;
+    // 未定义ENABLE_XMEM时tb_xmem_layout给出的大小为0，xmem_保持为空视图
+    if (!itcm_.words || !dtcm_.words || (xs != 0 && !xmem_.words) ||
+        itcm_.size_bytes() != static_cast<size_t>(is) || dtcm_.size_bytes() != static_cast<size_t>(ds) ||
+        xmem_.size_bytes() != static_cast<size_t>(xs)) {
+        // 库可能被嵌入宿主进程，不能直接退出，由调用方检查ok()后自行处理
+        std::cerr << "aliothsim: TCM layout mismatch between tb_top and mem_r\n";
+        ok_ = false;
+        return;
+    }
+
+    // 处理 +itcm_load= / +dtcm_load= / +xmem_load= 批量加载，以及登记对应的 _dump= 导出，
+    // 选项格式错误或加载失败时存储内容不可信，同样视为创建失败
+    for (int i = 0; i < argc; i++) {
+        const struct {
+            const char *prefix;
+            const TcmSpan *span;
+            bool dump;
+        } opts[] = {{"+itcm_load=", &itcm_, false},
+                    {"+dtcm_load=", &dtcm_, false},
+                    {"+xmem_load=", &xmem_, false},
+                    {"+itcm_dump=", &itcm_, true},
+                    {"+dtcm_dump=", &dtcm_, true},
+                    {"+xmem_dump=", &xmem_, true}};
+        for (const auto &o : opts) {
+            size_t n = strlen(o.prefix);
+            if (strncmp(argv[i], o.prefix, n) != 0) continue;
+            BinReq req;
+            if (!parse_bin_req(argv[i] + n, *o.span, &req)) {
+                std::cerr << "aliothsim: bad option " << argv[i] << "\n";
+                ok_ = false;
+            } else if (o.dump) {
+                dumps_.push_back(req);
+            } else if (load_bin(req.path.c_str(), req.addr) != ALIOTHSIM_OK) {
+                std::cerr << "aliothsim: failed to load " << argv[i] << "\n";
+                ok_ = false;
+            }
+        }
+    }
+}
+
+AliothSim::~AliothSim() {
+    // 创建失败的实例没有可信的存储内容，不执行导出
+    if (ok_) apply_dumps();
+    if (tfp_) {
+        tfp_->close();
+        delete tfp_;
+    }
+    top_->final();
+#if VM_COVERAGE
+    // 每次仿真写出独立的覆盖率数据，由回归流程用verilator_coverage合并
+    ctx_->coveragep()->write(cov_file_.c_str());
+#endif
+    delete top_;
+    delete ctx_;
+}
+
+void AliothSim::set_scope() {
+    // 多实例时每个上下文都有自己的作用域表
+    Verilated::threadContextp(ctx_);
+    svSetScope(svGetScopeFromName(TB_SCOPE));
+}
+
+void AliothSim::half_tick() {
+    top_->clk = !top_->clk;
+    top_->eval();
+    if (trace_en_ && top_->dump_en) {
+        tfp_->dump(tick_);
+        tick_++;
+        tfp_->dump(tick_);  // 第二次时间尺度更新
+        tick_++;
+    }
+    if (top_->clk && top_->rst_n) {
+        cycles_++;
+        if (wfi_ff_) {
+            // 跳过的周期计入cycles，与CSR cycle保持一致
+            set_scope();
+            cycles_ += static_cast<uint32_t>(tb_wfi_fastforward());
+        }
+    }
+}
+
+void AliothSim::reset(uint32_t cycles) {
+    top_->rst_n = 0;
+    for (uint32_t i = 0; i < cycles * 2; i++) half_tick();
+    top_->rst_n = 1;
+    top_->eval();
+    cycles_ = 0;
+}
+
+bool AliothSim::finished() const { return ctx_->gotFinish(); }
+
+int AliothSim::step_cycles(uint64_t n) {
+    for (uint64_t i = 0; i < n; i++) {
+        if (finished()) return ALIOTHSIM_FINISHED;
+        half_tick();
+        half_tick();
+    }
+    return finished() ? ALIOTHSIM_FINISHED : ALIOTHSIM_OK;
+}
+
+int AliothSim::run_until_pc(uint32_t pc, uint64_t max_cycles) {
+    uint64_t start = cycles_;
+    set_scope();
+    while (!finished()) {
+        if (static_cast<uint32_t>(tb_pc_read()) == pc) return ALIOTHSIM_OK;
+        if (max_cycles && cycles_ - start >= max_cycles) return ALIOTHSIM_TIMEOUT;
+        half_tick();
+        half_tick();
+    }
+    return ALIOTHSIM_FINISHED;
+}
+
+uint32_t AliothSim::read_reg(unsigned idx) {
+    if (idx >= 32) return 0;
+    set_scope();
+    return static_cast<uint32_t>(tb_gpr_read(static_cast<int>(idx)));
+}
+
+TcmSpan AliothSim::itcm() { return itcm_; }
+
+TcmSpan AliothSim::dtcm() { return dtcm_; }
+
+TcmSpan AliothSim::xmem() { return xmem_; }
+
+const TcmSpan *AliothSim::map_addr(uint32_t addr, size_t len) {
+    if (itcm_.contains(addr, len)) return &itcm_;
+    if (dtcm_.contains(addr, len)) return &dtcm_;
+    if (xmem_.contains(addr, len)) return &xmem_;
+    return nullptr;
+}
+
+// 存储阵列按字以宿主字节序存放，小端宿主上字节视图与总线地址一一对应
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "TCM byte views assume a little-endian host");
+
+int AliothSim::read_mem(uint32_t addr, void *buf, size_t len) {
+    const TcmSpan *span = map_addr(addr, len);
+    if (!span) return ALIOTHSIM_ERROR;
+    memcpy(buf, span->bytes() + (addr - span->base), len);
+    return ALIOTHSIM_OK;
+}
+
+int AliothSim::write_mem(uint32_t addr, const void *buf, size_t len) {
+    const TcmSpan *span = map_addr(addr, len);
+    if (!span) return ALIOTHSIM_ERROR;
+    memcpy(span->bytes() + (addr - span->base), buf, len);
+    return ALIOTHSIM_OK;
+}
+
+bool AliothSim::parse_bin_req(const char *arg, const TcmSpan &span, BinReq *req) {
+    std::string s(arg);
+    size_t at = s.rfind('@');
+    req->path = s.substr(0, at);
+    req->addr = span.base;
+    req->len = 0;
+    if (req->path.empty()) return false;
+    if (at != std::string::npos) {
+        char *end = nullptr;
+        unsigned long addr = strtoul(s.c_str() + at + 1, &end, 0);
+        // 小于区域大小的值视为区域内偏移，否则视为总线地址
+        req->addr = addr < span.size_bytes() ? span.base + static_cast<uint32_t>(addr)
+                                             : static_cast<uint32_t>(addr);
+        if (*end == ':') req->len = static_cast<uint32_t>(strtoul(end + 1, &end, 0));
+        if (*end != '\0') return false;
+    }
+    return span.contains(req->addr, req->len);
+}
+
+int AliothSim::load_bin(const char *path, uint32_t addr) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return ALIOTHSIM_ERROR;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    const TcmSpan *span = size >= 0 ? map_addr(addr, static_cast<size_t>(size)) : nullptr;
+    int ret = ALIOTHSIM_ERROR;
+    // 直接读入存储阵列，不经过中间缓冲
+    if (span && fread(span->bytes() + (addr - span->base), 1, size, fp) == static_cast<size_t>(size)) {
+        ret = ALIOTHSIM_OK;
+    }
+    fclose(fp);
+    return ret;
+}
+
+int AliothSim::dump_bin(const char *path, uint32_t addr, uint32_t len) {
+    const TcmSpan *span = map_addr(addr, len);
+    if (!span) return ALIOTHSIM_ERROR;
+    if (len == 0) len = static_cast<uint32_t>(span->size_bytes() - (addr - span->base));
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return ALIOTHSIM_ERROR;
+    size_t n = fwrite(span->bytes() + (addr - span->base), 1, len, fp);
+    fclose(fp);
+    return n == len ? ALIOTHSIM_OK : ALIOTHSIM_ERROR;
+}
+
+void AliothSim::apply_dumps() {
+    if (dumped_) return;
+    dumped_ = true;
+    for (const auto &d : dumps_) {
+        if (dump_bin(d.path.c_str(), d.addr, d.len) == ALIOTHSIM_OK) {
+            std::cout << "aliothsim: dumped 0x" << std::hex << d.addr << std::dec << " to " << d.path
+                      << "\n";
+        } else {
+            std::cerr << "aliothsim: failed to dump " << d.path << "\n";
+        }
+    }
+}
+
+int AliothSim::load_elf(const char *path) {
+    if (elf_version(EV_CURRENT) == EV_NONE) return ALIOTHSIM_ERROR;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "aliothsim: cannot open " << path << "\n";
+        return ALIOTHSIM_ERROR;
+    }
+    Elf *e = elf_begin(fd, ELF_C_READ, nullptr);
+    size_t raw_size = 0;
+    char *raw = e ? elf_rawfile(e, &raw_size) : nullptr;
+    size_t phnum = 0;
+    int ret = ALIOTHSIM_OK;
+    if (!raw || elf_kind(e) != ELF_K_ELF || elf_getphdrnum(e, &phnum) != 0) {
+        std::cerr << "aliothsim: " << path << " is not a valid ELF file\n";
+        ret = ALIOTHSIM_ERROR;
+    }
+    for (size_t i = 0; ret == ALIOTHSIM_OK && i < phnum; i++) {
+        GElf_Phdr ph;
+        if (!gelf_getphdr(e, static_cast<int>(i), &ph)) continue;
+        if (ph.p_type != PT_LOAD || ph.p_memsz == 0) continue;
+        if (ph.p_offset + ph.p_filesz > raw_size) {
+            ret = ALIOTHSIM_ERROR;
+            break;
+        }
+        // .bss等p_memsz超出p_filesz的部分清零
+        std::vector<uint8_t> seg(ph.p_memsz, 0);
+        memcpy(seg.data(), raw + ph.p_offset, ph.p_filesz);
+        if (write_mem(static_cast<uint32_t>(ph.p_paddr), seg.data(), seg.size()) != ALIOTHSIM_OK) {
+            std::cerr << "aliothsim: segment at 0x" << std::hex << ph.p_paddr << std::dec
+                      << " is outside ITCM/DTCM\n";
+            ret = ALIOTHSIM_ERROR;
+        }
+    }
+    if (e) elf_end(e);
+    close(fd);
+    return ret;
+}
+
+void AliothSim::get_counters(aliothsim_counters_t *out) {
+    set_scope();
+    long long mcycle, minstret;
+    tb_counters_read(&mcycle, &minstret);
+    out->cycles = cycles_;
+    out->mcycle = static_cast<uint64_t>(mcycle);
+    out->minstret = static_cast<uint64_t>(minstret);
+    out->pc = static_cast<uint32_t>(tb_pc_read());
+}
+
+// ---------------------------------------------------------------------------
+// C接口
+// ---------------------------------------------------------------------------
+struct alioth_sim {
+    AliothSim impl;
+    alioth_sim(int argc, const char **argv) : impl(argc, argv) {}
+};
+
+extern "C" {
+
+alioth_sim_t *aliothsim_create(int argc, const char **argv) {
+    alioth_sim_t *sim = new alioth_sim(argc, argv);
+    if (!sim->impl.ok()) {
+        delete sim;
+        return nullptr;
+    }
+    return sim;
+}
+
+void aliothsim_destroy(alioth_sim_t *sim) { delete sim; }
+
+void aliothsim_reset(alioth_sim_t *sim, uint32_t cycles) { sim->impl.reset(cycles); }
+
+int aliothsim_load_elf(alioth_sim_t *sim, const char *path) { return sim->impl.load_elf(path); }
+
+int aliothsim_step_cycles(alioth_sim_t *sim, uint64_t n) { return sim->impl.step_cycles(n); }
+
+int aliothsim_run_until_pc(alioth_sim_t *sim, uint32_t pc, uint64_t max_cycles) {
+    return sim->impl.run_until_pc(pc, max_cycles);
+}
+
+uint32_t aliothsim_read_reg(alioth_sim_t *sim, unsigned idx) { return sim->impl.read_reg(idx); }
+
+int aliothsim_read_mem(alioth_sim_t *sim, uint32_t addr, void *buf, size_t len) {
+    return sim->impl.read_mem(addr, buf, len);
+}
+
+int aliothsim_write_mem(alioth_sim_t *sim, uint32_t addr, const void *buf, size_t len) {
+    return sim->impl.write_mem(addr, buf, len);
+}
+
+void aliothsim_get_counters(alioth_sim_t *sim, aliothsim_counters_t *out) {
+    sim->impl.get_counters(out);
+}
+
+int aliothsim_finished(alioth_sim_t *sim) { return sim->impl.finished() ? 1 : 0; }
+
+int aliothsim_mem_view(alioth_sim_t *sim, int region, void **ptr, uint32_t *base, uint32_t *size) {
+    if (region != ALIOTHSIM_ITCM && region != ALIOTHSIM_DTCM && region != ALIOTHSIM_XMEM) {
+        return ALIOTHSIM_ERROR;
+    }
+    TcmSpan span = region == ALIOTHSIM_ITCM   ? sim->impl.itcm()
+                   : region == ALIOTHSIM_DTCM ? sim->impl.dtcm()
+                                              : sim->impl.xmem();
+    *ptr = span.data();
+    *base = span.base;
+    *size = static_cast<uint32_t>(span.size_bytes());
+    return ALIOTHSIM_OK;
+}
+
+int aliothsim_load_bin(alioth_sim_t *sim, const char *path, uint32_t addr) {
+    return sim->impl.load_bin(path, addr);
+}
+
+int aliothsim_dump_bin(alioth_sim_t *sim, const char *path, uint32_t addr, uint32_t len) {
+    return sim->impl.dump_bin(path, addr, len);
+}
+
+}  // extern "C"
@@ -0,0 +1,173 @@
+/*
+ * libaliothsim - 可嵌入的Alioth仿真库C接口
+ *
+ * 将tb_top.cc中的仿真主循环拆分为可复用的库，供测试编排脚本和
+ * 设计空间扫描在同一进程内驱动大量仿真，无需启动make或解析日志横幅。
+ *
+ * 典型用法:
+ *     alioth_sim_t *sim = aliothsim_create(0, NULL);
+ *     aliothsim_load_elf(sim, "rv32ui-p-add");
+ *     aliothsim_reset(sim, 50);
+ *     aliothsim_run_until_pc(sim, 0x80000040, 1000000);
+ *     uint32_t x3 = aliothsim_read_reg(sim, 3);
+ *     aliothsim_destroy(sim);
+ */
+#ifndef ALIOTH_SIM_H
+#define ALIOTH_SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct alioth_sim alioth_sim_t;
+
+// 仿真计数器快照
+typedef struct {
+    uint64_t cycles;    // 复位释放后的仿真时钟周期数(由库统计)
+    uint64_t mcycle;    // CSR cycle/cycleh
+    uint64_t minstret;  // CSR minstret/minstreth
+    uint32_t pc;        // 当前派发级指令地址
+} aliothsim_counters_t;
+
+// step_cycles / run_until_pc 返回状态
+enum {
+    ALIOTHSIM_OK       = 0,   // 达到目标(步数用完或命中PC)
+    ALIOTHSIM_FINISHED = 1,   // 仿真中执行了$finish
+    ALIOTHSIM_TIMEOUT  = 2,   // 超过max_cycles仍未命中目标PC
+    ALIOTHSIM_ERROR    = -1   // 参数错误或访问越界
+};
+
+// 创建仿真实例，argv透传给VerilatedContext::commandArgs(可传入+plusargs)
+// 支持 -t/--trace 打开VCD波形，波形文件为当前目录下的 tb_top.vcd
+// TCM布局与tb_top不符、+*_load=/+*_dump=选项错误或加载失败时返回NULL(原因输出到stderr)
+alioth_sim_t *aliothsim_create(int argc, const char **argv);
+void aliothsim_destroy(alioth_sim_t *sim);
+
+// 以rst_n=0保持cycles个周期后释放复位
+void aliothsim_reset(alioth_sim_t *sim, uint32_t cycles);
+
+// 加载ELF中的PT_LOAD段到ITCM/DTCM/XMEM，返回0成功，<0失败
+int aliothsim_load_elf(alioth_sim_t *sim, const char *path);
+
+// 运行n个时钟周期
+int aliothsim_step_cycles(alioth_sim_t *sim, uint64_t n);
+
+// 运行直到派发级PC等于pc，或超过max_cycles(0表示不限)
+int aliothsim_run_until_pc(alioth_sim_t *sim, uint32_t pc, uint64_t max_cycles);
+
+// 读取通用寄存器 x0-x31
+uint32_t aliothsim_read_reg(alioth_sim_t *sim, unsigned idx);
+
+// 通过后门访问ITCM/DTCM/XMEM，地址为总线地址，返回0成功，<0越界
+int aliothsim_read_mem(alioth_sim_t *sim, uint32_t addr, void *buf, size_t len);
+int aliothsim_write_mem(alioth_sim_t *sim, uint32_t addr, const void *buf, size_t len);
+
+void aliothsim_get_counters(alioth_sim_t *sim, aliothsim_counters_t *out);
+
+// 存储区域编号，XMEM为AXI互联之后的外部存储器
+enum { ALIOTHSIM_ITCM = 0, ALIOTHSIM_DTCM = 1, ALIOTHSIM_XMEM = 2 };
+
+// 零拷贝视图：返回TCM存储阵列的宿主指针(按字小端存放)，可直接memcpy读写
+// base/size为该区域的总线基地址和字节数，返回0成功
+int aliothsim_mem_view(alioth_sim_t *sim, int region, void **ptr, uint32_t *base, uint32_t *size);
+
+// 以二进制文件加载/导出TCM内容，addr为总线地址，len为0时导出到区域末尾
+int aliothsim_load_bin(alioth_sim_t *sim, const char *path, uint32_t addr);
+int aliothsim_dump_bin(alioth_sim_t *sim, const char *path, uint32_t addr, uint32_t len);
+
+// 仿真是否已执行$finish
+int aliothsim_finished(alioth_sim_t *sim);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+#include <vector>
+
+class Vtb_top;
+class VerilatedContext;
+class VerilatedVcdC;
+
+// TCM存储阵列的span风格视图，底层为tb_top经DPI开放数组交出的mem_r
+struct TcmSpan {
+    uint32_t *words;  // mem_r[0]
+    size_t nwords;
+    uint32_t base;    // 总线基地址
+
+    uint32_t *data() const { return words; }
+    size_t size() const { return nwords; }
+    size_t size_bytes() const { return nwords * 4; }
+    uint8_t *bytes() const { return reinterpret_cast<uint8_t *>(words); }
+    uint32_t *begin() const { return words; }
+    uint32_t *end() const { return words + nwords; }
+    uint32_t &operator[](size_t i) const { return words[i]; }
+    bool contains(uint32_t addr, size_t len) const {
+        return words && addr >= base && addr - base + len <= size_bytes();
+    }
+};
+
+// C++侧仿真封装，tb_top.cc的main()与C接口共用
+class AliothSim {
+public:
+    // host_load为真时不要求+itcm_init，由宿主通过load_elf/write_mem加载程序
+    AliothSim(int argc, const char **argv, bool host_load = true);
+    ~AliothSim();
+
+    void half_tick();  // 翻转一次时钟并求值
+    void reset(uint32_t cycles);
+    int step_cycles(uint64_t n);
+    int run_until_pc(uint32_t pc, uint64_t max_cycles);
+    int load_elf(const char *path);
+    uint32_t read_reg(unsigned idx);
+    int read_mem(uint32_t addr, void *buf, size_t len);
+    int write_mem(uint32_t addr, const void *buf, size_t len);
+    void get_counters(aliothsim_counters_t *out);
+    bool finished() const;
+    // 构造是否成功，失败时(TCM布局不符、批量加载选项错误或失败)只允许析构
+    bool ok() const { return ok_; }
+
+    TcmSpan itcm();
+    TcmSpan dtcm();
+    TcmSpan xmem();
+    int load_bin(const char *path, uint32_t addr);
+    int dump_bin(const char *path, uint32_t addr, uint32_t len);
+    // 执行 +dtcm_dump= / +itcm_dump= 指定的结果导出，析构时自动调用
+    void apply_dumps();
+
+    Vtb_top *top() { return top_; }
+    uint64_t tick() const { return tick_; }
+    bool trace_enabled() const { return trace_en_; }
+
+private:
+    // 批量加载/导出请求，格式 file@addr[:len]，addr可为总线地址或区域内偏移
+    struct BinReq {
+        std::string path;
+        uint32_t addr;
+        uint32_t len;
+    };
+
+    void set_scope();
+    // 将总线地址映射到TCM，返回对应视图，越界时返回nullptr
+    const TcmSpan *map_addr(uint32_t addr, size_t len);
+    bool parse_bin_req(const char *arg, const TcmSpan &span, BinReq *req);
+
+    VerilatedContext *ctx_;
+    Vtb_top *top_;
+    VerilatedVcdC *tfp_;
+    bool trace_en_;
+    bool wfi_ff_;  // +wfi_fastforward: 核心WFI休眠等待定时器中断时快进mtime/cycle
+    uint64_t tick_;
+    uint64_t cycles_;
+
+    TcmSpan itcm_, dtcm_, xmem_;
+    std::vector<BinReq> dumps_;
+    bool dumped_;
+    bool ok_;
+    std::string cov_file_;  // 覆盖率构建(VM_COVERAGE)下析构时写出的coverage.dat路径
+};
+#endif
+
+#endif  // ALIOTH_SIM_H
@@ -1,6 +1,8 @@
 #include "Vtb_top.h"
+#include "alioth_sim.h"
 #include "verilated.h"
 #include "verilated_vcd_c.h"
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <queue>
@@ -13,8 +15,6 @@
 #include "jtagServer.h"
 #endif
 
-vluint64_t tick = 0;
-
 #ifdef ENABLE_UART_SIM
 // UART RX仿真相关变量
 std::queue<uint8_t> uart_rx_queue;
@@ -54,20 +54,15 @@ void uart_input_thread() {
 #endif // ENABLE_UART_SIM
 
 int main(int argc, char **argv) {
-    Verilated::commandArgs(argc, argv);
-    Vtb_top *soc = new Vtb_top;
-
-    // check if trace is enabled
-    int trace_en = 0;
-    for (int i = 0; i < argc; i++)
+    // 仿真控制统一由AliothSim(libaliothsim)完成，此处仅保留UART/JTAG交互
+    AliothSim sim(argc - 1, const_cast<const char **>(argv + 1), false);
+    if (!sim.ok())
     {
-        if (strcmp(argv[i], "-t") == 0)
-            trace_en = 1;
-        if (strcmp(argv[i], "--trace") == 0)
-            trace_en = 1;
+        return EXIT_FAILURE;
     }
+    Vtb_top *soc = sim.top();
 
-    if (trace_en)
+    if (sim.trace_enabled())
     {
         std::cout << "Trace is enabled.\n";
     }
@@ -79,49 +74,13 @@ int main(int argc, char **argv) {
         VerilatorJtagServer* jtag = new VerilatorJtagServer(10);
         jtag->init_jtag_server(5555, false);
     #endif
-    //enable waveform
-    VerilatedVcdC* tfp = new VerilatedVcdC;
-    if (trace_en)
-    {
-        Verilated::traceEverOn(true);
-        soc->trace(tfp, 99); // Trace 99 levels of hierarchy
-        tfp->open("tb_top.vcd");
-    }
-
-    soc->clk = 0;
-    soc->rst_n = 0;
-    soc->eval();
-    // 修改为：仅当dump_en为1时才dump
-    if (trace_en && soc->dump_en) tfp->dump(tick); tick++;
 
     // enough time to reset
-    for (int i = 0; i < 100; i++)
-    {
-        soc->clk = !soc->clk;
-        soc->eval();
-        if (trace_en && soc->dump_en)
-        {
-            tfp->dump(tick);
-            tick++;
-            tfp->dump(tick); // 第二次时间尺度更新
-            tick++;
-        }
-    }
-
-    soc->rst_n = 1;
-    soc->eval();
+    sim.reset(50);
 
     for (int i = 0; i < 50000; i++)
     {
-        soc->clk = !soc->clk;
-        soc->eval();
-        if (trace_en && soc->dump_en)
-        {
-            tfp->dump(tick);
-            tick++;
-            tfp->dump(tick); // 第二次时间尺度更新
-            tick++;
-        }
+        sim.half_tick();
     }
 
 #ifdef ENABLE_UART_SIM
@@ -132,10 +91,9 @@ int main(int argc, char **argv) {
     bool prev_clk = soc->clk;
 #endif
 
-    while (!Verilated::gotFinish())
+    while (!sim.finished())
     {
-        soc->clk = !soc->clk;
-        soc->eval();
+        sim.half_tick();
 
 #ifdef ENABLE_UART_SIM
         // 仅在时钟上升沿处理UART RX
@@ -178,26 +136,13 @@ int main(int argc, char **argv) {
 #endif // ENABLE_UART_SIM
 
 #ifdef JTAGVPI
-        jtag->doJTAG(tick, &soc->tms_i, &soc->tdi_i, &soc->tck_i, soc->tdo_o);
+        jtag->doJTAG(sim.tick(), &soc->tms_i, &soc->tdi_i, &soc->tck_i, soc->tdo_o);
 #endif
-        if (trace_en && soc->dump_en)
-        {
-            tfp->dump(tick);
-            tick++;
-            tfp->dump(tick); // 第二次时间尺度更新
-            tick++;
-        }
     }
 
 #ifdef ENABLE_UART_SIM
     uart_thread.detach(); // 或 join，视情况而定
 #endif
 
-    if (trace_en)
-    {
-        tfp->close();
-    }
-    delete soc;
-
     return 0;
 }
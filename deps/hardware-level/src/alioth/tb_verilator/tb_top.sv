@@ -21,6 +21,7 @@
 
 `define ITCM alioth_soc_top_0.u_imem.ram_inst
 `define DTCM alioth_soc_top_0.u_dmem.ram_inst
+`define XMEM alioth_soc_top_0.u_xmem.ram_inst
 
 // 支持dump使能区间
 parameter DUMP_START_CYCLE = 133262798;
@@ -56,6 +57,7 @@ module tb_top (
 
     integer r;
     reg [8*300:1] testcase;
+    reg host_load = 1'b0;
     integer dumpwave;
 
     // 计算ITCM和DTCM的深度和字节大小
@@ -73,6 +75,120 @@ module tb_top (
     wire    [31:0] current_cycle = csr_cyclel[31:0];
     wire    [31:0] current_cycleh = csr_cycleh[31:0];
 
+    // 分支预测统计: 执行的分支数、误预测数(含分发级提前纠正的)、IFU内部重定向数、
+    // 分发级提前纠正数，以及误预测的分支离开执行级后执行级空闲直至正确路径指令到达的周期数
+    reg     [31:0] bpu_branch_cnt;
+    reg     [31:0] bpu_mispred_cnt;
+    reg     [31:0] bpu_redirect_cnt;
+    reg     [31:0] bpu_early_cnt;
+    reg     [31:0] bpu_penalty_cnt;
+    reg            bpu_early_d;  // 提前纠正的分支下一拍位于执行级
+    reg            bpu_penalty_wait;
+    wire bpu_upd_valid = alioth_soc_top_0.u_cpu_top.bpu_upd_valid;
+    wire bpu_ex_mispred = bpu_upd_valid & alioth_soc_top_0.u_cpu_top.u_exu.bru_jump_flag;
+    wire bpu_early = alioth_soc_top_0.u_cpu_top.u_ctrl.early_jump;
+    wire bpu_mispred = bpu_ex_mispred | bpu_early;
+    wire bpu_redirect = alioth_soc_top_0.u_cpu_top.u_ifu.branch_taken;
+    wire ex_inst_valid = alioth_soc_top_0.u_cpu_top.dispatch_inst_valid_o;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            bpu_branch_cnt   <= 32'b0;
+            bpu_mispred_cnt  <= 32'b0;
+            bpu_redirect_cnt <= 32'b0;
+            bpu_early_cnt    <= 32'b0;
+            bpu_penalty_cnt  <= 32'b0;
+            bpu_early_d      <= 1'b0;
+            bpu_penalty_wait <= 1'b0;
+        end else begin
+            if (bpu_upd_valid) bpu_branch_cnt <= bpu_branch_cnt + 1'b1;
+            if (bpu_mispred) bpu_mispred_cnt <= bpu_mispred_cnt + 1'b1;
+            if (bpu_redirect) bpu_redirect_cnt <= bpu_redirect_cnt + 1'b1;
+            if (bpu_early) bpu_early_cnt <= bpu_early_cnt + 1'b1;
+            bpu_early_d <= bpu_early;
+            if (bpu_ex_mispred || bpu_early_d) bpu_penalty_wait <= 1'b1;
+            else if (ex_inst_valid) bpu_penalty_wait <= 1'b0;
+            if (bpu_penalty_wait && !ex_inst_valid) bpu_penalty_cnt <= bpu_penalty_cnt + 1'b1;
+        end
+    end
+
+    // 访存统计: load写回数、因load-use冒险暂停的周期数
+    reg     [31:0] lsu_load_cnt;
+    reg     [31:0] lsu_load_use_cnt;
+    wire lsu_load_wb = alioth_soc_top_0.u_cpu_top.exu_lsu_reg_we_o;
+    wire lsu_load_use = alioth_soc_top_0.u_cpu_top.u_dispatch.u_hdu.load_use_stall;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            lsu_load_cnt     <= 32'b0;
+            lsu_load_use_cnt <= 32'b0;
+        end else begin
+            if (lsu_load_wb) lsu_load_cnt <= lsu_load_cnt + 1'b1;
+            if (lsu_load_use) lsu_load_use_cnt <= lsu_load_use_cnt + 1'b1;
+        end
+    end
+
+    // 记分板/写回统计: RAW/WAW冒险暂停周期、记分板满暂停周期、写回缓冲满反压周期
+    reg  [31:0] hdu_hazard_cnt;
+    reg  [31:0] hdu_full_cnt;
+    reg  [31:0] wbu_full_cnt;
+    wire        hdu_hazard = alioth_soc_top_0.u_cpu_top.u_dispatch.u_hdu.hazard;
+    wire        hdu_full = alioth_soc_top_0.u_cpu_top.u_dispatch.u_hdu.sb_full_stall;
+    wire        wbu_full = !alioth_soc_top_0.u_cpu_top.wbu_alu_ready_o ||
+                           !alioth_soc_top_0.u_cpu_top.wbu_mul_ready_o ||
+                           !alioth_soc_top_0.u_cpu_top.wbu_div_ready_o ||
+                           !alioth_soc_top_0.u_cpu_top.wbu_csr_ready_o;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            hdu_hazard_cnt <= 32'b0;
+            hdu_full_cnt   <= 32'b0;
+            wbu_full_cnt   <= 32'b0;
+        end else begin
+            if (hdu_hazard) hdu_hazard_cnt <= hdu_hazard_cnt + 1'b1;
+            if (hdu_full) hdu_full_cnt <= hdu_full_cnt + 1'b1;
+            if (wbu_full) wbu_full_cnt <= wbu_full_cnt + 1'b1;
+        end
+    end
+
+    // 双发射/指令融合统计: 成对执行的指令对数、融合执行的指令数
+    reg  [31:0] dual_pair_cnt;
+    reg  [31:0] fused_op_cnt;
+    wire        exu_advance = !alioth_soc_top_0.u_cpu_top.exu_stall_flag_o;
+    wire        dual_pair_exec = alioth_soc_top_0.u_cpu_top.dispatch_dual_valid_o && exu_advance;
+    wire        fused_op_exec = alioth_soc_top_0.u_cpu_top.dispatch_fused_o && exu_advance;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            dual_pair_cnt <= 32'b0;
+            fused_op_cnt  <= 32'b0;
+        end else begin
+            if (dual_pair_exec) dual_pair_cnt <= dual_pair_cnt + 1'b1;
+            if (fused_op_exec) fused_op_cnt <= fused_op_cnt + 1'b1;
+        end
+    end
+
+    // WFI休眠统计: 休眠周期数(实际仿真的时钟)、经宿主快进跳过的周期数
+    reg  [31:0] wfi_sleep_cnt;
+    reg  [63:0] wfi_skip_cnt = 64'd0;
+    wire        wfi_sleep = alioth_soc_top_0.u_cpu_top.clint_sleep_o;
+    // 宿主请求的快进周期数，下一个时钟沿送入mtime/cycle计数器的仿真跳步口后清零
+    reg  [31:0] wfi_skip_req = 32'd0;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            wfi_sleep_cnt <= 32'b0;
+        end else if (wfi_sleep) begin
+            wfi_sleep_cnt <= wfi_sleep_cnt + 1'b1;
+        end
+    end
+
+    always @(posedge clk) begin
+        alioth_soc_top_0.u_cpu_top.u_clint.u_clint_swi.sim_time_skip <= wfi_skip_req;
+        alioth_soc_top_0.u_cpu_top.u_csr.sim_cycle_skip <= wfi_skip_req;
+        wfi_skip_req = 32'd0;
+    end
+
 `ifdef ENABLE_DUMP_EN
     reg dump_en_reg;
     assign dump_en = dump_en_reg;
@@ -156,7 +272,10 @@ module tb_top (
             pc_stuck_cnt <= 8'b0;
         end else begin
             // PC stuck detection: if PC does not change for 100 cycles, terminate simulation
-            if (pc == pc_last) begin
+            // WFI休眠期间ID级暂停、PC保持不变属正常等待，不计入卡死计数
+            if (wfi_sleep) begin
+                pc_stuck_cnt <= 8'b0;
+            end else if (pc == pc_last) begin
                 pc_stuck_cnt <= pc_stuck_cnt + 1'b1;
             end else begin
                 pc_stuck_cnt <= 8'b0;
@@ -178,51 +297,57 @@ module tb_top (
             // 只输出有效的testcase内容
             display_testcase_name();
             $display("");
+        end else if ($test$plusargs("host_load")) begin
+            // 仿真库模式：程序由宿主通过后门接口加载
+            host_load = 1'b1;
+            $display("No itcm_init defined, waiting for host to load memory");
         end else begin
             $display("No itcm_init defined!");
             $finish;
         end
 
-        // 初始化内存数组
-        for (i = 0; i < ITCM_BYTE_SIZE; i = i + 1) begin
-            itcm_prog_mem[i] = 8'h00;
-        end
-        for (i = 0; i < DTCM_BYTE_SIZE; i = i + 1) begin
-            dtcm_prog_mem[i] = 8'h00;
-        end
+        if (!host_load) begin
+            // 初始化内存数组
+            for (i = 0; i < ITCM_BYTE_SIZE; i = i + 1) begin
+                itcm_prog_mem[i] = 8'h00;
+            end
+            for (i = 0; i < DTCM_BYTE_SIZE; i = i + 1) begin
+                dtcm_prog_mem[i] = 8'h00;
+            end
 
-        // 从分割后的.verilog文件中读取字节数据
-        $readmemh({testcase, "_itcm.verilog"}, itcm_prog_mem);
-        $readmemh({testcase, "_dtcm.verilog"}, dtcm_prog_mem);
-
-        // 处理小端序格式并更新到ITCM
-        for (i = 0; i < ITCM_DEPTH; i = i + 1) begin  // 遍历ITCM的每个字
-            `ITCM.mem_r[i] = {
-                itcm_prog_mem[i*4+3],
-                itcm_prog_mem[i*4+2],
-                itcm_prog_mem[i*4+1],
-                itcm_prog_mem[i*4+0]
-            };
-        end
+            // 从分割后的.verilog文件中读取字节数据
+            $readmemh({testcase, "_itcm.verilog"}, itcm_prog_mem);
+            $readmemh({testcase, "_dtcm.verilog"}, dtcm_prog_mem);
+
+            // 处理小端序格式并更新到ITCM
+            for (i = 0; i < ITCM_DEPTH; i = i + 1) begin  // 遍历ITCM的每个字
+                `ITCM.mem_r[i] = {
+                    itcm_prog_mem[i*4+3],
+                    itcm_prog_mem[i*4+2],
+                    itcm_prog_mem[i*4+1],
+                    itcm_prog_mem[i*4+0]
+                };
+            end
 
-        // 处理小端序格式并更新到DTCM
-        for (i = 0; i < DTCM_DEPTH; i = i + 1) begin  // 遍历DTCM的每个字
-            `DTCM.mem_r[i] = {
-                dtcm_prog_mem[i*4+3],
-                dtcm_prog_mem[i*4+2],
-                dtcm_prog_mem[i*4+1],
-                dtcm_prog_mem[i*4+0]
-            };
-        end
+            // 处理小端序格式并更新到DTCM
+            for (i = 0; i < DTCM_DEPTH; i = i + 1) begin  // 遍历DTCM的每个字
+                `DTCM.mem_r[i] = {
+                    dtcm_prog_mem[i*4+3],
+                    dtcm_prog_mem[i*4+2],
+                    dtcm_prog_mem[i*4+1],
+                    dtcm_prog_mem[i*4+0]
+                };
+            end
 
-        $display("Successfully loaded instructions to ITCM and data to DTCM");
-        $display("ITCM 0x00: %h", `ITCM.mem_r[0]);
-        $display("ITCM 0x01: %h", `ITCM.mem_r[1]);
-        $display("ITCM 0x02: %h", `ITCM.mem_r[2]);
-        $display("ITCM 0x03: %h", `ITCM.mem_r[3]);
-        $display("ITCM 0x04: %h", `ITCM.mem_r[4]);
-        $display("DTCM 0x00: %h", `DTCM.mem_r[0]);
-        $display("DTCM 0x01: %h", `DTCM.mem_r[1]);
+            $display("Successfully loaded instructions to ITCM and data to DTCM");
+            $display("ITCM 0x00: %h", `ITCM.mem_r[0]);
+            $display("ITCM 0x01: %h", `ITCM.mem_r[1]);
+            $display("ITCM 0x02: %h", `ITCM.mem_r[2]);
+            $display("ITCM 0x03: %h", `ITCM.mem_r[3]);
+            $display("ITCM 0x04: %h", `ITCM.mem_r[4]);
+            $display("DTCM 0x00: %h", `DTCM.mem_r[0]);
+            $display("DTCM 0x01: %h", `DTCM.mem_r[1]);
+        end
     end
 
 `ifdef ENABLE_PC_WRITE_TOHOST
@@ -248,6 +373,39 @@ module tb_top (
             $display("~~~~~~~~~~Total instructions executed: %d ~~~~~~~~~~~~~",
                      current_instructions);
             $display("~~~~~~~~~~~~~~~~~~ IPC value: %.4f ~~~~~~~~~~~~~~~~~~", ipc);
+            $display("~~~~~~~~~~~~~BPU_METRIC: BRANCHES=%0d MISPREDICTS=%0d IF_REDIRECTS=%0d EARLY_RESOLVED=%0d PENALTY_CYCLES=%0d",
+                     bpu_branch_cnt, bpu_mispred_cnt, bpu_redirect_cnt, bpu_early_cnt,
+                     bpu_penalty_cnt);
+            $display("~~~~~~~~~~~~~ICACHE_METRIC: HITS=%0d MISSES=%0d",
+                     alioth_soc_top_0.u_cpu_top.u_ifu.icache_hit_cnt,
+                     alioth_soc_top_0.u_cpu_top.u_ifu.icache_miss_cnt);
+            $display("~~~~~~~~~~~~~LSU_METRIC: LOADS=%0d LOAD_USE_STALLS=%0d MISALIGNED_LOADS=%0d MISALIGNED_STORES=%0d",
+                     lsu_load_cnt, lsu_load_use_cnt,
+                     alioth_soc_top_0.u_cpu_top.u_exu.u_lsu_lsu.ma_load_cnt,
+                     alioth_soc_top_0.u_cpu_top.u_exu.u_lsu_lsu.ma_store_cnt);
+            $display("~~~~~~~~~~~~~HDU_METRIC: HAZARD_STALLS=%0d SB_FULL_STALLS=%0d WB_FULL_CYCLES=%0d",
+                     hdu_hazard_cnt, hdu_full_cnt, wbu_full_cnt);
+            $display("~~~~~~~~~~~~~WBU_METRIC: ALU_LOST=%0d MUL_LOST=%0d DIV_LOST=%0d CSR_LOST=%0d",
+                     alioth_soc_top_0.u_cpu_top.u_wbu.alu_lost_cnt,
+                     alioth_soc_top_0.u_cpu_top.u_wbu.mul_lost_cnt,
+                     alioth_soc_top_0.u_cpu_top.u_wbu.div_lost_cnt,
+                     alioth_soc_top_0.u_cpu_top.u_wbu.csr_lost_cnt);
+            $display("~~~~~~~~~~~~~DUAL_METRIC: PAIRS=%0d", dual_pair_cnt);
+            $display("~~~~~~~~~~~~~FUSION_METRIC: FUSED=%0d", fused_op_cnt);
+            $display("~~~~~~~~~~~~~IRQ_METRIC: FAST_ENTRIES=%0d",
+                     alioth_soc_top_0.u_cpu_top.u_clint.fast_irq_cnt);
+            $display("~~~~~~~~~~~~~AXI_METRIC: ITCM=%0d DTCM=%0d APB=%0d CLINT=%0d PLIC=%0d DM=%0d XMEM=%0d DUAL_R=%0d AR_CONFLICTS=%0d",
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[0],
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[1],
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[2],
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[3],
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[4],
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[5],
+                     alioth_soc_top_0.u_axi_interconnect.slv_beat_cnt[6],
+                     alioth_soc_top_0.u_axi_interconnect.dual_r_cnt,
+                     alioth_soc_top_0.u_axi_interconnect.ar_conflict_cnt);
+            $display("~~~~~~~~~~~~~WFI_METRIC: SLEEP_CYCLES=%0d SKIPPED_CYCLES=%0d", wfi_sleep_cnt,
+                     wfi_skip_cnt);
             $display("~~~~~~~~~~~~~~~The final x3 Reg value: %d ~~~~~~~~~~~~~", x3);
             $display("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~");
 
@@ -283,6 +441,216 @@ module tb_top (
     end
 `endif
 
+    // ------------------------------------------------------------------
+    // 随机中断注入器 - 用于中断压力测试和ISR入口延迟回归
+    // +irq_inject_period=N   平均每N个周期注入一次(为0或未指定时关闭)
+    // +irq_inject_seed=S     随机种子，相同种子与程序下注入序列完全一致
+    // +irq_inject_mask=M     注入目标，bit[10:0]为PLIC中断源，bit[11]为CLINT软件中断
+    // +irq_inject_timeout=T  注入后T个周期未进入处理程序则撤销并计为丢弃
+    // +irq_inject_log=F      逐条记录延迟(CSV)，延迟为注入到处理程序首条指令派发的周期数
+    // ------------------------------------------------------------------
+    localparam IRQI_SWI = `PLIC_NUM_SOURCES;  // 目标编号: 0~10为PLIC源，11为软件中断
+
+    localparam IRQI_IDLE = 2'd0, IRQI_WAIT_TRAP = 2'd1, IRQI_WAIT_ENTRY = 2'd2;
+
+    wire        irqi_trap = alioth_soc_top_0.u_cpu_top.u_clint.int_jump_o &
+                            ~alioth_soc_top_0.u_cpu_top.u_clint.mret_req;
+    wire [31:0] irqi_cause = alioth_soc_top_0.u_cpu_top.u_clint.cause;
+    wire [31:0] irqi_trap_addr = alioth_soc_top_0.u_cpu_top.u_clint.int_addr_o;
+    wire        irqi_dis_valid = alioth_soc_top_0.u_cpu_top.u_dispatch.pipe_inst_valid_o;
+
+    integer        irqi_period = 0;
+    integer        irqi_timeout = 100000;
+    integer        irqi_fd = 0;
+    reg     [31:0] irqi_mask = {1'b1, {`PLIC_NUM_SOURCES{1'b1}}};
+    reg     [31:0] irqi_rng = 32'd1;
+    reg     [ 1:0] irqi_state = IRQI_IDLE;
+    reg     [ 4:0] irqi_tgt;
+    reg     [63:0] irqi_cnt = 64'd0;
+    reg     [63:0] irqi_assert_cyc;
+    reg     [31:0] irqi_handler;
+    reg     [63:0] irqi_lat;
+    // 统计
+    reg     [63:0] irqi_num = 64'd0;
+    reg     [63:0] irqi_drop = 64'd0;
+    reg     [63:0] irqi_lat_sum = 64'd0;
+    reg     [63:0] irqi_lat_min = 64'hFFFF_FFFF_FFFF_FFFF;
+    reg     [63:0] irqi_lat_max = 64'd0;
+    reg     [8*256:1] irqi_logfile;
+
+    function automatic [31:0] irqi_xorshift(input [31:0] x);
+        x = x ^ (x << 13);
+        x = x ^ (x >> 17);
+        x = x ^ (x << 5);
+        return x;
+    endfunction
+
+    // 从随机起点开始选取第一个被mask允许的目标
+    function automatic [4:0] irqi_pick(input [31:0] r, input [31:0] mask);
+        integer k;
+        reg [4:0] t;
+        t = 5'(r % (IRQI_SWI + 1));
+        for (k = 0; k <= IRQI_SWI; k = k + 1) begin
+            if (mask[t]) return t;
+            t = (t == IRQI_SWI) ? 5'd0 : t + 5'd1;
+        end
+        return t;
+    endfunction
+
+    task automatic irqi_set(input [4:0] tgt, input val);
+        if (tgt == IRQI_SWI) alioth_soc_top_0.u_cpu_top.u_clint.sim_swi_inject <= val;
+        else alioth_soc_top_0.u_cpu_top.sim_irq_inject[tgt] <= val;
+    endtask
+
+    initial begin
+        if ($value$plusargs("irq_inject_period=%d", irqi_period) && irqi_period > 0) begin
+            if (!$value$plusargs("irq_inject_seed=%d", irqi_rng)) irqi_rng = 32'd1;
+            if (irqi_rng == 32'd0) irqi_rng = 32'hA5A5_5A5A;  // xorshift种子不能为0
+            void'($value$plusargs("irq_inject_mask=%h", irqi_mask));
+            void'($value$plusargs("irq_inject_timeout=%d", irqi_timeout));
+            if ($value$plusargs("irq_inject_log=%s", irqi_logfile)) begin
+                irqi_fd = $fopen(irqi_logfile, "w");
+                if (irqi_fd != 0) $fdisplay(irqi_fd, "seq,target,assert_cycle,entry_cycle,latency");
+            end
+            $display("IRQ inject: period=%0d seed=%0d mask=0x%03x timeout=%0d", irqi_period,
+                     irqi_rng, irqi_mask[IRQI_SWI:0], irqi_timeout);
+        end
+    end
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            irqi_state <= IRQI_IDLE;
+            irqi_cnt   <= 64'd0;
+        end else if (irqi_period > 0 && irqi_mask[IRQI_SWI:0] != 0) begin
+            irqi_cnt <= irqi_cnt + 64'd1;
+            irqi_rng = irqi_xorshift(irqi_rng);
+            case (irqi_state)
+                IRQI_IDLE: begin
+                    if (irqi_rng % irqi_period == 0) begin
+                        irqi_tgt = irqi_pick(irqi_xorshift(irqi_rng), irqi_mask);
+                        irqi_set(irqi_tgt, 1'b1);
+                        irqi_assert_cyc <= irqi_cnt;
+                        irqi_state      <= IRQI_WAIT_TRAP;
+                    end
+                end
+                IRQI_WAIT_TRAP: begin
+                    // 仅当异常原因与注入目标类型一致时才认为是本次注入触发的中断
+                    if (irqi_trap && irqi_cause == ((irqi_tgt == IRQI_SWI) ? 32'h8000_0003 :
+                                                                             32'h8000_000B)) begin
+                        irqi_set(irqi_tgt, 1'b0);
+                        irqi_handler <= irqi_trap_addr;
+                        irqi_state   <= IRQI_WAIT_ENTRY;
+                    end else if (irqi_cnt - irqi_assert_cyc > 64'(irqi_timeout)) begin
+                        // 中断被屏蔽或未使能，撤销注入
+                        irqi_set(irqi_tgt, 1'b0);
+                        irqi_drop  <= irqi_drop + 64'd1;
+                        irqi_state <= IRQI_IDLE;
+                    end
+                end
+                IRQI_WAIT_ENTRY: begin
+                    if (irqi_dis_valid && pc == irqi_handler) begin
+                        irqi_lat = irqi_cnt - irqi_assert_cyc;
+                        irqi_num     <= irqi_num + 64'd1;
+                        irqi_lat_sum <= irqi_lat_sum + irqi_lat;
+                        if (irqi_lat < irqi_lat_min) irqi_lat_min <= irqi_lat;
+                        if (irqi_lat > irqi_lat_max) irqi_lat_max <= irqi_lat;
+                        if (irqi_fd != 0) begin
+                            if (irqi_tgt == IRQI_SWI)
+                                $fdisplay(irqi_fd, "%0d,swi,%0d,%0d,%0d", irqi_num, irqi_assert_cyc,
+                                          irqi_cnt, irqi_lat);
+                            else
+                                $fdisplay(irqi_fd, "%0d,plic%0d,%0d,%0d,%0d", irqi_num, irqi_tgt,
+                                          irqi_assert_cyc, irqi_cnt, irqi_lat);
+                        end
+                        irqi_state <= IRQI_IDLE;
+                    end else if (irqi_cnt - irqi_assert_cyc > 64'(irqi_timeout)) begin
+                        irqi_drop  <= irqi_drop + 64'd1;
+                        irqi_state <= IRQI_IDLE;
+                    end
+                end
+                default: irqi_state <= IRQI_IDLE;
+            endcase
+        end
+    end
+
+    final begin
+        if (irqi_period > 0) begin
+            if (irqi_num != 0)
+                $display("IRQ_LATENCY: COUNT=%0d DROPPED=%0d MIN=%0d MAX=%0d AVG=%.2f", irqi_num,
+                         irqi_drop, irqi_lat_min, irqi_lat_max, real'(irqi_lat_sum) / irqi_num);
+            else $display("IRQ_LATENCY: COUNT=0 DROPPED=%0d", irqi_drop);
+            if (irqi_fd != 0) $fclose(irqi_fd);
+        end
+    end
+
+    // 仿真库(libaliothsim)使用的DPI后门接口，TCM存储阵列经tb_mem_bind以开放数组交给宿主直接读写
+    import "DPI-C" function void aliothsim_mem_bind(input int region, inout logic [31:0] mem[]);
+    export "DPI-C" function tb_mem_bind;
+    export "DPI-C" function tb_mem_layout;
+    export "DPI-C" function tb_xmem_layout;
+    export "DPI-C" function tb_gpr_read;
+    export "DPI-C" function tb_pc_read;
+    export "DPI-C" function tb_counters_read;
+    export "DPI-C" function tb_wfi_fastforward;
+
+    // region编号与alioth_sim.h中的ALIOTHSIM_ITCM/DTCM/XMEM一致
+    function void tb_mem_bind();
+        aliothsim_mem_bind(0, `ITCM.mem_r);
+        aliothsim_mem_bind(1, `DTCM.mem_r);
+`ifdef ENABLE_XMEM
+        aliothsim_mem_bind(2, `XMEM.mem_r);
+`endif
+    endfunction
+
+    function void tb_mem_layout(output int itcm_base, output int itcm_size, output int dtcm_base,
+                                output int dtcm_size);
+        itcm_base = `ITCM_BASE_ADDR;
+        itcm_size = ITCM_BYTE_SIZE;
+        dtcm_base = `DTCM_BASE_ADDR;
+        dtcm_size = DTCM_BYTE_SIZE;
+    endfunction
+
+    function void tb_xmem_layout(output int xmem_base, output int xmem_size);
+        xmem_base = `XMEM_BASE_ADDR;
+`ifdef ENABLE_XMEM
+        xmem_size = `XMEM_SIZE;
+`else
+        xmem_size = 0;
+`endif
+    endfunction
+
+    function int tb_gpr_read(input int idx);
+        return alioth_soc_top_0.u_cpu_top.u_gpr.regs[idx[4:0]];
+    endfunction
+
+    function int tb_pc_read();
+        return pc;
+    endfunction
+
+    function void tb_counters_read(output longint mcycle, output longint minstret);
+        mcycle   = {csr_cycleh, csr_cyclel};
+        minstret = {alioth_soc_top_0.u_cpu_top.u_csr.minstreth, csr_instret};
+    endfunction
+
+    // 核心WFI休眠且已使能定时器中断时，请求把mtime/cycle直接推进到mtimecmp前若干拍，
+    // 返回跳过的周期数(0表示本拍不快进)；外设定时器、UART等不随之推进
+    function int tb_wfi_fastforward();
+        longint unsigned mtime, mtimecmp, gap;
+        if (!wfi_sleep || wfi_skip_req != 0) return 0;
+        if (!alioth_soc_top_0.u_cpu_top.csr_clint_csr_mie[7]) return 0;
+        mtime = {alioth_soc_top_0.u_cpu_top.u_clint.u_clint_swi.mtime_hi,
+                 alioth_soc_top_0.u_cpu_top.u_clint.u_clint_swi.mtime_lo};
+        mtimecmp = {alioth_soc_top_0.u_cpu_top.u_clint.u_clint_swi.mtimecmp_hi,
+                    alioth_soc_top_0.u_cpu_top.u_clint.u_clint_swi.mtimecmp_lo};
+        if (mtimecmp <= mtime + 64'd16) return 0;
+        // 请求在下一个时钟沿才生效，留出余量保证定时器中断仍在仿真的时钟内触发
+        gap = mtimecmp - mtime - 64'd8;
+        if (gap > 64'h7FFF_FFFF) gap = 64'h7FFF_FFFF;
+        wfi_skip_req = gap[31:0];
+        wfi_skip_cnt = wfi_skip_cnt + gap;
+        return int'(gap[31:0]);
+    endfunction
+
     // 添加一个任务来显示处理过的testcase名称
     task automatic display_testcase_name;
         integer       i;
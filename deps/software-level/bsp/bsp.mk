@@ -4,7 +4,8 @@ endif
 
 include $(SIM_ROOT_DIR)/make.conf
 
-BIN_TO_MEM    := $(BSP_DIR)/../../tools/BinToMem.py
+# ELF转换/反汇编工具，与顶层Makefile的elf2mem目标共用同一可执行文件
+ELF2MEM := $(SIM_ROOT_DIR)/build/tools/elf2mem
 
 BUILD_DIR ?= .
 
@@ -29,7 +30,7 @@ LINK_DEPS := $(LINKER_SCRIPT)
 
 TARGET ?= ${BUILD_DIR}/main.elf
 
-CLEAN_OBJS += $(TARGET) $(LINK_OBJS) ${BUILD_DIR}/main.dump ${BUILD_DIR}/main.bin ${BUILD_DIR}/main.hex ${BUILD_DIR}/main.mem
+CLEAN_OBJS += $(TARGET) $(LINK_OBJS) ${BUILD_DIR}/main.dump ${BUILD_DIR}/main.bin ${BUILD_DIR}/main.hex ${BUILD_DIR}/main.mem ${BUILD_DIR}/main_disasm_annotated.asm
 
 CFLAGS += --sysroot=$(RISCV_GCC_ROOT)/riscv64-unknown-elf
 CFLAGS += -march=$(DEFAULT_RISCV_ARCH)
@@ -52,15 +53,20 @@ LDFLAGS += -L$(RISCV_GCC_ROOT)/lib/gcc/riscv64-unknown-elf/12.2.0/rv32im/ilp32
 .PHONY: all
 all: $(TARGET)
 
-$(TARGET): $(LINK_OBJS) $(LINK_DEPS) Makefile
+$(TARGET): $(LINK_OBJS) $(LINK_DEPS) Makefile | $(ELF2MEM)
 	$(CC) $(CFLAGS) $(INCLUDES) $(LINK_OBJS) -o $@ $(LDFLAGS) -lc -lgcc
 	$(OBJCOPY) -O binary $@ ${BUILD_DIR}/main.bin
 	$(OBJDUMP) -d $@ > ${BUILD_DIR}/main.dump
+	$(ELF2MEM) -o ${BUILD_DIR}/main --mem --asm $@
 	$(OBJCOPY) -O verilog $@ ${BUILD_DIR}/main.verilog
 	@if [ -n "$${SIM_ROOT_DIR}" ]; then \
 		${SIM_ROOT_DIR}/deps/tools/split_memory.sh ${BUILD_DIR}/main.verilog; \
 	fi
 
+$(ELF2MEM): $(SIM_ROOT_DIR)/deps/tools/elf2mem.cc
+	@mkdir -p $(dir $@)
+	g++ -std=c++17 -O2 -o $@ $<
+
 ${BUILD_DIR}/%.o: $(BSP_DIR)/%.S
 	$(CC) $(CFLAGS) $(INCLUDES) -c -o $@ $<
 
@@ -36,5 +36,6 @@ void plic_set_handler(uint8_t irq_id, void (*handler)(void *), void *arg);
 void plic_init(void);
 void plic_default_handler(void *arg);
 void plic_dispatch(void);
+void plic_fast_irq_enable(void);
 
 #endif // __PLIC_H__
@@ -40,6 +40,16 @@ void plic_init(void) {
     }
 }
 
+// 开启快速中断：外部中断由硬件直接调用plic_set_handler注册的处理函数(参数经a0传入)，
+// 调用者保存寄存器由硬件影子组保护，处理函数返回至fast_irq_return执行mret；
+// 其他陷入仍进入trap_entry
+void plic_fast_irq_enable(void) {
+    extern void trap_entry(void);
+    extern void fast_irq_return(void);
+    write_csr(0x7c0, (uint32_t)fast_irq_return); // mfiret
+    write_csr(mtvec, (uint32_t)trap_entry | 0x3);
+}
+
 void plic_dispatch(void) {
     void (*handler)(void *);
     void *arg;
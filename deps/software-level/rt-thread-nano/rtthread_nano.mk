@@ -8,7 +8,8 @@ RT_THREAD_ROOT := $(SIM_ROOT_DIR)/deps/software-level/rt-thread-nano
 
 BSP_DIR := $(SIM_ROOT_DIR)/deps/software-level/bsp
 BUILD_DIR ?= .
-BIN_TO_MEM := $(BSP_DIR)/../../tools/BinToMem.py
+# ELF转换/反汇编工具，与顶层Makefile的elf2mem目标共用同一可执行文件
+ELF2MEM := $(SIM_ROOT_DIR)/build/tools/elf2mem
 
 # 自动搜索汇编和C源文件
 ASM_SRCS := $(wildcard $(BSP_DIR)/*.S)
@@ -37,7 +38,7 @@ LINK_DEPS := $(LINKER_SCRIPT)
 
 TARGET ?= ${BUILD_DIR}/main.elf
 
-CLEAN_OBJS += $(TARGET) $(LINK_OBJS) ${BUILD_DIR}/main.dump ${BUILD_DIR}/main.bin ${BUILD_DIR}/main.hex ${BUILD_DIR}/main.mem
+CLEAN_OBJS += $(TARGET) $(LINK_OBJS) ${BUILD_DIR}/main.dump ${BUILD_DIR}/main.bin ${BUILD_DIR}/main.hex ${BUILD_DIR}/main.mem ${BUILD_DIR}/main_disasm_annotated.asm
 
 # CFLAGS 和 LDFLAGS
 CFLAGS += --sysroot=$(RISCV_GCC_ROOT)/riscv64-unknown-elf
@@ -95,15 +96,20 @@ LDFLAGS += -L$(RISCV_GCC_ROOT)/riscv64-unknown-elf/lib/rv32im/ilp32
 .PHONY: all
 all: $(TARGET)
 
-$(TARGET): $(LINK_OBJS) $(LINK_DEPS) Makefile
+$(TARGET): $(LINK_OBJS) $(LINK_DEPS) Makefile | $(ELF2MEM)
 	$(CC) $(CFLAGS) $(INCLUDES) $(LINK_OBJS) -o $@ $(LDFLAGS) -lc -lgcc
 	$(OBJCOPY) -O binary $@ ${BUILD_DIR}/main.bin
 	$(OBJDUMP) -d $@ > ${BUILD_DIR}/main.dump
+	$(ELF2MEM) -o ${BUILD_DIR}/main --mem --asm $@
 	$(OBJCOPY) -O verilog $@ ${BUILD_DIR}/main.verilog
 	@if [ -n "$${SIM_ROOT_DIR}" ]; then \
 		${SIM_ROOT_DIR}/deps/tools/split_memory.sh ${BUILD_DIR}/main.verilog; \
 	fi
 
+$(ELF2MEM): $(SIM_ROOT_DIR)/deps/tools/elf2mem.cc
+	@mkdir -p $(dir $@)
+	g++ -std=c++17 -O2 -o $@ $<
+
 # 编译规则，自动创建目录
 ${BUILD_DIR}/%.o: $(RT_THREAD_ROOT)/%.c
 	@mkdir -p $(dir $@)
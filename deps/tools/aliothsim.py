@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+aliothsim.py  -  libaliothsim 的 Python 绑定 (ctypes)
+
+先构建共享库:
+    make libaliothsim
+
+用法:
+    from aliothsim import AliothSim
+    with AliothSim() as sim:
+        sim.load_elf("build/test_compiled/rv32ui-p-add")
+        sim.reset()
+        sim.run_until_pc(0x80000040, max_cycles=1_000_000)
+        print(sim.read_reg(3), sim.counters())
+
+库路径默认取 build/alioth_exec_verilator/libaliothsim.so，可用环境变量 ALIOTHSIM_LIB 覆盖。
+"""
+import ctypes, os, sys
+
+OK, FINISHED, TIMEOUT, ERROR = 0, 1, 2, -1
+ITCM, DTCM, XMEM = 0, 1, 2
+
+
+class Counters(ctypes.Structure):
+    _fields_ = [
+        ("cycles", ctypes.c_uint64),
+        ("mcycle", ctypes.c_uint64),
+        ("minstret", ctypes.c_uint64),
+        ("pc", ctypes.c_uint32),
+    ]
+
+    def as_dict(self) -> dict:
+        return {name: getattr(self, name) for name, _ in self._fields_}
+
+
+# ----------------------------------------------------------------------
+def _default_lib_path() -> str:
+    if env := os.environ.get("ALIOTHSIM_LIB"):
+        return env
+    root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+    return os.path.join(root, "build", "alioth_exec_verilator", "libaliothsim.so")
+
+
+def _load_lib(path: str) -> ctypes.CDLL:
+    lib = ctypes.CDLL(path)
+    p = ctypes.c_void_p
+    sigs = {
+        "aliothsim_create": (p, [ctypes.c_int, ctypes.POINTER(ctypes.c_char_p)]),
+        "aliothsim_destroy": (None, [p]),
+        "aliothsim_reset": (None, [p, ctypes.c_uint32]),
+        "aliothsim_load_elf": (ctypes.c_int, [p, ctypes.c_char_p]),
+        "aliothsim_step_cycles": (ctypes.c_int, [p, ctypes.c_uint64]),
+        "aliothsim_run_until_pc": (ctypes.c_int, [p, ctypes.c_uint32, ctypes.c_uint64]),
+        "aliothsim_read_reg": (ctypes.c_uint32, [p, ctypes.c_uint]),
+        "aliothsim_read_mem": (ctypes.c_int, [p, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_size_t]),
+        "aliothsim_write_mem": (ctypes.c_int, [p, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_size_t]),
+        "aliothsim_get_counters": (None, [p, ctypes.POINTER(Counters)]),
+        "aliothsim_finished": (ctypes.c_int, [p]),
+        "aliothsim_mem_view": (ctypes.c_int, [p, ctypes.c_int, ctypes.POINTER(ctypes.c_void_p),
+                                              ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32)]),
+        "aliothsim_load_bin": (ctypes.c_int, [p, ctypes.c_char_p, ctypes.c_uint32]),
+        "aliothsim_dump_bin": (ctypes.c_int, [p, ctypes.c_char_p, ctypes.c_uint32, ctypes.c_uint32]),
+    }
+    for name, (res, args) in sigs.items():
+        fn = getattr(lib, name)
+        fn.restype, fn.argtypes = res, args
+    return lib
+
+
+_lib = None
+
+
+def lib() -> ctypes.CDLL:
+    global _lib
+    if _lib is None:
+        _lib = _load_lib(_default_lib_path())
+    return _lib
+
+
+# ----------------------------------------------------------------------
+class AliothSim:
+    """单个仿真实例，args 透传给仿真(如 "-t" 打开波形，或 "+xxx=yyy" 形式的 plusargs)"""
+
+    def __init__(self, *args: str):
+        argv = (ctypes.c_char_p * len(args))(*[a.encode() for a in args])
+        self._h = lib().aliothsim_create(len(args), argv)
+        if not self._h:
+            raise RuntimeError("aliothsim_create failed (see stderr for the reason)")
+
+    def close(self):
+        if self._h:
+            lib().aliothsim_destroy(self._h)
+            self._h = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __del__(self):
+        self.close()
+
+    def reset(self, cycles: int = 50):
+        lib().aliothsim_reset(self._h, cycles)
+
+    def load_elf(self, path: str):
+        if lib().aliothsim_load_elf(self._h, os.fsencode(path)) != OK:
+            raise RuntimeError(f"failed to load {path}")
+
+    def step(self, cycles: int = 1) -> int:
+        return lib().aliothsim_step_cycles(self._h, cycles)
+
+    def run_until_pc(self, pc: int, max_cycles: int = 0) -> int:
+        return lib().aliothsim_run_until_pc(self._h, pc, max_cycles)
+
+    def read_reg(self, idx: int) -> int:
+        return lib().aliothsim_read_reg(self._h, idx)
+
+    def read_mem(self, addr: int, length: int) -> bytes:
+        buf = ctypes.create_string_buffer(length)
+        if lib().aliothsim_read_mem(self._h, addr, buf, length) != OK:
+            raise IndexError(f"0x{addr:08x}+{length} is outside ITCM/DTCM/XMEM")
+        return buf.raw
+
+    def write_mem(self, addr: int, data: bytes):
+        if lib().aliothsim_write_mem(self._h, addr, data, len(data)) != OK:
+            raise IndexError(f"0x{addr:08x}+{len(data)} is outside ITCM/DTCM/XMEM")
+
+    def mem_view(self, region: int = DTCM) -> tuple[int, memoryview]:
+        """返回 (总线基地址, 可写memoryview)，直接映射TCM存储阵列，不拷贝"""
+        ptr, base, size = ctypes.c_void_p(), ctypes.c_uint32(), ctypes.c_uint32()
+        if lib().aliothsim_mem_view(self._h, region, ptr, base, size) != OK:
+            raise ValueError(f"bad region {region}")
+        arr = (ctypes.c_uint8 * size.value).from_address(ptr.value)
+        return base.value, memoryview(arr).cast("B")
+
+    def load_bin(self, path: str, addr: int):
+        if lib().aliothsim_load_bin(self._h, os.fsencode(path), addr) != OK:
+            raise RuntimeError(f"failed to load {path} at 0x{addr:08x}")
+
+    def dump_bin(self, path: str, addr: int, length: int = 0):
+        if lib().aliothsim_dump_bin(self._h, os.fsencode(path), addr, length) != OK:
+            raise RuntimeError(f"failed to dump 0x{addr:08x}+{length} to {path}")
+
+    def counters(self) -> dict:
+        c = Counters()
+        lib().aliothsim_get_counters(self._h, ctypes.byref(c))
+        return c.as_dict()
+
+    @property
+    def finished(self) -> bool:
+        return bool(lib().aliothsim_finished(self._h))
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+    # 简易命令行: 运行ISA测试ELF并输出结果，替代解析 ~~~ 日志横幅
+    if len(sys.argv) < 2:
+        sys.exit(f"用法: {sys.argv[0]} <elf> [tohost_pc] [max_cycles]")
+    elf = sys.argv[1]
+    tohost = int(sys.argv[2], 0) if len(sys.argv) > 2 else 0x80000040
+    limit = int(sys.argv[3], 0) if len(sys.argv) > 3 else 1 << 20
+    with AliothSim() as sim:
+        sim.load_elf(elf)
+        sim.reset()
+        st = sim.run_until_pc(tohost, limit)
+        # 与tb_top.sv一致，等写回流水排空后再读取x3
+        if st == OK:
+            sim.step(16)
+        x3 = sim.read_reg(3)
+        c = sim.counters()
+        ipc = c["minstret"] / c["mcycle"] if c["mcycle"] else 0.0
+        print(f"{os.path.basename(elf)}: status={st} x3={x3} "
+              f"{'PASS' if st == OK and x3 == 1 else 'FAIL'} "
+              f"CYCLES={c['mcycle']} INSTS={c['minstret']} IPC={ipc:.4f}")
+        sys.exit(0 if st == OK and x3 == 1 else 1)
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""
+cov_summary.py  -  按模块汇总 Verilator 行/翻转覆盖率
+
+用法:
+    python3 cov_summary.py <coverage.dat> [--module 模块名] [--uncovered N]
+
+输入为 verilator_coverage --write 合并后的数据(也可直接用单次仿真的 coverage.dat)。
+默认输出每个模块的行覆盖与翻转覆盖统计；指定 --module 时额外列出该模块未覆盖的行。
+"""
+import argparse, re, sys
+from collections import defaultdict
+
+# 覆盖点格式: C '<\x01key\x02value ...>' count
+_POINT_RE = re.compile(r"^C '(.*)' (\d+)\s*$")
+
+
+def parse(path: str):
+    """产出 (类型, 模块, 文件, 行, 注释, 计数)"""
+    with open(path, "r", errors="replace") as f:
+        for ln in f:
+            m = _POINT_RE.match(ln)
+            if not m:
+                continue
+            kv = {}
+            for item in m.group(1).split("\x01"):
+                if "\x02" in item:
+                    k, v = item.split("\x02", 1)
+                    kv[k] = v
+            page = kv.get("page", "")
+            kind, _, module = page.partition("/")
+            yield (kind.removeprefix("v_"), module or "?", kv.get("f", "?"),
+                   int(kv.get("l", 0)), kv.get("o", ""), int(m.group(2)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    ap.add_argument("dat")
+    ap.add_argument("--module", help="列出该模块未覆盖的行覆盖点")
+    ap.add_argument("--uncovered", type=int, default=50, help="最多列出的未覆盖点数量")
+    args = ap.parse_args()
+
+    # stats[module][kind] = [hit, total]
+    stats = defaultdict(lambda: defaultdict(lambda: [0, 0]))
+    missed = []
+    for kind, module, fname, line, comment, count in parse(args.dat):
+        st = stats[module][kind]
+        st[1] += 1
+        if count > 0:
+            st[0] += 1
+        elif args.module == module:
+            missed.append((kind, fname, line, comment))
+
+    if not stats:
+        sys.exit(f"{args.dat}: no coverage points found")
+
+    def pct(hit_total):
+        hit, total = hit_total
+        return 100.0 * hit / total if total else 100.0
+
+    kinds = sorted({k for m in stats.values() for k in m})
+    hdr = f"{'module':<32}" + "".join(f"{k + ' hit/total':>22}{'%':>8}" for k in kinds)
+    print(hdr)
+    print("-" * len(hdr))
+    tot = defaultdict(lambda: [0, 0])
+    # 行覆盖率低的模块排在前面，便于定位未被负载覆盖的逻辑
+    for module in sorted(stats, key=lambda m: pct(stats[m].get("line", [0, 0]))):
+        row = f"{module:<32}"
+        for k in kinds:
+            hit, total = stats[module].get(k, [0, 0])
+            tot[k][0] += hit
+            tot[k][1] += total
+            row += f"{f'{hit}/{total}':>22}{pct([hit, total]):>7.1f}%"
+        print(row)
+    print("-" * len(hdr))
+    print(f"{'TOTAL':<32}" + "".join(f"{f'{tot[k][0]}/{tot[k][1]}':>22}{pct(tot[k]):>7.1f}%" for k in kinds))
+
+    if args.module:
+        print(f"\n未覆盖点 ({args.module}, 最多{args.uncovered}个):")
+        for kind, fname, line, comment in sorted(missed, key=lambda x: (x[1], x[2]))[:args.uncovered]:
+            print(f"  [{kind}] {fname}:{line} {comment}")
+
+
+if __name__ == "__main__":
+    main()
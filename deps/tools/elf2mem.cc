@@ -0,0 +1,783 @@
+/*
+ * elf2mem - 由ELF一次生成 .mem / .bin / 带符号注释的反汇编
+ *
+ * 取代 mem2bin.py(.mem -> .bin -> objdump -> 按jal目标猜测函数边界) 与
+ * BinToMem_CLI.py(逐字节转换)，直接读取ELF的段与符号表，不依赖外部objdump。
+ *
+ * 用法:
+ *     elf2mem [选项] <input>
+ *
+ *     input         ELF文件；也可为原始 .bin 或 .mem(每行一个32位字)，此时用 --base 指定加载地址
+ *     -o PREFIX     输出文件前缀，默认为输入文件去掉扩展名
+ *     --range R     只处理地址范围 R，格式 LO:HI(不含HI) 或 LO+LEN
+ *     --base ADDR   原始输入的加载地址，默认 0x80000000
+ *     --mem --bin --asm   只输出指定的类型(可组合)，默认全部输出
+ *
+ * 输出:
+ *     PREFIX.mem                      每行一个小端32位字
+ *     PREFIX.bin                      原始二进制
+ *     PREFIX_disasm_annotated.asm     反汇编，含函数起止标记、调用图与退出点
+ *
+ * 未指定 --range 时 .mem/.bin 覆盖全部可执行段(即ITCM映像)，反汇编覆盖全部可执行节。
+ */
+#include <elf.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ----------------------------------------------------------------------
+// 存储映像
+// ----------------------------------------------------------------------
+struct Chunk {
+    uint32_t addr;
+    std::vector<uint8_t> data;
+    bool exec;
+    std::string name;  // 节名，用于反汇编标题
+};
+
+struct Symbol {
+    uint32_t addr;
+    uint32_t size;
+    bool func;
+    std::string name;
+};
+
+struct Image {
+    std::vector<Chunk> segs;   // 加载段(.mem/.bin)
+    std::vector<Chunk> text;   // 可执行节(反汇编)
+    std::vector<Symbol> syms;  // 按地址排序
+    bool has_syms = false;
+    bool elf = false;
+};
+
+struct Range {
+    uint32_t lo = 0;
+    uint32_t hi = 0;  // 不含
+    bool valid = false;
+};
+
+[[noreturn]] void die(const std::string &msg) {
+    fprintf(stderr, "elf2mem: %s\n", msg.c_str());
+    exit(1);
+}
+
+std::vector<uint8_t> read_file(const std::string &path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) die("cannot open " + path);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), {});
+}
+
+bool ends_with(const std::string &s, const char *suffix) {
+    size_t n = strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+template <typename T>
+const T *at(const std::vector<uint8_t> &buf, size_t off, size_t n = 1) {
+    if (off + sizeof(T) * n > buf.size()) die("truncated ELF");
+    return reinterpret_cast<const T *>(buf.data() + off);
+}
+
+void load_elf(const std::vector<uint8_t> &buf, Image &img) {
+    auto *eh = at<Elf32_Ehdr>(buf, 0);
+    if (eh->e_ident[EI_CLASS] != ELFCLASS32 || eh->e_ident[EI_DATA] != ELFDATA2LSB)
+        die("only little-endian ELF32 is supported");
+    if (eh->e_machine != EM_RISCV) die("not a RISC-V ELF");
+
+    auto *ph = at<Elf32_Phdr>(buf, eh->e_phoff, eh->e_phnum);
+    for (int i = 0; i < eh->e_phnum; i++) {
+        if (ph[i].p_type != PT_LOAD || ph[i].p_memsz == 0) continue;
+        Chunk c{ph[i].p_paddr, std::vector<uint8_t>(ph[i].p_memsz, 0), (ph[i].p_flags & PF_X) != 0, ""};
+        if (ph[i].p_filesz)
+            memcpy(c.data.data(), at<uint8_t>(buf, ph[i].p_offset, ph[i].p_filesz), ph[i].p_filesz);
+        img.segs.push_back(std::move(c));
+    }
+
+    auto *sh = at<Elf32_Shdr>(buf, eh->e_shoff, eh->e_shnum);
+    const char *shstr = eh->e_shstrndx < eh->e_shnum
+                            ? at<char>(buf, sh[eh->e_shstrndx].sh_offset, sh[eh->e_shstrndx].sh_size)
+                            : nullptr;
+    for (int i = 0; i < eh->e_shnum; i++) {
+        const Elf32_Shdr &s = sh[i];
+        if ((s.sh_flags & SHF_EXECINSTR) && (s.sh_flags & SHF_ALLOC) && s.sh_type == SHT_PROGBITS &&
+            s.sh_size) {
+            auto *p = at<uint8_t>(buf, s.sh_offset, s.sh_size);
+            img.text.push_back({s.sh_addr, std::vector<uint8_t>(p, p + s.sh_size), true,
+                                shstr ? shstr + s.sh_name : ".text"});
+        }
+        if (s.sh_type == SHT_SYMTAB && s.sh_link < eh->e_shnum) {
+            auto *sym = at<Elf32_Sym>(buf, s.sh_offset, s.sh_size / sizeof(Elf32_Sym));
+            const Elf32_Shdr &strsec = sh[s.sh_link];
+            const char *str = at<char>(buf, strsec.sh_offset, strsec.sh_size);
+            for (size_t k = 0; k < s.sh_size / sizeof(Elf32_Sym); k++) {
+                int type = ELF32_ST_TYPE(sym[k].st_info);
+                if (sym[k].st_shndx == SHN_UNDEF || sym[k].st_shndx >= SHN_LORESERVE) continue;
+                if (type == STT_SECTION || type == STT_FILE) continue;
+                if (sym[k].st_name >= strsec.sh_size) continue;
+                const char *name = str + sym[k].st_name;
+                // 跳过空名与映射符号($x/$d)、编译器局部标号
+                if (!*name || name[0] == '$' || !strncmp(name, ".L", 2)) continue;
+                img.syms.push_back({sym[k].st_value, sym[k].st_size, type == STT_FUNC, name});
+            }
+        }
+    }
+    // 同地址优先保留函数符号，其次是全局名(按名称稳定排序)
+    std::stable_sort(img.syms.begin(), img.syms.end(), [](const Symbol &a, const Symbol &b) {
+        if (a.addr != b.addr) return a.addr < b.addr;
+        return a.func > b.func;
+    });
+    img.syms.erase(std::unique(img.syms.begin(), img.syms.end(),
+                               [](const Symbol &a, const Symbol &b) { return a.addr == b.addr; }),
+                   img.syms.end());
+    img.has_syms = !img.syms.empty();
+    img.elf = true;
+}
+
+void load_raw(const std::string &path, const std::vector<uint8_t> &buf, uint32_t base, Image &img) {
+    Chunk c{base, {}, true, ".data"};
+    if (ends_with(path, ".mem")) {
+        // 每行一个32位字(高字节在前)，按小端展开
+        std::string s(buf.begin(), buf.end());
+        size_t pos = 0;
+        while (pos < s.size()) {
+            size_t eol = s.find('\n', pos);
+            if (eol == std::string::npos) eol = s.size();
+            std::string ln = s.substr(pos, eol - pos);
+            pos = eol + 1;
+            size_t b = ln.find_first_not_of(" \t\r");
+            if (b == std::string::npos || ln.compare(b, 2, "//") == 0) continue;
+            uint32_t w = strtoul(ln.c_str() + b, nullptr, 16);
+            for (int i = 0; i < 4; i++) c.data.push_back((w >> (8 * i)) & 0xff);
+        }
+    } else {
+        c.data = buf;
+    }
+    img.segs.push_back(c);
+    img.text.push_back(std::move(c));
+}
+
+// 将映像中落在 [lo,hi) 的内容拷贝为连续缓冲区，空洞补0
+std::vector<uint8_t> flatten(const std::vector<Chunk> &chunks, uint32_t lo, uint32_t hi) {
+    std::vector<uint8_t> out(hi - lo, 0);
+    for (const auto &c : chunks) {
+        uint64_t s = std::max<uint64_t>(c.addr, lo);
+        uint64_t e = std::min<uint64_t>(uint64_t(c.addr) + c.data.size(), hi);
+        if (s < e) memcpy(out.data() + (s - lo), c.data.data() + (s - c.addr), e - s);
+    }
+    return out;
+}
+
+// ----------------------------------------------------------------------
+// 符号查找
+// ----------------------------------------------------------------------
+const Symbol *sym_at(const Image &img, uint32_t addr) {
+    auto it = std::lower_bound(img.syms.begin(), img.syms.end(), addr,
+                               [](const Symbol &s, uint32_t a) { return s.addr < a; });
+    return (it != img.syms.end() && it->addr == addr) ? &*it : nullptr;
+}
+
+// 形如 "800005a8 <main>" 或 "80000020 <foo+0x8>"，无符号时为 "0x800005a8"
+std::string sym_ref(const Image &img, uint32_t addr) {
+    char buf[64];
+    auto it = std::upper_bound(img.syms.begin(), img.syms.end(), addr,
+                               [](uint32_t a, const Symbol &s) { return a < s.addr; });
+    if (it == img.syms.begin()) {
+        snprintf(buf, sizeof(buf), "0x%x", addr);
+        return buf;
+    }
+    --it;
+    uint32_t off = addr - it->addr;
+    if (it->size ? off >= it->size + 4 : off >= 0x10000) {
+        snprintf(buf, sizeof(buf), "0x%x", addr);
+        return buf;
+    }
+    if (off) snprintf(buf, sizeof(buf), "%x <%s+0x%x>", addr, it->name.c_str(), off);
+    else snprintf(buf, sizeof(buf), "%x <%s>", addr, it->name.c_str());
+    return buf;
+}
+
+// ----------------------------------------------------------------------
+// RV32IMAC_Zicsr_Zba_Zbb_Zbs 反汇编
+// ----------------------------------------------------------------------
+const char *const kRegs[32] = {"zero", "ra", "sp", "gp", "tp",  "t0",  "t1", "t2", "s0", "s1", "a0",
+                               "a1",   "a2", "a3", "a4", "a5",  "a6",  "a7", "s2", "s3", "s4", "s5",
+                               "s6",   "s7", "s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6"};
+
+std::string csr_name(uint32_t csr) {
+    static const std::map<uint32_t, const char *> names = {
+        {0x300, "mstatus"},   {0x301, "misa"},      {0x304, "mie"},        {0x305, "mtvec"},
+        {0x340, "mscratch"},  {0x341, "mepc"},      {0x342, "mcause"},     {0x343, "mtval"},
+        {0x344, "mip"},       {0xb00, "mcycle"},    {0xb02, "minstret"},   {0xb80, "mcycleh"},
+        {0xb82, "minstreth"}, {0xc00, "cycle"},     {0xc01, "time"},       {0xc02, "instret"},
+        {0xc03, "hpmcounter3"}, {0xc04, "hpmcounter4"}, {0xc05, "hpmcounter5"}, {0xc06, "hpmcounter6"},
+        {0xc80, "cycleh"},    {0xc81, "timeh"},     {0xc82, "instreth"},   {0xf11, "mvendorid"},
+        {0xf12, "marchid"},   {0xf13, "mimpid"},    {0xf14, "mhartid"},
+    };
+    auto it = names.find(csr);
+    if (it != names.end()) return it->second;
+    char buf[16];
+    snprintf(buf, sizeof(buf), "0x%x", csr);
+    return buf;
+}
+
+struct Insn {
+    std::string text;     // "mnemonic\toperands"
+    uint32_t target = 0;  // 跳转/分支目标
+    bool has_target = false;
+    bool call = false;    // jal/jalr 写ra
+    bool ret = false;     // ret / jr / jalr x0
+    bool exit = false;    // ecall / wfi / 自跳转
+};
+
+int32_t sext(uint32_t v, int bits) { return int32_t(v << (32 - bits)) >> (32 - bits); }
+
+std::string fmt(const char *f, ...) __attribute__((format(printf, 1, 2)));
+std::string fmt(const char *f, ...) {
+    char buf[160];
+    va_list ap;
+    va_start(ap, f);
+    vsnprintf(buf, sizeof(buf), f, ap);
+    va_end(ap);
+    return buf;
+}
+
+Insn decode(const Image &img, uint32_t pc, uint32_t in) {
+    Insn r;
+    uint32_t op = in & 0x7f, rd = (in >> 7) & 31, f3 = (in >> 12) & 7, rs1 = (in >> 15) & 31,
+             rs2 = (in >> 20) & 31, f7 = in >> 25;
+    int32_t imm_i = int32_t(in) >> 20;
+    int32_t imm_s = (int32_t(in) >> 25 << 5) | int32_t((in >> 7) & 31);
+    int32_t imm_b = sext(((in >> 31) << 12) | (((in >> 7) & 1) << 11) | (((in >> 25) & 0x3f) << 5) |
+                             (((in >> 8) & 0xf) << 1),
+                         13);
+    int32_t imm_j = sext(((in >> 31) << 20) | (((in >> 12) & 0xff) << 12) | (((in >> 20) & 1) << 11) |
+                             (((in >> 21) & 0x3ff) << 1),
+                         21);
+    const char *D = kRegs[rd], *S1 = kRegs[rs1], *S2 = kRegs[rs2];
+
+    switch (op) {
+    case 0x37: r.text = fmt("lui\t%s,0x%x", D, in >> 12); break;
+    case 0x17: r.text = fmt("auipc\t%s,0x%x", D, in >> 12); break;
+    case 0x6f: {
+        r.target = pc + imm_j;
+        r.has_target = true;
+        std::string t = sym_ref(img, r.target);
+        if (rd == 0) r.text = "j\t" + t;
+        else if (rd == 1) r.text = "jal\t" + t;
+        else r.text = fmt("jal\t%s,", D) + t;
+        r.call = rd == 1;
+        r.exit = rd == 0 && r.target == pc;
+        break;
+    }
+    case 0x67:
+        if (f3 != 0) break;
+        if (rd == 0 && rs1 == 1 && imm_i == 0) r.text = "ret";
+        else if (rd == 0 && imm_i == 0) r.text = fmt("jr\t%s", S1);
+        else if (rd == 1 && imm_i == 0) r.text = fmt("jalr\t%s", S1);
+        else r.text = fmt("jalr\t%s,%d(%s)", D, imm_i, S1);
+        r.ret = rd == 0;
+        r.call = rd == 1;
+        break;
+    case 0x63: {
+        static const char *const mn[8] = {"beq", "bne", nullptr, nullptr, "blt", "bge", "bltu", "bgeu"};
+        if (!mn[f3]) break;
+        r.target = pc + imm_b;
+        r.has_target = true;
+        std::string t = sym_ref(img, r.target);
+        if (rs2 == 0 && f3 <= 5) {
+            static const char *const z[8] = {"beqz", "bnez", nullptr, nullptr, "bltz", "bgez"};
+            r.text = fmt("%s\t%s,", z[f3], S1) + t;
+        } else if (rs1 == 0 && (f3 == 4 || f3 == 5)) {
+            r.text = fmt("%s\t%s,", f3 == 4 ? "bgtz" : "blez", S2) + t;
+        } else {
+            r.text = fmt("%s\t%s,%s,", mn[f3], S1, S2) + t;
+        }
+        r.exit = r.target == pc;
+        break;
+    }
+    case 0x03: {
+        static const char *const mn[8] = {"lb", "lh", "lw", nullptr, "lbu", "lhu", nullptr, nullptr};
+        if (mn[f3]) r.text = fmt("%s\t%s,%d(%s)", mn[f3], D, imm_i, S1);
+        break;
+    }
+    case 0x23: {
+        static const char *const mn[8] = {"sb", "sh", "sw"};
+        if (f3 < 3) r.text = fmt("%s\t%s,%d(%s)", mn[f3], S2, imm_s, S1);
+        break;
+    }
+    case 0x13:
+        // 与GNU objdump一致，立即数形式的add/sll/srl/sra/xor/or/and不带i后缀(slti/sltiu除外)
+        switch (f3) {
+        case 0:
+            if (rd == 0 && rs1 == 0 && imm_i == 0) r.text = "nop";
+            else if (rs1 == 0) r.text = fmt("li\t%s,%d", D, imm_i);
+            else if (imm_i == 0) r.text = fmt("mv\t%s,%s", D, S1);
+            else r.text = fmt("add\t%s,%s,%d", D, S1, imm_i);
+            break;
+        case 1:
+            if (f7 == 0) r.text = fmt("sll\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x30) {
+                static const char *const un[8] = {"clz", "ctz", "cpop", nullptr, "sext.b", "sext.h"};
+                if (rs2 < 6 && un[rs2]) r.text = fmt("%s\t%s,%s", un[rs2], D, S1);
+            } else if (f7 == 0x24) r.text = fmt("bclri\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x14) r.text = fmt("bseti\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x34) r.text = fmt("binvi\t%s,%s,0x%x", D, S1, rs2);
+            break;
+        case 2: r.text = fmt("slti\t%s,%s,%d", D, S1, imm_i); break;
+        case 3:
+            r.text = imm_i == 1 ? fmt("seqz\t%s,%s", D, S1) : fmt("sltiu\t%s,%s,%d", D, S1, imm_i);
+            break;
+        case 4:
+            r.text = imm_i == -1 ? fmt("not\t%s,%s", D, S1) : fmt("xor\t%s,%s,%d", D, S1, imm_i);
+            break;
+        case 5:
+            if (f7 == 0) r.text = fmt("srl\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x20) r.text = fmt("sra\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x30) r.text = fmt("rori\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x24) r.text = fmt("bexti\t%s,%s,0x%x", D, S1, rs2);
+            else if (f7 == 0x34 && rs2 == 0x18) r.text = fmt("rev8\t%s,%s", D, S1);
+            else if (f7 == 0x14 && rs2 == 0x07) r.text = fmt("orc.b\t%s,%s", D, S1);
+            break;
+        case 6: r.text = fmt("or\t%s,%s,%d", D, S1, imm_i); break;
+        case 7: r.text = fmt("and\t%s,%s,%d", D, S1, imm_i); break;
+        }
+        break;
+    case 0x33: {
+        static const char *const base[8] = {"add", "sll", "slt", "sltu", "xor", "srl", "or", "and"};
+        static const char *const muldiv[8] = {"mul", "mulh", "mulhsu", "mulhu",
+                                              "div", "divu", "rem",    "remu"};
+        const char *mn = nullptr;
+        if (f7 == 0) mn = base[f3];
+        else if (f7 == 1) mn = muldiv[f3];
+        else if (f7 == 0x20 && f3 == 0) mn = "sub";
+        else if (f7 == 0x20 && f3 == 5) mn = "sra";
+        else if (f7 == 0x20) mn = f3 == 7 ? "andn" : f3 == 6 ? "orn" : f3 == 4 ? "xnor" : nullptr;
+        else if (f7 == 0x10) mn = f3 == 2 ? "sh1add" : f3 == 4 ? "sh2add" : f3 == 6 ? "sh3add" : nullptr;
+        else if (f7 == 0x05) mn = f3 == 4 ? "min" : f3 == 5 ? "minu" : f3 == 6 ? "max" : f3 == 7 ? "maxu" : nullptr;
+        else if (f7 == 0x30) mn = f3 == 1 ? "rol" : f3 == 5 ? "ror" : nullptr;
+        else if (f7 == 0x24) mn = f3 == 1 ? "bclr" : f3 == 5 ? "bext" : nullptr;
+        else if (f7 == 0x14 && f3 == 1) mn = "bset";
+        else if (f7 == 0x34 && f3 == 1) mn = "binv";
+        else if (f7 == 0x04 && f3 == 4 && rs2 == 0) {
+            r.text = fmt("zext.h\t%s,%s", D, S1);
+            break;
+        }
+        if (!mn) break;
+        if (f7 == 0x20 && f3 == 0 && rs1 == 0) r.text = fmt("neg\t%s,%s", D, S2);
+        else if (f7 == 0 && f3 == 3 && rs1 == 0) r.text = fmt("snez\t%s,%s", D, S2);
+        else if (f7 == 0 && f3 == 2 && rs2 == 0) r.text = fmt("sltz\t%s,%s", D, S1);
+        else if (f7 == 0 && f3 == 2 && rs1 == 0) r.text = fmt("sgtz\t%s,%s", D, S2);
+        else r.text = fmt("%s\t%s,%s,%s", mn, D, S1, S2);
+        break;
+    }
+    case 0x2f: {
+        const char *mn = nullptr;
+        switch (f7 >> 2) {
+        case 0x00: mn = "amoadd.w"; break;
+        case 0x01: mn = "amoswap.w"; break;
+        case 0x02: mn = rs2 == 0 ? "lr.w" : nullptr; break;
+        case 0x03: mn = "sc.w"; break;
+        case 0x04: mn = "amoxor.w"; break;
+        case 0x08: mn = "amoor.w"; break;
+        case 0x0c: mn = "amoand.w"; break;
+        case 0x10: mn = "amomin.w"; break;
+        case 0x14: mn = "amomax.w"; break;
+        case 0x18: mn = "amominu.w"; break;
+        case 0x1c: mn = "amomaxu.w"; break;
+        }
+        if (f3 != 2 || !mn) break;
+        static const char *const ord[4] = {"", ".rl", ".aq", ".aqrl"};
+        if (f7 >> 2 == 0x02) r.text = fmt("%s%s\t%s,(%s)", mn, ord[f7 & 3], D, S1);
+        else r.text = fmt("%s%s\t%s,%s,(%s)", mn, ord[f7 & 3], D, S2, S1);
+        break;
+    }
+    case 0x0f:
+        if (f3 == 1) {
+            r.text = "fence.i";
+        } else if (f3 == 0) {
+            uint32_t pred = (in >> 24) & 0xf, succ = (in >> 20) & 0xf;
+            auto set = [](uint32_t v) {
+                std::string s;
+                if (v & 8) s += 'i';
+                if (v & 4) s += 'o';
+                if (v & 2) s += 'r';
+                if (v & 1) s += 'w';
+                return s.empty() ? std::string("0") : s;
+            };
+            r.text = (pred == 0xf && succ == 0xf) ? "fence" : "fence\t" + set(pred) + "," + set(succ);
+        }
+        break;
+    case 0x73:
+        if (f3 == 0) {
+            switch (in) {
+            case 0x00000073: r.text = "ecall"; r.exit = true; break;
+            case 0x00100073: r.text = "ebreak"; break;
+            case 0x30200073: r.text = "mret"; r.ret = true; break;
+            case 0x10500073: r.text = "wfi"; r.exit = true; break;
+            }
+        } else if (f3 != 4) {
+            std::string c = csr_name(in >> 20);
+            bool imm = f3 & 4;
+            static const char *const full[4] = {nullptr, "csrrw", "csrrs", "csrrc"};
+            static const char *const shrt[4] = {nullptr, "csrw", "csrs", "csrc"};
+            std::string src = imm ? fmt("%u", rs1) : std::string(S1);
+            if (!imm && f3 == 2 && rs1 == 0) r.text = fmt("csrr\t%s,", D) + c;
+            else if (rd == 0) r.text = fmt("%s%s\t", shrt[f3 & 3], imm ? "i" : "") + c + "," + src;
+            else r.text = fmt("%s%s\t%s,", full[f3 & 3], imm ? "i" : "", D) + c + "," + src;
+        }
+        break;
+    }
+    if (r.text.empty()) r.text = fmt(".word\t0x%08x", in);
+    return r;
+}
+
+// 16位压缩指令展开为等价的32位编码后复用decode，与RTL中ifu_rvc_expand一致；
+// 保留编码及RV32不存在的编码返回0
+uint32_t rvc_expand(uint32_t c) {
+    auto bit = [c](int hi, int lo) { return (c >> lo) & ((1u << (hi - lo + 1)) - 1); };
+    auto enc_i = [](uint32_t imm, uint32_t rs1, uint32_t f3, uint32_t rd, uint32_t op) {
+        return ((imm & 0xfff) << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op;
+    };
+    auto enc_s = [](uint32_t imm, uint32_t rs2, uint32_t rs1, uint32_t f3) {
+        return ((imm >> 5 & 0x7f) << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | ((imm & 31) << 7) | 0x23;
+    };
+    auto enc_r = [](uint32_t f7, uint32_t rs2, uint32_t rs1, uint32_t f3, uint32_t rd) {
+        return (f7 << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | 0x33;
+    };
+    auto enc_b = [](int32_t imm, uint32_t rs1, uint32_t f3) {
+        uint32_t u = uint32_t(imm);
+        return ((u >> 12 & 1) << 31) | ((u >> 5 & 0x3f) << 25) | (rs1 << 15) | (f3 << 12) |
+               ((u >> 1 & 0xf) << 8) | ((u >> 11 & 1) << 7) | 0x63;
+    };
+    auto enc_j = [](int32_t imm, uint32_t rd) {
+        uint32_t u = uint32_t(imm);
+        return ((u >> 20 & 1) << 31) | ((u >> 1 & 0x3ff) << 21) | ((u >> 11 & 1) << 20) |
+               ((u >> 12 & 0xff) << 12) | (rd << 7) | 0x6f;
+    };
+
+    uint32_t rd = bit(11, 7), rs2 = bit(6, 2), rs1p = 8 + bit(9, 7), rs2p = 8 + bit(4, 2);
+    int32_t imm_ci = sext((bit(12, 12) << 5) | bit(6, 2), 6);
+    bool shamt_ok = !bit(12, 12);
+
+    switch (((c & 3) << 3) | bit(15, 13)) {
+    case 000: {  // c.addi4spn
+        uint32_t imm = (bit(10, 7) << 6) | (bit(12, 11) << 4) | (bit(5, 5) << 3) | (bit(6, 6) << 2);
+        return imm ? enc_i(imm, 2, 0, rs2p, 0x13) : 0;
+    }
+    case 002: return enc_i((bit(5, 5) << 6) | (bit(12, 10) << 3) | (bit(6, 6) << 2), rs1p, 2, rs2p, 0x03);
+    case 006: return enc_s((bit(5, 5) << 6) | (bit(12, 10) << 3) | (bit(6, 6) << 2), rs2p, rs1p, 2);
+    case 010: return enc_i(imm_ci, rd, 0, rd, 0x13);  // c.addi/c.nop
+    case 011:
+    case 015: {  // c.jal / c.j
+        int32_t imm = sext((bit(12, 12) << 11) | (bit(8, 8) << 10) | (bit(10, 9) << 8) | (bit(6, 6) << 7) |
+                               (bit(7, 7) << 6) | (bit(2, 2) << 5) | (bit(11, 11) << 4) | (bit(5, 3) << 1),
+                           12);
+        return enc_j(imm, bit(15, 13) == 1 ? 1 : 0);
+    }
+    case 012: return enc_i(imm_ci, 0, 0, rd, 0x13);  // c.li
+    case 013:
+        if (rd == 2) {  // c.addi16sp
+            int32_t imm = sext((bit(12, 12) << 9) | (bit(4, 3) << 7) | (bit(5, 5) << 6) | (bit(2, 2) << 5) |
+                                   (bit(6, 6) << 4),
+                               10);
+            return imm ? enc_i(imm, 2, 0, 2, 0x13) : 0;
+        }
+        return imm_ci ? (uint32_t(imm_ci) << 12) | (rd << 7) | 0x37 : 0;  // c.lui
+    case 014:
+        switch (bit(11, 10)) {
+        case 0: return shamt_ok ? enc_i(rs2, rs1p, 5, rs1p, 0x13) : 0;                // c.srli
+        case 1: return shamt_ok ? enc_i(0x400 | rs2, rs1p, 5, rs1p, 0x13) : 0;        // c.srai
+        case 2: return enc_i(imm_ci, rs1p, 7, rs1p, 0x13);                            // c.andi
+        default: {
+            if (bit(12, 12)) return 0;  // RV64的c.subw/c.addw
+            static const uint32_t f3[4] = {0, 4, 6, 7};  // c.sub/c.xor/c.or/c.and
+            return enc_r(bit(6, 5) == 0 ? 0x20 : 0, rs2p, rs1p, f3[bit(6, 5)], rs1p);
+        }
+        }
+    case 016:
+    case 017: {  // c.beqz / c.bnez
+        int32_t imm = sext((bit(12, 12) << 8) | (bit(6, 5) << 6) | (bit(2, 2) << 5) | (bit(11, 10) << 3) |
+                               (bit(4, 3) << 1),
+                           9);
+        return enc_b(imm, rs1p, bit(13, 13));
+    }
+    case 020: return shamt_ok ? enc_i(rs2, rd, 1, rd, 0x13) : 0;  // c.slli
+    case 022:  // c.lwsp
+        return rd ? enc_i((bit(3, 2) << 6) | (bit(12, 12) << 5) | (bit(6, 4) << 2), 2, 2, rd, 0x03) : 0;
+    case 024:
+        if (!bit(12, 12)) {
+            if (rs2 == 0) return rd ? enc_i(0, rd, 0, 0, 0x67) : 0;  // c.jr
+            return enc_r(0, rs2, 0, 0, rd);                          // c.mv
+        }
+        if (rs2 == 0) return rd ? enc_i(0, rd, 0, 1, 0x67) : 0x00100073;  // c.jalr / c.ebreak
+        return enc_r(0, rs2, rd, 0, rd);                                  // c.add
+    case 026: return enc_s((bit(8, 7) << 6) | (bit(12, 9) << 2), rs2, 2, 2);  // c.swsp
+    default: return 0;
+    }
+}
+
+// ----------------------------------------------------------------------
+// 反汇编输出
+// ----------------------------------------------------------------------
+struct Func {
+    uint32_t addr;
+    uint32_t end;  // 不含，0表示到下一个入口/ret为止
+    std::string name;
+};
+
+void write_disasm(FILE *out, const Image &img, const std::string &title, const Range &rng) {
+    fprintf(out, "\n%s:     file format %s\n\n", title.c_str(), img.elf ? "elf32-littleriscv" : "binary");
+
+    // 函数入口：有符号表时取STT_FUNC(及无大小的全局标号)，否则退化为jal目标
+    std::map<uint32_t, Func> funcs;
+    if (img.has_syms) {
+        for (const auto &s : img.syms)
+            if (s.func) funcs[s.addr] = {s.addr, s.size ? s.addr + s.size : 0, s.name};
+    } else {
+        for (const auto &c : img.text) {
+            funcs[c.addr] = {c.addr, 0, ""};
+            for (size_t off = 0; off + 2 <= c.data.size();) {
+                uint32_t pc = c.addr + off;
+                uint32_t in = c.data[off] | c.data[off + 1] << 8;
+                if ((in & 3) != 3) {
+                    in = rvc_expand(in);
+                    off += 2;
+                } else if (off + 4 <= c.data.size()) {
+                    memcpy(&in, &c.data[off], 4);
+                    off += 4;
+                } else {
+                    break;
+                }
+                if ((in & 0x7f) == 0x6f && ((in >> 7) & 31) == 1) {
+                    Insn d = decode(img, pc, in);
+                    funcs[d.target] = {d.target, 0, ""};
+                }
+            }
+        }
+    }
+
+    std::map<uint32_t, std::set<uint32_t>> call_graph;
+    std::vector<std::pair<uint32_t, std::string>> exits;
+
+    for (const auto &c : img.text) {
+        uint32_t lo = c.addr, hi = c.addr + c.data.size();
+        if (rng.valid) {
+            lo = std::max(lo, rng.lo);
+            hi = std::min(hi, rng.hi);
+            if (lo >= hi) continue;
+        }
+        fprintf(out, "\nDisassembly of section %s:\n", c.name.c_str());
+
+        const Func *cur = nullptr;
+        // 各寄存器最近一条lui/auipc的结果，被addi/访存/jalr引用一次后失效(与GNU objdump一致)，
+        // 用于给后续访存/跳转补充绝对地址注释
+        bool hi_ok[32] = {};
+        uint32_t hi_val[32] = {};
+        uint32_t pc = lo;
+        while (pc < hi) {
+            auto fit = funcs.find(pc);
+            if (fit != funcs.end()) {
+                if (cur) fprintf(out, "### FUNC_END   %08x ###\n", cur->addr);
+                cur = &fit->second;
+                fprintf(out, "\n### FUNC_START %08x ###\n", pc);
+            }
+            if (const Symbol *s = sym_at(img, pc)) fprintf(out, "%08x <%s>:\n", pc, s->name.c_str());
+
+            size_t off = pc - c.addr;
+            uint16_t lo16 = c.data[off] | (off + 1 < c.data.size() ? c.data[off + 1] << 8 : 0);
+            bool rvc = (lo16 & 3) != 3;
+            uint32_t in = rvc ? rvc_expand(lo16) : 0;
+            if ((rvc && in == 0) || (!rvc && off + 4 > c.data.size())) {
+                // 保留的16位编码(或节尾不足4字节)
+                fprintf(out, "%8x:\t%04x                \t.2byte\t0x%x\n", pc, lo16, lo16);
+                pc += 2;
+                continue;
+            }
+            if (!rvc) memcpy(&in, &c.data[off], 4);
+            Insn d = decode(img, pc, in);
+
+            std::string note;
+            uint32_t op = in & 0x7f, rd = (in >> 7) & 31, rs1 = (in >> 15) & 31;
+            uint32_t f3 = (in >> 12) & 7;
+            bool addr_use = (op == 0x13 && f3 == 0 && rs1 != 0 && (in >> 20) != 0) ||
+                            (op == 0x03 || op == 0x23 || (op == 0x67 && f3 == 0));
+            if (addr_use && hi_ok[rs1]) {
+                int32_t imm = op == 0x23 ? (int32_t(in) >> 25 << 5) | int32_t((in >> 7) & 31)
+                                         : int32_t(in) >> 20;
+                uint32_t a = hi_val[rs1] + imm;
+                hi_ok[rs1] = false;
+                std::string ref = sym_ref(img, a);
+                size_t lt = ref.find('<');
+                note = lt == std::string::npos ? " # " + ref : fmt(" # 0x%x ", a) + ref.substr(lt);
+                // auipc+jalr 形式的 call/tail
+                if (op == 0x67) {
+                    d.target = a;
+                    d.has_target = true;
+                }
+            }
+            if ((op == 0x37 || op == 0x17) && rd != 0) {
+                hi_ok[rd] = true;
+                hi_val[rd] = (in & 0xfffff000) + (op == 0x17 ? pc : 0);
+            }
+
+            if (rvc) fprintf(out, "%8x:\t%04x                \t%s%s\n", pc, lo16, d.text.c_str(), note.c_str());
+            else fprintf(out, "%8x:\t%08x          \t%s%s\n", pc, in, d.text.c_str(), note.c_str());
+
+            if (cur && d.call && d.has_target && funcs.count(d.target))
+                call_graph[cur->addr].insert(d.target);
+            if (d.exit) exits.emplace_back(pc, d.text);
+
+            pc += rvc ? 2 : 4;
+            // 有大小的函数按符号大小结束，否则以ret/jr启发式结束
+            if (cur && ((cur->end && pc >= cur->end) || (!cur->end && d.ret))) {
+                fprintf(out, "### FUNC_END   %08x ###\n", cur->addr);
+                cur = nullptr;
+            }
+        }
+        if (cur) fprintf(out, "### FUNC_END   %08x ###\n", cur->addr);
+    }
+
+    fprintf(out, "\n===== CALL GRAPH =====\n");
+    for (const auto &kv : funcs) {
+        if (rng.valid && (kv.first < rng.lo || kv.first >= rng.hi)) continue;
+        const std::string &nm = kv.second.name;
+        fprintf(out, "0x%08x%s%s%s ->", kv.first, nm.empty() ? "" : " <", nm.c_str(), nm.empty() ? "" : ">");
+        auto it = call_graph.find(kv.first);
+        if (it == call_graph.end() || it->second.empty()) {
+            fprintf(out, " (none)\n");
+            continue;
+        }
+        const char *sep = " ";
+        for (uint32_t callee : it->second) {
+            const std::string &cn = funcs[callee].name;
+            fprintf(out, "%s0x%08x%s%s%s", sep, callee, cn.empty() ? "" : " <", cn.c_str(), cn.empty() ? "" : ">");
+            sep = ", ";
+        }
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "\n===== EXIT POINTS =====\n");
+    if (exits.empty()) fprintf(out, "(未检测到 ecall / wfi / 死循环)\n");
+    for (const auto &e : exits) fprintf(out, "0x%08x : %s\n", e.first, e.second.c_str());
+}
+
+bool parse_range(const char *s, Range &r) {
+    char *end;
+    uint64_t lo = strtoull(s, &end, 0);
+    if (*end != ':' && *end != '+') return false;
+    bool len = *end == '+';
+    uint64_t v = strtoull(end + 1, &end, 0);
+    if (*end) return false;
+    uint64_t hi = len ? lo + v : v;
+    if (hi <= lo || hi > 0x100000000ull) return false;
+    r = {uint32_t(lo), uint32_t(hi), true};
+    return true;
+}
+
+void usage() {
+    fprintf(stderr,
+            "用法: elf2mem [-o PREFIX] [--range LO:HI|LO+LEN] [--base ADDR] [--mem] [--bin] [--asm] <input>\n");
+    exit(1);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::string input, prefix;
+    Range rng;
+    uint32_t base = 0x80000000;
+    bool want_mem = false, want_bin = false, want_asm = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-o" && i + 1 < argc) prefix = argv[++i];
+        else if (a == "--range" && i + 1 < argc) {
+            if (!parse_range(argv[++i], rng)) die(std::string("bad range ") + argv[i]);
+        } else if (a == "--base" && i + 1 < argc) base = strtoul(argv[++i], nullptr, 0);
+        else if (a == "--mem") want_mem = true;
+        else if (a == "--bin") want_bin = true;
+        else if (a == "--asm") want_asm = true;
+        else if (a[0] == '-') usage();
+        else input = a;
+    }
+    if (input.empty()) usage();
+    if (!want_mem && !want_bin && !want_asm) want_mem = want_bin = want_asm = true;
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<uint8_t> buf = read_file(input);
+    Image img;
+    if (buf.size() >= 4 && !memcmp(buf.data(), ELFMAG, SELFMAG)) load_elf(buf, img);
+    else load_raw(input, buf, base, img);
+
+    if (prefix.empty()) {
+        size_t slash = input.find_last_of('/');
+        size_t dot = input.find_last_of('.');
+        prefix = (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+                     ? input.substr(0, dot)
+                     : input;
+    }
+
+    // .mem/.bin的默认范围为全部可执行段
+    Range img_rng = rng;
+    if (!img_rng.valid) {
+        uint64_t lo = UINT64_MAX, hi = 0;
+        for (const auto &c : img.segs) {
+            if (!c.exec) continue;
+            lo = std::min<uint64_t>(lo, c.addr);
+            hi = std::max<uint64_t>(hi, uint64_t(c.addr) + c.data.size());
+        }
+        if (hi > lo) img_rng = {uint32_t(lo), uint32_t(hi), true};
+    }
+
+    if ((want_mem || want_bin) && img_rng.valid) {
+        // 按字对齐，.mem按字输出
+        uint32_t lo = img_rng.lo & ~3u;
+        uint32_t hi = uint32_t(std::min<uint64_t>((uint64_t(img_rng.hi) + 3) & ~3ull, 0xfffffffcu));
+        std::vector<uint8_t> flat = flatten(img.segs, lo, hi);
+        if (want_bin && prefix + ".bin" != input) {
+            FILE *f = fopen((prefix + ".bin").c_str(), "wb");
+            if (!f) die("cannot write " + prefix + ".bin");
+            fwrite(flat.data(), 1, flat.size(), f);
+            fclose(f);
+        }
+        if (want_mem && prefix + ".mem" != input) {
+            std::string s;
+            s.reserve(flat.size() / 4 * 9);
+            char w[10];
+            for (size_t i = 0; i < flat.size(); i += 4) {
+                snprintf(w, sizeof(w), "%02x%02x%02x%02x\n", flat[i + 3], flat[i + 2], flat[i + 1], flat[i]);
+                s += w;
+            }
+            FILE *f = fopen((prefix + ".mem").c_str(), "w");
+            if (!f) die("cannot write " + prefix + ".mem");
+            fwrite(s.data(), 1, s.size(), f);
+            fclose(f);
+        }
+    }
+
+    if (want_asm) {
+        std::string path = prefix + "_disasm_annotated.asm";
+        FILE *f = fopen(path.c_str(), "w");
+        if (!f) die("cannot write " + path);
+        write_disasm(f, img, input, rng);
+        fclose(f);
+    }
+
+    auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    printf("[✓] %s -> %s{%s%s%s} (%zu symbols, %.1f ms)\n", input.c_str(), prefix.c_str(),
+           want_mem ? ".mem," : "", want_bin ? ".bin," : "", want_asm ? "_disasm_annotated.asm" : "",
+           img.syms.size(), ms);
+    return 0;
+}